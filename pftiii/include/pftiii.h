@@ -12,10 +12,11 @@
  * and submit this implementation as a shared library. The name of the library
  * must follow the instructions outlined in the test plan, and be identical to
  * the required information returned from
- * PFTIII::Interface::getIdentification(). A test application will link against
- * the submitted library, instantiate an instance of the implementation
- * by calling PFTIII::Interface::getImplementation(), and perform various
- * template creation and comparison operations.
+ * PFTIII::Interface::getIdentification() and
+ * PFTIII::Interface::getSubmissionIdentification(). A test application will
+ * link against the submitted library, instantiate an instance of the
+ * implementation by calling PFTIII::Interface::getImplementation(), and
+ * perform various template creation and comparison operations.
  *
  * @section Contact
  * Additional information regarding the Proprietary Fingerprint Template
@@ -157,6 +158,175 @@ namespace PFTIII
 		    FrictionRidgeGeneralizedPosition::Unknown};
 	};
 
+	/**
+	 * @brief
+	 * Proprietary template storage with cache line alignment.
+	 *
+	 * @details
+	 * The first byte of a TemplateBuffer is aligned to
+	 * TemplateBuffer::Alignment bytes, and the allocation is zero-padded
+	 * to the next multiple of TemplateBuffer::Alignment. Implementations
+	 * may therefore issue aligned, full-width vector loads across all
+	 * paddedSize() bytes without a scalar loop for the tail.
+	 *
+	 * @note
+	 * Templates are exchanged with the API as `std::vector<std::byte>`.
+	 * Converting to and from that form is a single copy.
+	 */
+	class TemplateBuffer
+	{
+	public:
+		/** Alignment (and padding granularity) of the storage. */
+		static constexpr std::size_t Alignment{64};
+
+		/** Default constructor (empty buffer). */
+		TemplateBuffer();
+
+		/**
+		 * @brief
+		 * TemplateBuffer constructor.
+		 *
+		 * @param size
+		 * Number of zero-initialized bytes to allocate.
+		 */
+		explicit TemplateBuffer(
+		    const std::size_t size);
+
+		/**
+		 * @brief
+		 * TemplateBuffer constructor.
+		 *
+		 * @param data
+		 * Bytes to copy into the buffer.
+		 * @param size
+		 * Number of bytes pointed to by `data`.
+		 */
+		TemplateBuffer(
+		    const std::byte *data,
+		    const std::size_t size);
+
+		/**
+		 * @brief
+		 * TemplateBuffer constructor.
+		 *
+		 * @param proprietaryTemplate
+		 * Template to copy into the buffer.
+		 */
+		explicit TemplateBuffer(
+		    const std::vector<std::byte> &proprietaryTemplate);
+
+		/** Copy constructor. */
+		TemplateBuffer(
+		    const TemplateBuffer &rhs);
+		/** Copy assignment operator. */
+		TemplateBuffer&
+		operator=(
+		    const TemplateBuffer &rhs);
+		/** Move constructor. */
+		TemplateBuffer(
+		    TemplateBuffer &&rhs)
+		    noexcept;
+		/** Move assignment operator. */
+		TemplateBuffer&
+		operator=(
+		    TemplateBuffer &&rhs)
+		    noexcept;
+
+		/**
+		 * @return
+		 * Pointer to the first byte, aligned to Alignment, or
+		 * `nullptr` if empty().
+		 */
+		std::byte*
+		data()
+		    noexcept;
+
+		/**
+		 * @return
+		 * Pointer to the first byte, aligned to Alignment, or
+		 * `nullptr` if empty().
+		 */
+		const std::byte*
+		data()
+		    const
+		    noexcept;
+
+		/** @return Number of bytes of template data. */
+		std::size_t
+		size()
+		    const
+		    noexcept;
+
+		/**
+		 * @return
+		 * Number of readable bytes, including zero padding. Always a
+		 * multiple of Alignment.
+		 */
+		std::size_t
+		paddedSize()
+		    const
+		    noexcept;
+
+		/** @return Whether or not the buffer contains any data. */
+		bool
+		empty()
+		    const
+		    noexcept;
+
+		/** @return Iterator to the first byte of template data. */
+		const std::byte*
+		begin()
+		    const
+		    noexcept;
+
+		/** @return Iterator past the last byte of template data. */
+		const std::byte*
+		end()
+		    const
+		    noexcept;
+
+		/**
+		 * @brief
+		 * Copy template data into the form exchanged with the API.
+		 *
+		 * @return
+		 * The first size() bytes of the buffer.
+		 */
+		std::vector<std::byte>
+		toVector()
+		    const;
+
+		/** Destructor. */
+		~TemplateBuffer();
+
+	private:
+		/** Releases storage obtained with aligned operator new. */
+		struct AlignedDelete
+		{
+			void
+			operator()(
+			    std::byte *p)
+			    const
+			    noexcept;
+		};
+
+		/**
+		 * @brief
+		 * Allocate aligned storage with zero-filled padding.
+		 *
+		 * @param size
+		 * Number of bytes of template data to be stored.
+		 */
+		void
+		allocate(
+		    const std::size_t size);
+
+		/** Aligned storage. */
+		std::unique_ptr<std::byte[], AlignedDelete> storage{};
+		/** Number of bytes of template data in storage. */
+		std::size_t length{};
+	};
+
 	/** Information about whether a FingerImage is supported. */
 	struct FingerImageStatus
 	{
@@ -470,6 +640,30 @@ namespace PFTIII
 		getIdentification()
 		    const = 0;
 
+		/**
+		 * @brief
+		 * Obtain identification and version information for this
+		 * submission without instantiating an implementation.
+		 *
+		 * @return
+		 * SubmissionIdentification populated with information used
+		 * to identify this submission in reports.
+		 *
+		 * @note
+		 * This method shall return instantly. It shall not read from
+		 * the configuration directory or otherwise initialize the
+		 * algorithm, since it is used to inventory libraries
+		 * without paying the cost of getImplementation().
+		 *
+		 * @note
+		 * The value returned shall be identical to the value returned
+		 * from getIdentification() of any instance obtained from
+		 * getImplementation().
+		 */
+		static
+		SubmissionIdentification
+		getSubmissionIdentification();
+
 		/**
 		 * @brief
 		 * Create a proprietary biometric template from a fingerprint
@@ -573,6 +767,30 @@ namespace PFTIII
 		    const std::vector<std::byte> &probeTemplate,
 		    const std::vector<std::byte> &referenceTemplate) = 0;
 
+		/**
+		 * @brief
+		 * Declare whether this instance may be shared between
+		 * threads.
+		 *
+		 * @return
+		 * true if createProprietaryTemplate() and
+		 * compareProprietaryTemplates() may be called concurrently,
+		 * from any number of threads, on this instance. false
+		 * otherwise.
+		 *
+		 * @note
+		 * The default implementation returns false. An instance is
+		 * only shared between threads when this method returns true.
+		 * Otherwise, parallel testing uses separate processes.
+		 *
+		 * @note
+		 * This method shall return instantly.
+		 */
+		virtual
+		bool
+		isReentrant()
+		    const;
+
 		/** Destructor. */
 		virtual ~Interface();
 
@@ -633,7 +851,7 @@ namespace PFTIII
 	/** API major version number. */
 	uint16_t API_MAJOR_VERSION{1};
 	/** API minor version number. */
-	uint16_t API_MINOR_VERSION{1};
+	uint16_t API_MINOR_VERSION{3};
 	/** API patch version number. */
 	uint16_t API_PATCH_VERSION{0};
 	#endif /* NIST_EXTERN_API_VERSION */
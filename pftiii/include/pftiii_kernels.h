@@ -0,0 +1,412 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_KERNELS_H_
+#define PFTIII_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <pftiii.h>
+
+/** Proprietary Fingerprint Template Evaluation III namespace. */
+namespace PFTIII
+{
+	/**
+	 * @brief
+	 * Vectorized building blocks for template creation and comparison.
+	 *
+	 * @details
+	 * Each kernel is implemented for several instruction set extensions
+	 * and dispatched at runtime to the most capable extension supported
+	 * by the CPU. Every variant returns bit-identical results, so the
+	 * determinism requirements of the API hold regardless of the machine
+	 * on which a kernel runs.
+	 */
+	namespace Kernels
+	{
+		/** Values measured over square blocks of an image. */
+		struct BlockMap
+		{
+			/** Width and height of each block, in pixels. */
+			uint16_t blockSize{};
+			/**
+			 * Number of blocks across the image. The last column
+			 * may be narrower than blockSize.
+			 */
+			uint16_t columns{};
+			/**
+			 * Number of blocks down the image. The last row may
+			 * be shorter than blockSize.
+			 */
+			uint16_t rows{};
+			/**
+			 * `rows` * `columns` values, such that
+			 * `values[(row * columns) + column]` is the value of
+			 * the block at (`column`, `row`).
+			 */
+			std::vector<float> values{};
+		};
+
+		/** Instruction set extensions to which kernels dispatch. */
+		enum class InstructionSet
+		{
+			/** Portable C++. */
+			Scalar = 0,
+			/** SSE 4.2 and POPCNT. */
+			SSE42 = 1,
+			/** AVX2. */
+			AVX2 = 2,
+			/** AVX-512 Foundation and Byte/Word. */
+			AVX512 = 3
+		};
+
+		/**
+		 * @return
+		 * Most capable instruction set extension that is supported by
+		 * both this CPU and the operating system.
+		 */
+		InstructionSet
+		getSupportedInstructionSet();
+
+		/**
+		 * @return
+		 * Instruction set extension to which kernels currently
+		 * dispatch.
+		 */
+		InstructionSet
+		getInstructionSet();
+
+		/**
+		 * @brief
+		 * Limit the instruction set extensions to which kernels
+		 * dispatch.
+		 *
+		 * @param maximum
+		 * Most capable extension that may be used.
+		 *
+		 * @return
+		 * Extension that will be used: the lesser of `maximum` and
+		 * getSupportedInstructionSet().
+		 *
+		 * @note
+		 * Results do not depend on the extension used. This is
+		 * intended for benchmarking and debugging.
+		 */
+		InstructionSet
+		setInstructionSet(
+		    const InstructionSet maximum);
+
+		/**
+		 * @brief
+		 * Count bits set in a bit descriptor.
+		 *
+		 * @param bits
+		 * Bit descriptor.
+		 *
+		 * @return
+		 * Number of bits set in `bits`.
+		 */
+		uint64_t
+		popcount(
+		    std::span<const std::byte> bits);
+
+		/**
+		 * @brief
+		 * Compute Hamming distances from one bit descriptor to many.
+		 *
+		 * @param query
+		 * Bit descriptor to compare against each of `descriptors`.
+		 * @param descriptors
+		 * `distances.size()` bit descriptors of `query.size()` bytes
+		 * each, stored contiguously.
+		 * @param distances
+		 * Populated with the number of bits that differ between
+		 * `query` and each of `descriptors`.
+		 *
+		 * @throw std::invalid_argument
+		 * `descriptors.size()` is not `query.size()` *
+		 * `distances.size()`.
+		 */
+		void
+		hammingDistances(
+		    std::span<const std::byte> query,
+		    std::span<const std::byte> descriptors,
+		    std::span<uint32_t> distances);
+
+		/**
+		 * @brief
+		 * Compute Euclidean distances between every probe minutia and
+		 * every reference minutia.
+		 *
+		 * @param probeX
+		 * X coordinates of probe minutiae.
+		 * @param probeY
+		 * Y coordinates of probe minutiae.
+		 * @param referenceX
+		 * X coordinates of reference minutiae.
+		 * @param referenceY
+		 * Y coordinates of reference minutiae.
+		 * @param distances
+		 * Populated with `probeX.size()` rows of `referenceX.size()`
+		 * distances, such that `distances[(p * referenceX.size()) +
+		 * r]` is the distance between probe minutia `p` and reference
+		 * minutia `r`.
+		 *
+		 * @throw std::invalid_argument
+		 * Coordinate spans differ in size or `distances` is not
+		 * `probeX.size()` * `referenceX.size()`.
+		 */
+		void
+		pairwiseDistances(
+		    std::span<const float> probeX,
+		    std::span<const float> probeY,
+		    std::span<const float> referenceX,
+		    std::span<const float> referenceY,
+		    std::span<float> distances);
+
+		/**
+		 * @brief
+		 * Compute the smallest absolute difference between every
+		 * probe minutia direction and every reference minutia
+		 * direction.
+		 *
+		 * @param probeTheta
+		 * Probe minutia directions, in radians, in [0, 2π).
+		 * @param referenceTheta
+		 * Reference minutia directions, in radians, in [0, 2π).
+		 * @param differences
+		 * Populated with `probeTheta.size()` rows of
+		 * `referenceTheta.size()` differences in [0, π], laid out as
+		 * in pairwiseDistances().
+		 *
+		 * @throw std::invalid_argument
+		 * `differences` is not `probeTheta.size()` *
+		 * `referenceTheta.size()`.
+		 */
+		void
+		pairwiseAngleDifferences(
+		    std::span<const float> probeTheta,
+		    std::span<const float> referenceTheta,
+		    std::span<float> differences);
+
+		/**
+		 * @brief
+		 * Select the indices of the highest scores.
+		 *
+		 * @param scores
+		 * Scores to select from. Shall not contain NaN.
+		 * @param k
+		 * Number of indices to select.
+		 *
+		 * @return
+		 * Indices of the min(`k`, `scores.size()`) highest scores,
+		 * ordered by descending score. Equal scores are ordered by
+		 * ascending index.
+		 */
+		std::vector<uint32_t>
+		topK(
+		    std::span<const float> scores,
+		    const std::size_t k);
+
+		/**
+		 * @brief
+		 * Resample an image to a different resolution.
+		 *
+		 * @param fingerImage
+		 * Image to resample.
+		 * @param ppi
+		 * Desired resolution, in pixels per inch.
+		 *
+		 * @return
+		 * Copy of `fingerImage` at `ppi`. Dimensions are scaled by
+		 * `ppi` / `fingerImage.ppi`, rounded to the nearest pixel.
+		 *
+		 * @throw std::invalid_argument
+		 * Either resolution is 0, `fingerImage.pixels` does not hold
+		 * `fingerImage.width` * `fingerImage.height` bytes, or the
+		 * resampled image would be too large to describe.
+		 *
+		 * @note
+		 * The image is filtered separably with a triangle filter in
+		 * fixed point, widened when downsampling to avoid aliasing.
+		 * Common resolution pairs are handled by the specializations
+		 * of resample<SourcePPI, TargetPPI>().
+		 */
+		FingerImage
+		resample(
+		    const FingerImage &fingerImage,
+		    const uint16_t ppi);
+
+		/**
+		 * @brief
+		 * Resample an image between resolutions known at compile time.
+		 *
+		 * @tparam SourcePPI
+		 * Resolution of images passed to this function.
+		 * @tparam TargetPPI
+		 * Desired resolution.
+		 *
+		 * @param fingerImage
+		 * Image at `SourcePPI` to resample.
+		 *
+		 * @return
+		 * Copy of `fingerImage` at `TargetPPI`.
+		 *
+		 * @throw std::invalid_argument
+		 * `fingerImage.ppi` is not `SourcePPI`, or as for resample().
+		 *
+		 * @note
+		 * Specializations exist for 500 to 500 PPI (a copy) and 1000
+		 * to 500 PPI (a 2x2 box filter). Other pairs use the general
+		 * filter.
+		 */
+		template<uint16_t SourcePPI, uint16_t TargetPPI>
+		FingerImage
+		resample(
+		    const FingerImage &fingerImage)
+		{
+			if (fingerImage.ppi != SourcePPI)
+				throw std::invalid_argument("Image is " +
+				    std::to_string(fingerImage.ppi) + " PPI, "
+				    "not " + std::to_string(SourcePPI));
+			return (resample(fingerImage, TargetPPI));
+		}
+
+		/** 500 PPI to 500 PPI. */
+		template<>
+		FingerImage
+		resample<500, 500>(
+		    const FingerImage &fingerImage);
+
+		/** 1000 PPI to 500 PPI. */
+		template<>
+		FingerImage
+		resample<1000, 500>(
+		    const FingerImage &fingerImage);
+
+		/**
+		 * @brief
+		 * Normalize the mean and contrast of each block of an image.
+		 *
+		 * @param fingerImage
+		 * Image to normalize.
+		 * @param blockSize
+		 * Width and height of blocks, in [1, 256].
+		 * @param mean
+		 * Desired mean of each block.
+		 * @param standardDeviation
+		 * Desired standard deviation of each block.
+		 *
+		 * @return
+		 * Copy of `fingerImage` where each pixel p is replaced by
+		 * `mean` + (p - block mean) * min(16, `standardDeviation` /
+		 * block standard deviation), clamped to [0, 255].
+		 *
+		 * @throw std::invalid_argument
+		 * Invalid `blockSize`, or `fingerImage.pixels` does not hold
+		 * `fingerImage.width` * `fingerImage.height` bytes.
+		 */
+		FingerImage
+		normalizeContrast(
+		    const FingerImage &fingerImage,
+		    const uint16_t blockSize = 16,
+		    const uint8_t mean = 128,
+		    const uint8_t standardDeviation = 64);
+
+		/**
+		 * @brief
+		 * Compute the variance of each block of an image.
+		 *
+		 * @param fingerImage
+		 * Image to measure.
+		 * @param blockSize
+		 * Width and height of blocks, in [1, 256].
+		 *
+		 * @return
+		 * Population variance of pixel values in each block.
+		 *
+		 * @throw std::invalid_argument
+		 * Invalid `blockSize`, or `fingerImage.pixels` does not hold
+		 * `fingerImage.width` * `fingerImage.height` bytes.
+		 */
+		BlockMap
+		blockVariance(
+		    const FingerImage &fingerImage,
+		    const uint16_t blockSize = 16);
+
+		/**
+		 * @brief
+		 * Estimate the direction of ridge flow in each block of an
+		 * image.
+		 *
+		 * @param fingerImage
+		 * Image to measure.
+		 * @param blockSize
+		 * Width and height of blocks, in [1, 256].
+		 *
+		 * @return
+		 * A tuple whose first member holds the ridge direction of each
+		 * block, in radians in [0, π), measured clockwise from the
+		 * positive X axis (image rows grow downward). The second member
+		 * holds the coherence of the gradients in each block, in [0,
+		 * 1], where 0 indicates no dominant direction.
+		 *
+		 * @throw std::invalid_argument
+		 * Invalid `blockSize`, or `fingerImage.pixels` does not hold
+		 * `fingerImage.width` * `fingerImage.height` bytes.
+		 *
+		 * @note
+		 * Directions are derived from the structure tensor of 3x3
+		 * Sobel gradients summed over each block.
+		 */
+		std::tuple<BlockMap, BlockMap>
+		orientationField(
+		    const FingerImage &fingerImage,
+		    const uint16_t blockSize = 16);
+
+		/**
+		 * @brief
+		 * Estimate the ridge frequency in each block of an image.
+		 *
+		 * @param fingerImage
+		 * Image to measure, ideally after normalizeContrast().
+		 * @param orientation
+		 * Ridge directions, as returned from orientationField() for
+		 * `fingerImage`.
+		 *
+		 * @return
+		 * Ridges per pixel in each block, or 0 where no plausible
+		 * ridge spacing (3 to 25 pixels at 500 PPI, scaled by
+		 * `fingerImage.ppi`) was found.
+		 *
+		 * @throw std::invalid_argument
+		 * `orientation` does not describe `fingerImage`, or
+		 * `fingerImage.ppi` is 0.
+		 *
+		 * @note
+		 * Follows Hong, Wan, and Jain (1998): gray levels are
+		 * projected onto the ridge normal over a window two blocks
+		 * long and one block wide, and peaks of the projection are
+		 * counted.
+		 */
+		BlockMap
+		ridgeFrequency(
+		    const FingerImage &fingerImage,
+		    const BlockMap &orientation);
+	}
+}
+
+#endif /* PFTIII_KERNELS_H_ */
@@ -8,6 +8,11 @@
  * about its quality, reliability, or any other characteristic.
  */
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
 #include <pftiii.h>
 
 PFTIII::FingerImage::FingerImage()
@@ -36,6 +41,167 @@ PFTIII::FingerImage::FingerImage(
 
 /******************************************************************************/
 
+PFTIII::TemplateBuffer::TemplateBuffer()
+{
+
+}
+
+PFTIII::TemplateBuffer::TemplateBuffer(
+    const std::size_t size)
+{
+	this->allocate(size);
+	std::fill_n(this->storage.get(), size, std::byte{0});
+}
+
+PFTIII::TemplateBuffer::TemplateBuffer(
+    const std::byte *data,
+    const std::size_t size)
+{
+	this->allocate(size);
+	if (size > 0)
+		std::memcpy(this->storage.get(), data, size);
+}
+
+PFTIII::TemplateBuffer::TemplateBuffer(
+    const std::vector<std::byte> &proprietaryTemplate) :
+    TemplateBuffer(proprietaryTemplate.data(), proprietaryTemplate.size())
+{
+
+}
+
+PFTIII::TemplateBuffer::TemplateBuffer(
+    const TemplateBuffer &rhs) :
+    TemplateBuffer(rhs.data(), rhs.size())
+{
+
+}
+
+PFTIII::TemplateBuffer&
+PFTIII::TemplateBuffer::operator=(
+    const TemplateBuffer &rhs)
+{
+	if (this != &rhs)
+		*this = TemplateBuffer(rhs);
+
+	return (*this);
+}
+
+PFTIII::TemplateBuffer::TemplateBuffer(
+    TemplateBuffer &&rhs)
+    noexcept :
+    storage{std::move(rhs.storage)},
+    length{std::exchange(rhs.length, 0)}
+{
+
+}
+
+PFTIII::TemplateBuffer&
+PFTIII::TemplateBuffer::operator=(
+    TemplateBuffer &&rhs)
+    noexcept
+{
+	this->storage = std::move(rhs.storage);
+	this->length = std::exchange(rhs.length, 0);
+
+	return (*this);
+}
+
+std::byte*
+PFTIII::TemplateBuffer::data()
+    noexcept
+{
+	return (this->storage.get());
+}
+
+const std::byte*
+PFTIII::TemplateBuffer::data()
+    const
+    noexcept
+{
+	return (this->storage.get());
+}
+
+std::size_t
+PFTIII::TemplateBuffer::size()
+    const
+    noexcept
+{
+	return (this->length);
+}
+
+std::size_t
+PFTIII::TemplateBuffer::paddedSize()
+    const
+    noexcept
+{
+	return ((this->length + Alignment - 1) / Alignment * Alignment);
+}
+
+bool
+PFTIII::TemplateBuffer::empty()
+    const
+    noexcept
+{
+	return (this->length == 0);
+}
+
+const std::byte*
+PFTIII::TemplateBuffer::begin()
+    const
+    noexcept
+{
+	return (this->storage.get());
+}
+
+const std::byte*
+PFTIII::TemplateBuffer::end()
+    const
+    noexcept
+{
+	return (this->storage.get() + this->length);
+}
+
+std::vector<std::byte>
+PFTIII::TemplateBuffer::toVector()
+    const
+{
+	return (std::vector<std::byte>(this->begin(), this->end()));
+}
+
+PFTIII::TemplateBuffer::~TemplateBuffer()
+{
+
+}
+
+void
+PFTIII::TemplateBuffer::AlignedDelete::operator()(
+    std::byte *p)
+    const
+    noexcept
+{
+	::operator delete[](p, std::align_val_t{Alignment});
+}
+
+void
+PFTIII::TemplateBuffer::allocate(
+    const std::size_t size)
+{
+	this->length = size;
+	if (size == 0) {
+		this->storage.reset();
+		return;
+	}
+
+	const auto padded = this->paddedSize();
+	this->storage.reset(static_cast<std::byte*>(::operator new[](padded,
+	    std::align_val_t{Alignment})));
+	/* Data is written by the caller, but padding is always zeroed */
+	std::fill(this->storage.get() + size, this->storage.get() + padded,
+	    std::byte{0});
+}
+
+/******************************************************************************/
+
 PFTIII::CreateProprietaryTemplateResult
 PFTIII::CreateProprietaryTemplateResult::failure(
     const std::string &message)
@@ -149,6 +315,13 @@ PFTIII::Interface::Interface()
 
 }
 
+bool
+PFTIII::Interface::isReentrant()
+    const
+{
+	return (false);
+}
+
 PFTIII::Interface::~Interface()
 {
 
@@ -0,0 +1,1007 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <libpftiii_kernels.h>
+
+namespace
+{
+	/** Largest supported block size, bounding 32-bit partial sums. */
+	constexpr uint16_t MaxBlockSize{256};
+	/** Fractional bits in contrast gains. */
+	constexpr int GainBits{12};
+	/** Added before shifting out GainBits to round to nearest. */
+	constexpr int32_t GainRound{1 << (GainBits - 1)};
+	/** Largest contrast gain, limiting amplification of flat blocks. */
+	constexpr double MaxGain{16};
+
+	/** Sums of pixel values over one block. */
+	struct PixelSums
+	{
+		uint64_t sum{};
+		uint64_t sumOfSquares{};
+		uint64_t count{};
+	};
+
+	/** Sums of gradient products over one block. */
+	struct GradientSums
+	{
+		int64_t xx{};
+		int64_t yy{};
+		int64_t xy{};
+	};
+
+	/**
+	 * @brief
+	 * Validate an image and divide it into blocks.
+	 *
+	 * @param fingerImage
+	 * Image to divide.
+	 * @param blockSize
+	 * Width and height of blocks.
+	 *
+	 * @return
+	 * BlockMap with no values, describing the blocks of `fingerImage`.
+	 */
+	PFTIII::Kernels::BlockMap
+	makeBlockMap(
+	    const PFTIII::FingerImage &fingerImage,
+	    const uint16_t blockSize)
+	{
+		if ((blockSize == 0) || (blockSize > MaxBlockSize))
+			throw std::invalid_argument("Block size must be in [1, " +
+			    std::to_string(MaxBlockSize) + "], not " +
+			    std::to_string(blockSize));
+		if (fingerImage.pixels.size() != (static_cast<std::size_t>(
+		    fingerImage.width) * fingerImage.height))
+			throw std::invalid_argument("Expected " + std::to_string(
+			    fingerImage.width) + "x" + std::to_string(
+			    fingerImage.height) + " pixels, but received " +
+			    std::to_string(fingerImage.pixels.size()));
+
+		PFTIII::Kernels::BlockMap map{};
+		map.blockSize = blockSize;
+		map.columns = static_cast<uint16_t>((fingerImage.width +
+		    blockSize - 1u) / blockSize);
+		map.rows = static_cast<uint16_t>((fingerImage.height +
+		    blockSize - 1u) / blockSize);
+		return (map);
+	}
+
+	/*
+	 * Sum pixels and their squares over one row of one block. Callers
+	 * pass at most MaxBlockSize pixels, so 32-bit lanes cannot overflow.
+	 */
+
+	void
+	sumPixelsScalar(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    PixelSums &sums)
+	{
+		for (std::size_t x{0}; x < count; ++x) {
+			sums.sum += in[x];
+			sums.sumOfSquares += static_cast<uint64_t>(in[x]) * in[x];
+		}
+		sums.count += count;
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	sumPixelsSSE42(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    PixelSums &sums)
+	{
+		const __m128i ones = _mm_set1_epi16(1);
+		__m128i sum = _mm_setzero_si128();
+		__m128i squares = _mm_setzero_si128();
+
+		std::size_t x{0};
+		for (; x + 8 <= count; x += 8) {
+			const __m128i p = _mm_cvtepu8_epi16(_mm_loadl_epi64(
+			    reinterpret_cast<const __m128i*>(in + x)));
+			sum = _mm_add_epi32(sum, _mm_madd_epi16(p, ones));
+			squares = _mm_add_epi32(squares, _mm_madd_epi16(p, p));
+		}
+
+		alignas(16) std::array<uint32_t, 4> lanes{};
+		_mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()), sum);
+		for (const auto l : lanes)
+			sums.sum += l;
+		_mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()),
+		    squares);
+		for (const auto l : lanes)
+			sums.sumOfSquares += l;
+		sums.count += x;
+
+		sumPixelsScalar(in + x, count - x, sums);
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	sumPixelsAVX2(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    PixelSums &sums)
+	{
+		const __m256i ones = _mm256_set1_epi16(1);
+		__m256i sum = _mm256_setzero_si256();
+		__m256i squares = _mm256_setzero_si256();
+
+		std::size_t x{0};
+		for (; x + 16 <= count; x += 16) {
+			const __m256i p = _mm256_cvtepu8_epi16(_mm_loadu_si128(
+			    reinterpret_cast<const __m128i*>(in + x)));
+			sum = _mm256_add_epi32(sum, _mm256_madd_epi16(p, ones));
+			squares = _mm256_add_epi32(squares,
+			    _mm256_madd_epi16(p, p));
+		}
+
+		alignas(32) std::array<uint32_t, 8> lanes{};
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()),
+		    sum);
+		for (const auto l : lanes)
+			sums.sum += l;
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()),
+		    squares);
+		for (const auto l : lanes)
+			sums.sumOfSquares += l;
+		sums.count += x;
+
+		sumPixelsScalar(in + x, count - x, sums);
+	}
+
+	/*
+	 * Normalize one row of one block: mean + (((p - blockMean) * gain) >>
+	 * GainBits), saturated to [0, 255]. Intermediate values fit in 16
+	 * bits, so packing with saturation clamps exactly as the scalar code.
+	 */
+
+	void
+	normalizeRowScalar(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    const int32_t blockMean,
+	    const int32_t gain,
+	    const int32_t mean,
+	    uint8_t *out)
+	{
+		for (std::size_t x{0}; x < count; ++x)
+			out[x] = static_cast<uint8_t>(std::clamp(mean +
+			    ((((in[x] - blockMean) * gain) + GainRound) >>
+			    GainBits), 0, 255));
+	}
+
+	PFTIII_TARGET_SSE42
+	__m128i
+	normalizeSSE42(
+	    const __m128i p,
+	    const __m128i blockMean,
+	    const __m128i gain,
+	    const __m128i mean)
+	{
+		return (_mm_add_epi32(mean, _mm_srai_epi32(_mm_add_epi32(
+		    _mm_mullo_epi32(_mm_sub_epi32(_mm_cvtepu8_epi32(p),
+		    blockMean), gain), _mm_set1_epi32(GainRound)), GainBits)));
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	normalizeRowSSE42(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    const int32_t blockMean,
+	    const int32_t gain,
+	    const int32_t mean,
+	    uint8_t *out)
+	{
+		const __m128i m = _mm_set1_epi32(blockMean);
+		const __m128i g = _mm_set1_epi32(gain);
+		const __m128i t = _mm_set1_epi32(mean);
+
+		std::size_t x{0};
+		for (; x + 16 <= count; x += 16) {
+			const __m128i p = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i*>(in + x));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm_packus_epi16(
+			    _mm_packs_epi32(normalizeSSE42(p, m, g, t),
+			        normalizeSSE42(_mm_srli_si128(p, 4), m, g, t)),
+			    _mm_packs_epi32(
+			        normalizeSSE42(_mm_srli_si128(p, 8), m, g, t),
+			        normalizeSSE42(_mm_srli_si128(p, 12), m, g, t))));
+		}
+
+		normalizeRowScalar(in + x, count - x, blockMean, gain, mean,
+		    out + x);
+	}
+
+	PFTIII_TARGET_AVX2
+	__m256i
+	normalizeAVX2(
+	    const __m128i p,
+	    const __m256i blockMean,
+	    const __m256i gain,
+	    const __m256i mean)
+	{
+		return (_mm256_add_epi32(mean, _mm256_srai_epi32(_mm256_add_epi32(
+		    _mm256_mullo_epi32(_mm256_sub_epi32(_mm256_cvtepu8_epi32(p),
+		    blockMean), gain), _mm256_set1_epi32(GainRound)), GainBits)));
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	normalizeRowAVX2(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    const int32_t blockMean,
+	    const int32_t gain,
+	    const int32_t mean,
+	    uint8_t *out)
+	{
+		const __m256i m = _mm256_set1_epi32(blockMean);
+		const __m256i g = _mm256_set1_epi32(gain);
+		const __m256i t = _mm256_set1_epi32(mean);
+
+		std::size_t x{0};
+		for (; x + 16 <= count; x += 16) {
+			const __m128i p = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i*>(in + x));
+			/* Packing interleaves 128-bit lanes, so restore order */
+			const __m256i packed = _mm256_permute4x64_epi64(
+			    _mm256_packs_epi32(normalizeAVX2(p, m, g, t),
+			    normalizeAVX2(_mm_srli_si128(p, 8), m, g, t)), 0xD8);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm_packus_epi16(_mm256_castsi256_si128(packed),
+			    _mm256_extracti128_si256(packed, 1)));
+		}
+
+		normalizeRowScalar(in + x, count - x, blockMean, gain, mean,
+		    out + x);
+	}
+
+	/*
+	 * Compute 3x3 Sobel gradients for one row, replicating edge pixels.
+	 * Gradients are within +/- 1020, so fit in 16 bits.
+	 */
+
+	void
+	sobelAt(
+	    const uint8_t *above,
+	    const uint8_t *row,
+	    const uint8_t *below,
+	    const std::size_t width,
+	    const std::size_t x,
+	    int16_t *gx,
+	    int16_t *gy)
+	{
+		const std::size_t l{x == 0 ? 0 : x - 1};
+		const std::size_t r{std::min(x + 1, width - 1)};
+		gx[x] = static_cast<int16_t>((above[r] + (2 * row[r]) +
+		    below[r]) - (above[l] + (2 * row[l]) + below[l]));
+		gy[x] = static_cast<int16_t>((below[l] + (2 * below[x]) +
+		    below[r]) - (above[l] + (2 * above[x]) + above[r]));
+	}
+
+	void
+	sobelRowScalar(
+	    const uint8_t *above,
+	    const uint8_t *row,
+	    const uint8_t *below,
+	    const std::size_t width,
+	    const std::size_t first,
+	    int16_t *gx,
+	    int16_t *gy)
+	{
+		for (std::size_t x{first}; x < width; ++x)
+			sobelAt(above, row, below, width, x, gx, gy);
+	}
+
+	/** Widen consecutive pixels from `p` to 16 bits. */
+	PFTIII_TARGET_SSE42
+	__m128i
+	widenSSE42(
+	    const uint8_t *p)
+	{
+		return (_mm_cvtepu8_epi16(_mm_loadl_epi64(
+		    reinterpret_cast<const __m128i*>(p))));
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	sobelRowSSE42(
+	    const uint8_t *above,
+	    const uint8_t *row,
+	    const uint8_t *below,
+	    const std::size_t width,
+	    int16_t *gx,
+	    int16_t *gy)
+	{
+		sobelAt(above, row, below, width, 0, gx, gy);
+		std::size_t x{1};
+		for (; x + 9 <= width; x += 8) {
+			const __m128i a0{widenSSE42(above + x - 1)};
+			const __m128i a1{widenSSE42(above + x)};
+			const __m128i a2{widenSSE42(above + x + 1)};
+			const __m128i r0{widenSSE42(row + x - 1)};
+			const __m128i r2{widenSSE42(row + x + 1)};
+			const __m128i b0{widenSSE42(below + x - 1)};
+			const __m128i b1{widenSSE42(below + x)};
+			const __m128i b2{widenSSE42(below + x + 1)};
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(gx + x),
+			    _mm_sub_epi16(
+			    _mm_add_epi16(_mm_add_epi16(a2, b2),
+			        _mm_slli_epi16(r2, 1)),
+			    _mm_add_epi16(_mm_add_epi16(a0, b0),
+			        _mm_slli_epi16(r0, 1))));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(gy + x),
+			    _mm_sub_epi16(
+			    _mm_add_epi16(_mm_add_epi16(b0, b2),
+			        _mm_slli_epi16(b1, 1)),
+			    _mm_add_epi16(_mm_add_epi16(a0, a2),
+			        _mm_slli_epi16(a1, 1))));
+		}
+
+		sobelRowScalar(above, row, below, width, x, gx, gy);
+	}
+
+	/** Widen consecutive pixels from `p` to 16 bits. */
+	PFTIII_TARGET_AVX2
+	__m256i
+	widenAVX2(
+	    const uint8_t *p)
+	{
+		return (_mm256_cvtepu8_epi16(_mm_loadu_si128(
+		    reinterpret_cast<const __m128i*>(p))));
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	sobelRowAVX2(
+	    const uint8_t *above,
+	    const uint8_t *row,
+	    const uint8_t *below,
+	    const std::size_t width,
+	    int16_t *gx,
+	    int16_t *gy)
+	{
+		sobelAt(above, row, below, width, 0, gx, gy);
+		std::size_t x{1};
+		for (; x + 17 <= width; x += 16) {
+			const __m256i a0{widenAVX2(above + x - 1)};
+			const __m256i a1{widenAVX2(above + x)};
+			const __m256i a2{widenAVX2(above + x + 1)};
+			const __m256i r0{widenAVX2(row + x - 1)};
+			const __m256i r2{widenAVX2(row + x + 1)};
+			const __m256i b0{widenAVX2(below + x - 1)};
+			const __m256i b1{widenAVX2(below + x)};
+			const __m256i b2{widenAVX2(below + x + 1)};
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(gx + x),
+			    _mm256_sub_epi16(
+			    _mm256_add_epi16(_mm256_add_epi16(a2, b2),
+			        _mm256_slli_epi16(r2, 1)),
+			    _mm256_add_epi16(_mm256_add_epi16(a0, b0),
+			        _mm256_slli_epi16(r0, 1))));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(gy + x),
+			    _mm256_sub_epi16(
+			    _mm256_add_epi16(_mm256_add_epi16(b0, b2),
+			        _mm256_slli_epi16(b1, 1)),
+			    _mm256_add_epi16(_mm256_add_epi16(a0, a2),
+			        _mm256_slli_epi16(a1, 1))));
+		}
+
+		sobelRowScalar(above, row, below, width, x, gx, gy);
+	}
+
+	/*
+	 * Sum gradient products over one row of one block. Each product is
+	 * at most 1020^2, so at most MaxBlockSize of them fit 32-bit lanes.
+	 */
+
+	void
+	sumGradientsScalar(
+	    const int16_t *gx,
+	    const int16_t *gy,
+	    const std::size_t count,
+	    GradientSums &sums)
+	{
+		for (std::size_t x{0}; x < count; ++x) {
+			sums.xx += gx[x] * gx[x];
+			sums.yy += gy[x] * gy[x];
+			sums.xy += gx[x] * gy[x];
+		}
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	sumGradientsSSE42(
+	    const int16_t *gx,
+	    const int16_t *gy,
+	    const std::size_t count,
+	    GradientSums &sums)
+	{
+		__m128i xx = _mm_setzero_si128();
+		__m128i yy = _mm_setzero_si128();
+		__m128i xy = _mm_setzero_si128();
+
+		std::size_t x{0};
+		for (; x + 8 <= count; x += 8) {
+			const __m128i vx = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i*>(gx + x));
+			const __m128i vy = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i*>(gy + x));
+			xx = _mm_add_epi32(xx, _mm_madd_epi16(vx, vx));
+			yy = _mm_add_epi32(yy, _mm_madd_epi16(vy, vy));
+			xy = _mm_add_epi32(xy, _mm_madd_epi16(vx, vy));
+		}
+
+		alignas(16) std::array<int32_t, 12> lanes{};
+		_mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()), xx);
+		_mm_store_si128(reinterpret_cast<__m128i*>(lanes.data() + 4),
+		    yy);
+		_mm_store_si128(reinterpret_cast<__m128i*>(lanes.data() + 8),
+		    xy);
+		for (std::size_t l{0}; l < 4; ++l) {
+			sums.xx += lanes[l];
+			sums.yy += lanes[l + 4];
+			sums.xy += lanes[l + 8];
+		}
+
+		sumGradientsScalar(gx + x, gy + x, count - x, sums);
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	sumGradientsAVX2(
+	    const int16_t *gx,
+	    const int16_t *gy,
+	    const std::size_t count,
+	    GradientSums &sums)
+	{
+		__m256i xx = _mm256_setzero_si256();
+		__m256i yy = _mm256_setzero_si256();
+		__m256i xy = _mm256_setzero_si256();
+
+		std::size_t x{0};
+		for (; x + 16 <= count; x += 16) {
+			const __m256i vx = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i*>(gx + x));
+			const __m256i vy = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i*>(gy + x));
+			xx = _mm256_add_epi32(xx, _mm256_madd_epi16(vx, vx));
+			yy = _mm256_add_epi32(yy, _mm256_madd_epi16(vy, vy));
+			xy = _mm256_add_epi32(xy, _mm256_madd_epi16(vx, vy));
+		}
+
+		alignas(32) std::array<int32_t, 24> lanes{};
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()),
+		    xx);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data() + 8),
+		    yy);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data() + 16),
+		    xy);
+		for (std::size_t l{0}; l < 8; ++l) {
+			sums.xx += lanes[l];
+			sums.yy += lanes[l + 8];
+			sums.xy += lanes[l + 16];
+		}
+
+		sumGradientsScalar(gx + x, gy + x, count - x, sums);
+	}
+
+	/* GCC 12 intrinsics headers trip -Wuninitialized (GCC PR 105593) */
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wuninitialized"
+	#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+	PFTIII_TARGET_AVX512
+	void
+	sumPixelsAVX512(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    PixelSums &sums)
+	{
+		const __m512i ones = _mm512_set1_epi16(1);
+		__m512i sum = _mm512_setzero_si512();
+		__m512i squares = _mm512_setzero_si512();
+
+		std::size_t x{0};
+		for (; x + 32 <= count; x += 32) {
+			const __m512i p = _mm512_cvtepu8_epi16(_mm256_loadu_si256(
+			    reinterpret_cast<const __m256i*>(in + x)));
+			sum = _mm512_add_epi32(sum, _mm512_madd_epi16(p, ones));
+			squares = _mm512_add_epi32(squares,
+			    _mm512_madd_epi16(p, p));
+		}
+		sums.sum += static_cast<uint32_t>(_mm512_reduce_add_epi32(sum));
+		sums.sumOfSquares += static_cast<uint32_t>(
+		    _mm512_reduce_add_epi32(squares));
+		sums.count += x;
+
+		sumPixelsScalar(in + x, count - x, sums);
+	}
+
+	PFTIII_TARGET_AVX512
+	void
+	normalizeRowAVX512(
+	    const uint8_t *in,
+	    const std::size_t count,
+	    const int32_t blockMean,
+	    const int32_t gain,
+	    const int32_t mean,
+	    uint8_t *out)
+	{
+		const __m512i vBlockMean = _mm512_set1_epi32(blockMean);
+		const __m512i vGain = _mm512_set1_epi32(gain);
+		const __m512i vRound = _mm512_set1_epi32(GainRound);
+		const __m512i vMean = _mm512_set1_epi32(mean);
+		const __m512i zero = _mm512_setzero_si512();
+
+		std::size_t x{0};
+		for (; x + 16 <= count; x += 16) {
+			const __m512i v = _mm512_add_epi32(vMean,
+			    _mm512_srai_epi32(_mm512_add_epi32(_mm512_mullo_epi32(
+			    _mm512_sub_epi32(_mm512_cvtepu8_epi32(_mm_loadu_si128(
+			    reinterpret_cast<const __m128i*>(in + x))),
+			    vBlockMean), vGain), vRound), GainBits));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm512_cvtusepi32_epi8(_mm512_max_epi32(zero, v)));
+		}
+
+		normalizeRowScalar(in + x, count - x, blockMean, gain, mean,
+		    out + x);
+	}
+
+	/** Widen consecutive pixels from `p` to 16 bits. */
+	PFTIII_TARGET_AVX512
+	__m512i
+	widenAVX512(
+	    const uint8_t *p)
+	{
+		return (_mm512_cvtepu8_epi16(_mm256_loadu_si256(
+		    reinterpret_cast<const __m256i*>(p))));
+	}
+
+	PFTIII_TARGET_AVX512
+	void
+	sobelRowAVX512(
+	    const uint8_t *above,
+	    const uint8_t *row,
+	    const uint8_t *below,
+	    const std::size_t width,
+	    int16_t *gx,
+	    int16_t *gy)
+	{
+		sobelAt(above, row, below, width, 0, gx, gy);
+		std::size_t x{1};
+		for (; x + 33 <= width; x += 32) {
+			const __m512i a0{widenAVX512(above + x - 1)};
+			const __m512i a1{widenAVX512(above + x)};
+			const __m512i a2{widenAVX512(above + x + 1)};
+			const __m512i r0{widenAVX512(row + x - 1)};
+			const __m512i r2{widenAVX512(row + x + 1)};
+			const __m512i b0{widenAVX512(below + x - 1)};
+			const __m512i b1{widenAVX512(below + x)};
+			const __m512i b2{widenAVX512(below + x + 1)};
+			_mm512_storeu_si512(gx + x, _mm512_sub_epi16(
+			    _mm512_add_epi16(_mm512_add_epi16(a2, b2),
+			        _mm512_slli_epi16(r2, 1)),
+			    _mm512_add_epi16(_mm512_add_epi16(a0, b0),
+			        _mm512_slli_epi16(r0, 1))));
+			_mm512_storeu_si512(gy + x, _mm512_sub_epi16(
+			    _mm512_add_epi16(_mm512_add_epi16(b0, b2),
+			        _mm512_slli_epi16(b1, 1)),
+			    _mm512_add_epi16(_mm512_add_epi16(a0, a2),
+			        _mm512_slli_epi16(a1, 1))));
+		}
+
+		sobelRowScalar(above, row, below, width, x, gx, gy);
+	}
+
+	PFTIII_TARGET_AVX512
+	void
+	sumGradientsAVX512(
+	    const int16_t *gx,
+	    const int16_t *gy,
+	    const std::size_t count,
+	    GradientSums &sums)
+	{
+		__m512i xx = _mm512_setzero_si512();
+		__m512i yy = _mm512_setzero_si512();
+		__m512i xy = _mm512_setzero_si512();
+
+		std::size_t x{0};
+		for (; x + 32 <= count; x += 32) {
+			const __m512i vx = _mm512_loadu_si512(gx + x);
+			const __m512i vy = _mm512_loadu_si512(gy + x);
+			xx = _mm512_add_epi32(xx, _mm512_madd_epi16(vx, vx));
+			yy = _mm512_add_epi32(yy, _mm512_madd_epi16(vy, vy));
+			xy = _mm512_add_epi32(xy, _mm512_madd_epi16(vx, vy));
+		}
+		sums.xx += _mm512_reduce_add_epi32(xx);
+		sums.yy += _mm512_reduce_add_epi32(yy);
+		sums.xy += _mm512_reduce_add_epi32(xy);
+
+		sumGradientsScalar(gx + x, gy + x, count - x, sums);
+	}
+
+	#pragma GCC diagnostic pop
+
+	/**
+	 * @brief
+	 * Sum pixel values over each block of an image.
+	 *
+	 * @param fingerImage
+	 * Validated image.
+	 * @param map
+	 * Blocks of `fingerImage`.
+	 *
+	 * @return
+	 * Sums for each block, laid out as BlockMap::values.
+	 */
+	std::vector<PixelSums>
+	sumBlocks(
+	    const PFTIII::FingerImage &fingerImage,
+	    const PFTIII::Kernels::BlockMap &map)
+	{
+		const auto *in = reinterpret_cast<const uint8_t*>(
+		    fingerImage.pixels.data());
+		const std::size_t width{fingerImage.width};
+		const std::size_t blockSize{map.blockSize};
+
+		std::vector<PixelSums> sums(static_cast<std::size_t>(
+		    map.columns) * map.rows);
+		const auto isa = PFTIII::Kernels::Impl::active();
+		for (std::size_t y{0}; y < fingerImage.height; ++y) {
+			PixelSums *blockRow = sums.data() + ((y / blockSize) *
+			    map.columns);
+			for (std::size_t c{0}; c < map.columns; ++c) {
+				const uint8_t *p = in + (y * width) +
+				    (c * blockSize);
+				const std::size_t count{std::min(blockSize,
+				    width - (c * blockSize))};
+				switch (isa) {
+				case PFTIII::Kernels::InstructionSet::AVX512:
+					sumPixelsAVX512(p, count, blockRow[c]);
+					break;
+				case PFTIII::Kernels::InstructionSet::AVX2:
+					sumPixelsAVX2(p, count, blockRow[c]);
+					break;
+				case PFTIII::Kernels::InstructionSet::SSE42:
+					sumPixelsSSE42(p, count, blockRow[c]);
+					break;
+				case PFTIII::Kernels::InstructionSet::Scalar:
+					sumPixelsScalar(p, count, blockRow[c]);
+					break;
+				}
+			}
+		}
+
+		return (sums);
+	}
+
+	/**
+	 * @param sums
+	 * Sums over one block.
+	 *
+	 * @return
+	 * Population variance of the block.
+	 */
+	double
+	variance(
+	    const PixelSums &sums)
+	{
+		if (sums.count == 0)
+			return (0);
+
+		/* Exact in integers: n * sum(p^2) - sum(p)^2 */
+		const uint64_t numerator{(sums.count * sums.sumOfSquares) -
+		    (sums.sum * sums.sum)};
+		return (static_cast<double>(numerator) / static_cast<double>(
+		    sums.count * sums.count));
+	}
+
+	/**
+	 * @brief
+	 * Measure the distance between ridges around a point.
+	 *
+	 * @param fingerImage
+	 * Validated image.
+	 * @param centerX
+	 * X coordinate of the center of the window.
+	 * @param centerY
+	 * Y coordinate of the center of the window.
+	 * @param theta
+	 * Ridge direction at the center, in radians.
+	 * @param signature
+	 * Scratch space whose size is the length of the window across
+	 * ridges. The window is half as wide along ridges.
+	 *
+	 * @return
+	 * Mean distance between consecutive peaks of gray levels projected
+	 * across the ridges, or 0 if there are fewer than two peaks.
+	 */
+	double
+	ridgePeriod(
+	    const PFTIII::FingerImage &fingerImage,
+	    const std::size_t centerX,
+	    const std::size_t centerY,
+	    const double theta,
+	    std::vector<uint32_t> &signature)
+	{
+		const auto *in = reinterpret_cast<const uint8_t*>(
+		    fingerImage.pixels.data());
+		const long maxX{fingerImage.width - 1L};
+		const long maxY{fingerImage.height - 1L};
+		const double alongX{std::cos(theta)};
+		const double alongY{std::sin(theta)};
+		const auto length = static_cast<double>(signature.size());
+		const double breadth{length / 2};
+
+		/* Sum the window along ridges, sampling nearest neighbors */
+		for (std::size_t k{0}; k < signature.size(); ++k) {
+			const double across{static_cast<double>(k) + 0.5 -
+			    (length / 2)};
+			signature[k] = 0;
+			for (double along{0.5 - (breadth / 2)}; along <
+			    (breadth / 2); ++along) {
+				const long u{std::clamp(std::lround(
+				    static_cast<double>(centerX) +
+				    (along * alongX) + (across * alongY)),
+				    0L, maxX)};
+				const long v{std::clamp(std::lround(
+				    static_cast<double>(centerY) +
+				    (along * alongY) - (across * alongX)),
+				    0L, maxY)};
+				signature[k] += in[(v * fingerImage.width) + u];
+			}
+		}
+
+		std::size_t peaks{0}, first{0}, last{0};
+		for (std::size_t k{1}; k + 1 < signature.size(); ++k) {
+			if ((signature[k] > signature[k - 1]) &&
+			    (signature[k] >= signature[k + 1])) {
+				if (peaks++ == 0)
+					first = k;
+				last = k;
+			}
+		}
+		if (peaks < 2)
+			return (0);
+
+		return (static_cast<double>(last - first) /
+		    static_cast<double>(peaks - 1));
+	}
+}
+
+PFTIII::FingerImage
+PFTIII::Kernels::normalizeContrast(
+    const FingerImage &fingerImage,
+    const uint16_t blockSize,
+    const uint8_t mean,
+    const uint8_t standardDeviation)
+{
+	const auto map = makeBlockMap(fingerImage, blockSize);
+	const auto sums = sumBlocks(fingerImage, map);
+
+	/* Fixed point mean and gain per block, shared by every variant */
+	std::vector<std::tuple<int32_t, int32_t>> params(sums.size());
+	for (std::size_t b{0}; b < sums.size(); ++b) {
+		if (sums[b].count == 0)
+			continue;
+		const auto blockMean = static_cast<int32_t>((sums[b].sum +
+		    (sums[b].count / 2)) / sums[b].count);
+		const double gain{std::min(MaxGain, standardDeviation /
+		    std::max(1.0, std::sqrt(variance(sums[b]))))};
+		params[b] = {blockMean, static_cast<int32_t>(std::lround(
+		    gain * (1 << GainBits)))};
+	}
+
+	FingerImage normalized{fingerImage};
+	const auto *in = reinterpret_cast<const uint8_t*>(
+	    fingerImage.pixels.data());
+	auto *out = reinterpret_cast<uint8_t*>(normalized.pixels.data());
+	const std::size_t width{fingerImage.width};
+	const auto isa = Impl::active();
+	for (std::size_t y{0}; y < fingerImage.height; ++y) {
+		const std::size_t blockRow{(y / blockSize) * map.columns};
+		for (std::size_t c{0}; c < map.columns; ++c) {
+			const std::size_t offset{(y * width) + (c * blockSize)};
+			const std::size_t count{std::min<std::size_t>(blockSize,
+			    width - (c * blockSize))};
+			const auto [blockMean, gain] = params[blockRow + c];
+			switch (isa) {
+			case InstructionSet::AVX512:
+				normalizeRowAVX512(in + offset, count,
+				    blockMean, gain, mean, out + offset);
+				break;
+			case InstructionSet::AVX2:
+				normalizeRowAVX2(in + offset, count, blockMean,
+				    gain, mean, out + offset);
+				break;
+			case InstructionSet::SSE42:
+				normalizeRowSSE42(in + offset, count, blockMean,
+				    gain, mean, out + offset);
+				break;
+			case InstructionSet::Scalar:
+				normalizeRowScalar(in + offset, count,
+				    blockMean, gain, mean, out + offset);
+				break;
+			}
+		}
+	}
+
+	return (normalized);
+}
+
+PFTIII::Kernels::BlockMap
+PFTIII::Kernels::blockVariance(
+    const FingerImage &fingerImage,
+    const uint16_t blockSize)
+{
+	auto map = makeBlockMap(fingerImage, blockSize);
+	const auto sums = sumBlocks(fingerImage, map);
+
+	map.values.resize(sums.size());
+	std::transform(sums.cbegin(), sums.cend(), map.values.begin(),
+	    [](const PixelSums &s) {
+		return (static_cast<float>(variance(s)));
+	});
+
+	return (map);
+}
+
+std::tuple<PFTIII::Kernels::BlockMap, PFTIII::Kernels::BlockMap>
+PFTIII::Kernels::orientationField(
+    const FingerImage &fingerImage,
+    const uint16_t blockSize)
+{
+	auto orientation = makeBlockMap(fingerImage, blockSize);
+	auto coherence = orientation;
+	const std::size_t blocks{static_cast<std::size_t>(orientation.columns) *
+	    orientation.rows};
+	orientation.values.resize(blocks);
+	coherence.values.resize(blocks);
+	if (blocks == 0)
+		return {orientation, coherence};
+
+	/*
+	 * Stream one image row at a time through gradient buffers, so the
+	 * working set is three image rows and two gradient rows.
+	 */
+	const auto *in = reinterpret_cast<const uint8_t*>(
+	    fingerImage.pixels.data());
+	const std::size_t width{fingerImage.width};
+	const std::size_t height{fingerImage.height};
+	std::vector<int16_t> gx(width), gy(width);
+	std::vector<GradientSums> sums(blocks);
+	const auto isa = Impl::active();
+	for (std::size_t y{0}; y < height; ++y) {
+		const uint8_t *above = in + ((y == 0 ? 0 : y - 1) * width);
+		const uint8_t *row = in + (y * width);
+		const uint8_t *below = in + (std::min(y + 1, height - 1) *
+		    width);
+		switch (isa) {
+		case InstructionSet::AVX512:
+			sobelRowAVX512(above, row, below, width, gx.data(),
+			    gy.data());
+			break;
+		case InstructionSet::AVX2:
+			sobelRowAVX2(above, row, below, width, gx.data(),
+			    gy.data());
+			break;
+		case InstructionSet::SSE42:
+			sobelRowSSE42(above, row, below, width, gx.data(),
+			    gy.data());
+			break;
+		case InstructionSet::Scalar:
+			sobelRowScalar(above, row, below, width, 0, gx.data(),
+			    gy.data());
+			break;
+		}
+
+		GradientSums *blockRow = sums.data() + ((y / blockSize) *
+		    orientation.columns);
+		for (std::size_t c{0}; c < orientation.columns; ++c) {
+			const std::size_t x{c * blockSize};
+			const std::size_t count{std::min<std::size_t>(blockSize,
+			    width - x)};
+			switch (isa) {
+			case InstructionSet::AVX512:
+				sumGradientsAVX512(gx.data() + x, gy.data() + x,
+				    count, blockRow[c]);
+				break;
+			case InstructionSet::AVX2:
+				sumGradientsAVX2(gx.data() + x, gy.data() + x,
+				    count, blockRow[c]);
+				break;
+			case InstructionSet::SSE42:
+				sumGradientsSSE42(gx.data() + x, gy.data() + x,
+				    count, blockRow[c]);
+				break;
+			case InstructionSet::Scalar:
+				sumGradientsScalar(gx.data() + x, gy.data() + x,
+				    count, blockRow[c]);
+				break;
+			}
+		}
+	}
+
+	for (std::size_t b{0}; b < blocks; ++b) {
+		const auto xx = static_cast<double>(sums[b].xx);
+		const auto yy = static_cast<double>(sums[b].yy);
+		const auto xy = static_cast<double>(sums[b].xy);
+
+		/* Ridges run perpendicular to the dominant gradient */
+		double theta{(0.5 * std::atan2(2 * xy, xx - yy)) +
+		    (std::numbers::pi / 2)};
+		if (theta >= std::numbers::pi)
+			theta -= std::numbers::pi;
+		orientation.values[b] = static_cast<float>(theta);
+
+		const double energy{xx + yy};
+		coherence.values[b] = energy == 0 ? 0.0f : static_cast<float>(
+		    std::sqrt(((xx - yy) * (xx - yy)) + (4 * xy * xy)) /
+		    energy);
+	}
+
+	return {orientation, coherence};
+}
+
+PFTIII::Kernels::BlockMap
+PFTIII::Kernels::ridgeFrequency(
+    const FingerImage &fingerImage,
+    const BlockMap &orientation)
+{
+	auto frequency = makeBlockMap(fingerImage, orientation.blockSize);
+	if ((frequency.columns != orientation.columns) ||
+	    (frequency.rows != orientation.rows) ||
+	    (orientation.values.size() != (static_cast<std::size_t>(
+	    orientation.columns) * orientation.rows)))
+		throw std::invalid_argument("Orientation field does not "
+		    "describe a " + std::to_string(fingerImage.width) + "x" +
+		    std::to_string(fingerImage.height) + " image");
+	if (fingerImage.ppi == 0)
+		throw std::invalid_argument("Resolution cannot be 0");
+	frequency.values.resize(orientation.values.size());
+
+	const double scale{fingerImage.ppi / 500.0};
+	const double minPeriod{3 * scale};
+	const double maxPeriod{25 * scale};
+	const std::size_t blockSize{orientation.blockSize};
+	std::vector<uint32_t> signature(2 * blockSize);
+	for (std::size_t r{0}; r < orientation.rows; ++r) {
+		for (std::size_t c{0}; c < orientation.columns; ++c) {
+			const std::size_t b{(r * orientation.columns) + c};
+			const double period{ridgePeriod(fingerImage,
+			    std::min<std::size_t>((c * blockSize) +
+			        (blockSize / 2), fingerImage.width - 1u),
+			    std::min<std::size_t>((r * blockSize) +
+			        (blockSize / 2), fingerImage.height - 1u),
+			    orientation.values[b], signature)};
+			if ((period >= minPeriod) && (period <= maxPeriod))
+				frequency.values[b] = static_cast<float>(
+				    1 / period);
+		}
+	}
+
+	return (frequency);
+}
@@ -0,0 +1,704 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+
+#include <libpftiii_kernels.h>
+
+namespace
+{
+	/** Instruction set extension currently dispatched to. */
+	std::atomic<PFTIII::Kernels::InstructionSet> activeSet{
+	    PFTIII::Kernels::getSupportedInstructionSet()};
+
+	/** 2π, as used to wrap angle differences. */
+	constexpr float TwoPi{2 * std::numbers::pi_v<float>};
+
+	/*
+	 * Scalar.
+	 */
+
+	uint64_t
+	popcountScalar(
+	    const std::byte *a,
+	    const std::byte *b,
+	    const std::size_t size)
+	{
+		uint64_t count{0};
+		std::size_t i{0};
+		for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+			uint64_t x{}, y{};
+			std::memcpy(&x, a + i, sizeof(x));
+			if (b != nullptr)
+				std::memcpy(&y, b + i, sizeof(y));
+			count += static_cast<uint64_t>(std::popcount(x ^ y));
+		}
+		for (; i < size; ++i)
+			count += static_cast<uint64_t>(std::popcount(
+			    std::to_integer<uint8_t>(b == nullptr ? a[i] :
+			    a[i] ^ b[i])));
+
+		return (count);
+	}
+
+	float
+	distanceScalar(
+	    const float px,
+	    const float py,
+	    const float rx,
+	    const float ry)
+	{
+		const float dx{px - rx};
+		const float dy{py - ry};
+		return (std::sqrt((dx * dx) + (dy * dy)));
+	}
+
+	float
+	angleDifferenceScalar(
+	    const float p,
+	    const float r)
+	{
+		const float d{std::fabs(p - r)};
+		return (std::min(d, TwoPi - d));
+	}
+
+	void
+	pairwiseDistancesScalar(
+	    const float *px,
+	    const float *py,
+	    const std::size_t np,
+	    const float *rx,
+	    const float *ry,
+	    const std::size_t nr,
+	    float *out)
+	{
+		for (std::size_t p{0}; p < np; ++p)
+			for (std::size_t r{0}; r < nr; ++r)
+				out[(p * nr) + r] = distanceScalar(px[p], py[p],
+				    rx[r], ry[r]);
+	}
+
+	void
+	pairwiseAngleDifferencesScalar(
+	    const float *pt,
+	    const std::size_t np,
+	    const float *rt,
+	    const std::size_t nr,
+	    float *out)
+	{
+		for (std::size_t p{0}; p < np; ++p)
+			for (std::size_t r{0}; r < nr; ++r)
+				out[(p * nr) + r] = angleDifferenceScalar(pt[p],
+				    rt[r]);
+	}
+
+	std::size_t
+	nextAboveScalar(
+	    const float *scores,
+	    std::size_t begin,
+	    const std::size_t end,
+	    const float threshold)
+	{
+		for (; begin < end; ++begin)
+			if (scores[begin] > threshold)
+				break;
+		return (begin);
+	}
+
+	/*
+	 * SSE 4.2.
+	 */
+
+	PFTIII_TARGET_SSE42
+	uint64_t
+	popcountSSE42(
+	    const std::byte *a,
+	    const std::byte *b,
+	    const std::size_t size)
+	{
+		uint64_t count{0};
+		std::size_t i{0};
+		for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+			uint64_t x{}, y{};
+			std::memcpy(&x, a + i, sizeof(x));
+			if (b != nullptr)
+				std::memcpy(&y, b + i, sizeof(y));
+			count += static_cast<uint64_t>(_mm_popcnt_u64(x ^ y));
+		}
+
+		return (count + popcountScalar(a + i,
+		    b == nullptr ? nullptr : b + i, size - i));
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	pairwiseDistancesSSE42(
+	    const float *px,
+	    const float *py,
+	    const std::size_t np,
+	    const float *rx,
+	    const float *ry,
+	    const std::size_t nr,
+	    float *out)
+	{
+		for (std::size_t p{0}; p < np; ++p) {
+			const __m128 bx = _mm_set1_ps(px[p]);
+			const __m128 by = _mm_set1_ps(py[p]);
+			float *row = out + (p * nr);
+
+			std::size_t r{0};
+			for (; r + 4 <= nr; r += 4) {
+				const __m128 dx = _mm_sub_ps(bx,
+				    _mm_loadu_ps(rx + r));
+				const __m128 dy = _mm_sub_ps(by,
+				    _mm_loadu_ps(ry + r));
+				_mm_storeu_ps(row + r, _mm_sqrt_ps(_mm_add_ps(
+				    _mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+			}
+			for (; r < nr; ++r)
+				row[r] = distanceScalar(px[p], py[p], rx[r],
+				    ry[r]);
+		}
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	pairwiseAngleDifferencesSSE42(
+	    const float *pt,
+	    const std::size_t np,
+	    const float *rt,
+	    const std::size_t nr,
+	    float *out)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 twoPi = _mm_set1_ps(TwoPi);
+		for (std::size_t p{0}; p < np; ++p) {
+			const __m128 bt = _mm_set1_ps(pt[p]);
+			float *row = out + (p * nr);
+
+			std::size_t r{0};
+			for (; r + 4 <= nr; r += 4) {
+				const __m128 d = _mm_andnot_ps(signMask,
+				    _mm_sub_ps(bt, _mm_loadu_ps(rt + r)));
+				_mm_storeu_ps(row + r, _mm_min_ps(
+				    _mm_sub_ps(twoPi, d), d));
+			}
+			for (; r < nr; ++r)
+				row[r] = angleDifferenceScalar(pt[p], rt[r]);
+		}
+	}
+
+	PFTIII_TARGET_SSE42
+	std::size_t
+	nextAboveSSE42(
+	    const float *scores,
+	    std::size_t begin,
+	    const std::size_t end,
+	    const float threshold)
+	{
+		const __m128 t = _mm_set1_ps(threshold);
+		for (; begin + 4 <= end; begin += 4) {
+			const int mask = _mm_movemask_ps(_mm_cmpgt_ps(
+			    _mm_loadu_ps(scores + begin), t));
+			if (mask != 0)
+				return (begin + static_cast<std::size_t>(
+				    std::countr_zero(static_cast<unsigned>(
+				    mask))));
+		}
+
+		return (nextAboveScalar(scores, begin, end, threshold));
+	}
+
+	/*
+	 * AVX2.
+	 */
+
+	PFTIII_TARGET_AVX2
+	uint64_t
+	popcountAVX2(
+	    const std::byte *a,
+	    const std::byte *b,
+	    const std::size_t size)
+	{
+		/* Nibble lookup (Mula, Kurz, and Lemire) */
+		const __m256i lookup = _mm256_setr_epi8(
+		    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m256i lowMask = _mm256_set1_epi8(0x0F);
+		__m256i sums = _mm256_setzero_si256();
+
+		std::size_t i{0};
+		for (; i + 32 <= size; i += 32) {
+			__m256i v = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i*>(a + i));
+			if (b != nullptr)
+				v = _mm256_xor_si256(v, _mm256_loadu_si256(
+				    reinterpret_cast<const __m256i*>(b + i)));
+			const __m256i counts = _mm256_add_epi8(
+			    _mm256_shuffle_epi8(lookup,
+			        _mm256_and_si256(v, lowMask)),
+			    _mm256_shuffle_epi8(lookup, _mm256_and_si256(
+			        _mm256_srli_epi16(v, 4), lowMask)));
+			sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts,
+			    _mm256_setzero_si256()));
+		}
+
+		const uint64_t count{
+		    static_cast<uint64_t>(_mm256_extract_epi64(sums, 0)) +
+		    static_cast<uint64_t>(_mm256_extract_epi64(sums, 1)) +
+		    static_cast<uint64_t>(_mm256_extract_epi64(sums, 2)) +
+		    static_cast<uint64_t>(_mm256_extract_epi64(sums, 3))};
+
+		return (count + popcountSSE42(a + i,
+		    b == nullptr ? nullptr : b + i, size - i));
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	pairwiseDistancesAVX2(
+	    const float *px,
+	    const float *py,
+	    const std::size_t np,
+	    const float *rx,
+	    const float *ry,
+	    const std::size_t nr,
+	    float *out)
+	{
+		for (std::size_t p{0}; p < np; ++p) {
+			const __m256 bx = _mm256_set1_ps(px[p]);
+			const __m256 by = _mm256_set1_ps(py[p]);
+			float *row = out + (p * nr);
+
+			std::size_t r{0};
+			for (; r + 8 <= nr; r += 8) {
+				const __m256 dx = _mm256_sub_ps(bx,
+				    _mm256_loadu_ps(rx + r));
+				const __m256 dy = _mm256_sub_ps(by,
+				    _mm256_loadu_ps(ry + r));
+				_mm256_storeu_ps(row + r, _mm256_sqrt_ps(
+				    _mm256_add_ps(_mm256_mul_ps(dx, dx),
+				    _mm256_mul_ps(dy, dy))));
+			}
+			for (; r < nr; ++r)
+				row[r] = distanceScalar(px[p], py[p], rx[r],
+				    ry[r]);
+		}
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	pairwiseAngleDifferencesAVX2(
+	    const float *pt,
+	    const std::size_t np,
+	    const float *rt,
+	    const std::size_t nr,
+	    float *out)
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 twoPi = _mm256_set1_ps(TwoPi);
+		for (std::size_t p{0}; p < np; ++p) {
+			const __m256 bt = _mm256_set1_ps(pt[p]);
+			float *row = out + (p * nr);
+
+			std::size_t r{0};
+			for (; r + 8 <= nr; r += 8) {
+				const __m256 d = _mm256_andnot_ps(signMask,
+				    _mm256_sub_ps(bt, _mm256_loadu_ps(rt + r)));
+				_mm256_storeu_ps(row + r, _mm256_min_ps(
+				    _mm256_sub_ps(twoPi, d), d));
+			}
+			for (; r < nr; ++r)
+				row[r] = angleDifferenceScalar(pt[p], rt[r]);
+		}
+	}
+
+	PFTIII_TARGET_AVX2
+	std::size_t
+	nextAboveAVX2(
+	    const float *scores,
+	    std::size_t begin,
+	    const std::size_t end,
+	    const float threshold)
+	{
+		const __m256 t = _mm256_set1_ps(threshold);
+		for (; begin + 8 <= end; begin += 8) {
+			const int mask = _mm256_movemask_ps(_mm256_cmp_ps(
+			    _mm256_loadu_ps(scores + begin), t, _CMP_GT_OQ));
+			if (mask != 0)
+				return (begin + static_cast<std::size_t>(
+				    std::countr_zero(static_cast<unsigned>(
+				    mask))));
+		}
+
+		return (nextAboveScalar(scores, begin, end, threshold));
+	}
+
+	/*
+	 * AVX-512.
+	 */
+
+	/* GCC 12 intrinsics headers trip -Wuninitialized (GCC PR 105593) */
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wuninitialized"
+	#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+	PFTIII_TARGET_AVX512
+	uint64_t
+	popcountAVX512(
+	    const std::byte *a,
+	    const std::byte *b,
+	    const std::size_t size)
+	{
+		/* Nibble lookup, as in the AVX2 variant */
+		const __m512i lookup = _mm512_broadcast_i32x4(_mm_setr_epi8(
+		    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+		const __m512i lowMask = _mm512_set1_epi8(0x0F);
+		__m512i sums = _mm512_setzero_si512();
+
+		std::size_t i{0};
+		for (; i + 64 <= size; i += 64) {
+			__m512i v = _mm512_loadu_si512(a + i);
+			if (b != nullptr)
+				v = _mm512_xor_si512(v,
+				    _mm512_loadu_si512(b + i));
+			const __m512i counts = _mm512_add_epi8(
+			    _mm512_shuffle_epi8(lookup,
+			        _mm512_and_si512(v, lowMask)),
+			    _mm512_shuffle_epi8(lookup, _mm512_and_si512(
+			        _mm512_srli_epi16(v, 4), lowMask)));
+			sums = _mm512_add_epi64(sums, _mm512_sad_epu8(counts,
+			    _mm512_setzero_si512()));
+		}
+
+		return (static_cast<uint64_t>(_mm512_reduce_add_epi64(sums)) +
+		    popcountAVX2(a + i, b == nullptr ? nullptr : b + i,
+		    size - i));
+	}
+
+	PFTIII_TARGET_AVX512
+	void
+	pairwiseDistancesAVX512(
+	    const float *px,
+	    const float *py,
+	    const std::size_t np,
+	    const float *rx,
+	    const float *ry,
+	    const std::size_t nr,
+	    float *out)
+	{
+		for (std::size_t p{0}; p < np; ++p) {
+			const __m512 bx = _mm512_set1_ps(px[p]);
+			const __m512 by = _mm512_set1_ps(py[p]);
+			float *row = out + (p * nr);
+
+			std::size_t r{0};
+			for (; r + 16 <= nr; r += 16) {
+				const __m512 dx = _mm512_sub_ps(bx,
+				    _mm512_loadu_ps(rx + r));
+				const __m512 dy = _mm512_sub_ps(by,
+				    _mm512_loadu_ps(ry + r));
+				_mm512_storeu_ps(row + r, _mm512_sqrt_ps(
+				    _mm512_add_ps(_mm512_mul_ps(dx, dx),
+				    _mm512_mul_ps(dy, dy))));
+			}
+			for (; r < nr; ++r)
+				row[r] = distanceScalar(px[p], py[p], rx[r],
+				    ry[r]);
+		}
+	}
+
+	PFTIII_TARGET_AVX512
+	void
+	pairwiseAngleDifferencesAVX512(
+	    const float *pt,
+	    const std::size_t np,
+	    const float *rt,
+	    const std::size_t nr,
+	    float *out)
+	{
+		const __m512 twoPi = _mm512_set1_ps(TwoPi);
+		for (std::size_t p{0}; p < np; ++p) {
+			const __m512 bt = _mm512_set1_ps(pt[p]);
+			float *row = out + (p * nr);
+
+			std::size_t r{0};
+			for (; r + 16 <= nr; r += 16) {
+				const __m512 d = _mm512_abs_ps(_mm512_sub_ps(bt,
+				    _mm512_loadu_ps(rt + r)));
+				_mm512_storeu_ps(row + r, _mm512_min_ps(
+				    _mm512_sub_ps(twoPi, d), d));
+			}
+			for (; r < nr; ++r)
+				row[r] = angleDifferenceScalar(pt[p], rt[r]);
+		}
+	}
+
+	PFTIII_TARGET_AVX512
+	std::size_t
+	nextAboveAVX512(
+	    const float *scores,
+	    std::size_t begin,
+	    const std::size_t end,
+	    const float threshold)
+	{
+		const __m512 t = _mm512_set1_ps(threshold);
+		for (; begin + 16 <= end; begin += 16) {
+			const __mmask16 mask = _mm512_cmp_ps_mask(
+			    _mm512_loadu_ps(scores + begin), t, _CMP_GT_OQ);
+			if (mask != 0)
+				return (begin + static_cast<std::size_t>(
+				    std::countr_zero(static_cast<unsigned>(
+				    mask))));
+		}
+
+		return (nextAboveScalar(scores, begin, end, threshold));
+	}
+
+	#pragma GCC diagnostic pop
+
+	/*
+	 * Dispatch.
+	 */
+
+	uint64_t
+	popcountDispatch(
+	    const std::byte *a,
+	    const std::byte *b,
+	    const std::size_t size)
+	{
+		switch (PFTIII::Kernels::Impl::active()) {
+		case PFTIII::Kernels::InstructionSet::AVX512:
+			return (popcountAVX512(a, b, size));
+		case PFTIII::Kernels::InstructionSet::AVX2:
+			return (popcountAVX2(a, b, size));
+		case PFTIII::Kernels::InstructionSet::SSE42:
+			return (popcountSSE42(a, b, size));
+		case PFTIII::Kernels::InstructionSet::Scalar:
+			break;
+		}
+
+		return (popcountScalar(a, b, size));
+	}
+}
+
+PFTIII::Kernels::InstructionSet
+PFTIII::Kernels::Impl::active()
+{
+	return (activeSet.load(std::memory_order_relaxed));
+}
+
+PFTIII::Kernels::InstructionSet
+PFTIII::Kernels::getSupportedInstructionSet()
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f") &&
+	    __builtin_cpu_supports("avx512bw") &&
+	    __builtin_cpu_supports("avx2") &&
+	    __builtin_cpu_supports("popcnt"))
+		return (InstructionSet::AVX512);
+	if (__builtin_cpu_supports("avx2") &&
+	    __builtin_cpu_supports("popcnt"))
+		return (InstructionSet::AVX2);
+	if (__builtin_cpu_supports("sse4.2") &&
+	    __builtin_cpu_supports("popcnt"))
+		return (InstructionSet::SSE42);
+
+	return (InstructionSet::Scalar);
+}
+
+PFTIII::Kernels::InstructionSet
+PFTIII::Kernels::getInstructionSet()
+{
+	return (Impl::active());
+}
+
+PFTIII::Kernels::InstructionSet
+PFTIII::Kernels::setInstructionSet(
+    const InstructionSet maximum)
+{
+	const auto used = std::min(maximum, getSupportedInstructionSet());
+	activeSet.store(used, std::memory_order_relaxed);
+
+	return (used);
+}
+
+uint64_t
+PFTIII::Kernels::popcount(
+    std::span<const std::byte> bits)
+{
+	return (popcountDispatch(bits.data(), nullptr, bits.size()));
+}
+
+void
+PFTIII::Kernels::hammingDistances(
+    std::span<const std::byte> query,
+    std::span<const std::byte> descriptors,
+    std::span<uint32_t> distances)
+{
+	if (descriptors.size() != (query.size() * distances.size()))
+		throw std::invalid_argument("Expected " + std::to_string(
+		    distances.size()) + " descriptors of " + std::to_string(
+		    query.size()) + " bytes, but received " + std::to_string(
+		    descriptors.size()) + " bytes");
+	if (query.size() > (std::numeric_limits<uint32_t>::max() / 8))
+		throw std::invalid_argument("Descriptor too large");
+
+	for (std::size_t i{0}; i < distances.size(); ++i)
+		distances[i] = static_cast<uint32_t>(popcountDispatch(
+		    query.data(), descriptors.data() + (i * query.size()),
+		    query.size()));
+}
+
+void
+PFTIII::Kernels::pairwiseDistances(
+    std::span<const float> probeX,
+    std::span<const float> probeY,
+    std::span<const float> referenceX,
+    std::span<const float> referenceY,
+    std::span<float> distances)
+{
+	if ((probeX.size() != probeY.size()) ||
+	    (referenceX.size() != referenceY.size()))
+		throw std::invalid_argument("Differing number of X and Y "
+		    "coordinates");
+	if (distances.size() != (probeX.size() * referenceX.size()))
+		throw std::invalid_argument("Output must hold " +
+		    std::to_string(probeX.size() * referenceX.size()) +
+		    " distances");
+
+	switch (Impl::active()) {
+	case InstructionSet::AVX512:
+		pairwiseDistancesAVX512(probeX.data(), probeY.data(),
+		    probeX.size(), referenceX.data(), referenceY.data(),
+		    referenceX.size(), distances.data());
+		break;
+	case InstructionSet::AVX2:
+		pairwiseDistancesAVX2(probeX.data(), probeY.data(),
+		    probeX.size(), referenceX.data(), referenceY.data(),
+		    referenceX.size(), distances.data());
+		break;
+	case InstructionSet::SSE42:
+		pairwiseDistancesSSE42(probeX.data(), probeY.data(),
+		    probeX.size(), referenceX.data(), referenceY.data(),
+		    referenceX.size(), distances.data());
+		break;
+	case InstructionSet::Scalar:
+		pairwiseDistancesScalar(probeX.data(), probeY.data(),
+		    probeX.size(), referenceX.data(), referenceY.data(),
+		    referenceX.size(), distances.data());
+		break;
+	}
+}
+
+void
+PFTIII::Kernels::pairwiseAngleDifferences(
+    std::span<const float> probeTheta,
+    std::span<const float> referenceTheta,
+    std::span<float> differences)
+{
+	if (differences.size() != (probeTheta.size() * referenceTheta.size()))
+		throw std::invalid_argument("Output must hold " +
+		    std::to_string(probeTheta.size() * referenceTheta.size()) +
+		    " differences");
+
+	switch (Impl::active()) {
+	case InstructionSet::AVX512:
+		pairwiseAngleDifferencesAVX512(probeTheta.data(),
+		    probeTheta.size(), referenceTheta.data(),
+		    referenceTheta.size(), differences.data());
+		break;
+	case InstructionSet::AVX2:
+		pairwiseAngleDifferencesAVX2(probeTheta.data(),
+		    probeTheta.size(), referenceTheta.data(),
+		    referenceTheta.size(), differences.data());
+		break;
+	case InstructionSet::SSE42:
+		pairwiseAngleDifferencesSSE42(probeTheta.data(),
+		    probeTheta.size(), referenceTheta.data(),
+		    referenceTheta.size(), differences.data());
+		break;
+	case InstructionSet::Scalar:
+		pairwiseAngleDifferencesScalar(probeTheta.data(),
+		    probeTheta.size(), referenceTheta.data(),
+		    referenceTheta.size(), differences.data());
+		break;
+	}
+}
+
+std::vector<uint32_t>
+PFTIII::Kernels::topK(
+    std::span<const float> scores,
+    const std::size_t k)
+{
+	if (scores.size() > std::numeric_limits<uint32_t>::max())
+		throw std::invalid_argument("Too many scores");
+
+	const auto count = std::min(k, scores.size());
+	if (count == 0)
+		return {};
+
+	/* Higher score first, then lower index */
+	const auto better = [&scores](const uint32_t lhs, const uint32_t rhs)
+	    -> bool {
+		if (scores[lhs] != scores[rhs])
+			return (scores[lhs] > scores[rhs]);
+		return (lhs < rhs);
+	};
+
+	/* Heap of the best `count` seen so far, worst at the front */
+	std::vector<uint32_t> heap(count);
+	for (std::size_t i{0}; i < count; ++i)
+		heap[i] = static_cast<uint32_t>(i);
+	std::make_heap(heap.begin(), heap.end(), better);
+
+	decltype(&nextAboveScalar) nextAbove{};
+	switch (Impl::active()) {
+	case InstructionSet::AVX512:
+		nextAbove = nextAboveAVX512;
+		break;
+	case InstructionSet::AVX2:
+		nextAbove = nextAboveAVX2;
+		break;
+	case InstructionSet::SSE42:
+		nextAbove = nextAboveSSE42;
+		break;
+	case InstructionSet::Scalar:
+		nextAbove = nextAboveScalar;
+		break;
+	}
+
+	/*
+	 * Indices are visited in ascending order, so a candidate only
+	 * displaces the worst entry when strictly greater. Vector variants
+	 * skip whole blocks that cannot.
+	 */
+	std::size_t i{count};
+	while ((i = nextAbove(scores.data(), i, scores.size(),
+	    scores[heap.front()])) < scores.size()) {
+		std::pop_heap(heap.begin(), heap.end(), better);
+		heap.back() = static_cast<uint32_t>(i);
+		std::push_heap(heap.begin(), heap.end(), better);
+		++i;
+	}
+
+	std::sort(heap.begin(), heap.end(), better);
+	return (heap);
+}
@@ -0,0 +1,44 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef LIBPFTIII_KERNELS_H_
+#define LIBPFTIII_KERNELS_H_
+
+#include <pftiii_kernels.h>
+
+/*
+ * Function attributes enabling instruction set extensions for a single
+ * kernel variant. The library itself is built for the baseline ISA, and
+ * variants are only called after runtime detection.
+ */
+#define PFTIII_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define PFTIII_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define PFTIII_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512bw,avx2,popcnt")))
+
+namespace PFTIII
+{
+	namespace Kernels
+	{
+		/** Implementation details shared between kernel modules. */
+		namespace Impl
+		{
+			/**
+			 * @return
+			 * Instruction set extension that kernels shall
+			 * dispatch to for this call.
+			 */
+			InstructionSet
+			active();
+		}
+	}
+}
+
+#endif /* LIBPFTIII_KERNELS_H_ */
@@ -0,0 +1,509 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <libpftiii_kernels.h>
+
+namespace
+{
+	/** Fractional bits in filter weights. */
+	constexpr int WeightBits{14};
+	/** Sum of the weights of every filter tap set. */
+	constexpr int32_t WeightOne{1 << WeightBits};
+	/** Added before shifting out WeightBits to round to nearest. */
+	constexpr int32_t WeightRound{1 << (WeightBits - 1)};
+
+	/** Filter taps contributing to a single output row or column. */
+	struct Taps
+	{
+		/** First input row or column. */
+		std::size_t first{};
+		/** Weight of each consecutive input row or column. */
+		std::vector<int32_t> weights{};
+	};
+
+	/**
+	 * @brief
+	 * Compute fixed point triangle filter taps for each output sample.
+	 *
+	 * @param inSize
+	 * Number of input samples.
+	 * @param outSize
+	 * Number of output samples.
+	 *
+	 * @return
+	 * One set of taps per output sample, each summing to WeightOne.
+	 */
+	std::vector<Taps>
+	computeTaps(
+	    const std::size_t inSize,
+	    const std::size_t outSize)
+	{
+		const double scale{static_cast<double>(outSize) /
+		    static_cast<double>(inSize)};
+		/* Widen the filter when downsampling to avoid aliasing */
+		const double support{scale < 1 ? 1 / scale : 1};
+
+		std::vector<Taps> taps(outSize);
+		std::vector<double> weights{};
+		for (std::size_t o{0}; o < outSize; ++o) {
+			const double center{((static_cast<double>(o) + 0.5) /
+			    scale) - 0.5};
+			const auto first = static_cast<std::size_t>(std::max(0.0,
+			    std::floor(center - support) + 1));
+			const auto last = static_cast<std::size_t>(std::min(
+			    static_cast<double>(inSize - 1),
+			    std::ceil(center + support) - 1));
+
+			weights.clear();
+			double total{0};
+			for (std::size_t i{first}; i <= last; ++i) {
+				const double w{std::max(0.0, 1 - (std::fabs(
+				    static_cast<double>(i) - center) / support))};
+				weights.push_back(w);
+				total += w;
+			}
+
+			/* Image edges: renormalize the taps that remain */
+			taps[o].first = first;
+			taps[o].weights.resize(weights.size());
+			int32_t sum{0};
+			for (std::size_t i{0}; i < weights.size(); ++i) {
+				taps[o].weights[i] = static_cast<int32_t>(
+				    std::lround(weights[i] / total * WeightOne));
+				sum += taps[o].weights[i];
+			}
+			/* Absorb rounding error into the heaviest tap */
+			*std::max_element(taps[o].weights.begin(),
+			    taps[o].weights.end()) += WeightOne - sum;
+		}
+
+		return (taps);
+	}
+
+	uint8_t
+	normalize(
+	    const int32_t sum)
+	{
+		return (static_cast<uint8_t>(std::clamp((sum + WeightRound) >>
+		    WeightBits, 0, 255)));
+	}
+
+	/*
+	 * Filter columns. Each output row is a weighted sum of consecutive
+	 * input rows, so every variant vectorizes across the row.
+	 */
+
+	void
+	filterRowsScalar(
+	    const uint8_t *in,
+	    const std::size_t width,
+	    const Taps &taps,
+	    uint8_t *out,
+	    const std::size_t count)
+	{
+		for (std::size_t x{0}; x < count; ++x) {
+			int32_t sum{0};
+			for (std::size_t t{0}; t < taps.weights.size(); ++t)
+				sum += taps.weights[t] *
+				    in[((taps.first + t) * width) + x];
+			out[x] = normalize(sum);
+		}
+	}
+
+	PFTIII_TARGET_SSE42
+	void
+	filterRowsSSE42(
+	    const uint8_t *in,
+	    const std::size_t width,
+	    const Taps &taps,
+	    uint8_t *out)
+	{
+		const __m128i round = _mm_set1_epi32(WeightRound);
+
+		std::size_t x{0};
+		for (; x + 16 <= width; x += 16) {
+			__m128i s0{round}, s1{round}, s2{round}, s3{round};
+			for (std::size_t t{0}; t < taps.weights.size(); ++t) {
+				const __m128i w = _mm_set1_epi32(
+				    taps.weights[t]);
+				const __m128i p = _mm_loadu_si128(
+				    reinterpret_cast<const __m128i*>(in +
+				    ((taps.first + t) * width) + x));
+				s0 = _mm_add_epi32(s0, _mm_mullo_epi32(w,
+				    _mm_cvtepu8_epi32(p)));
+				s1 = _mm_add_epi32(s1, _mm_mullo_epi32(w,
+				    _mm_cvtepu8_epi32(_mm_srli_si128(p, 4))));
+				s2 = _mm_add_epi32(s2, _mm_mullo_epi32(w,
+				    _mm_cvtepu8_epi32(_mm_srli_si128(p, 8))));
+				s3 = _mm_add_epi32(s3, _mm_mullo_epi32(w,
+				    _mm_cvtepu8_epi32(_mm_srli_si128(p, 12))));
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm_packus_epi16(
+			    _mm_packus_epi32(_mm_srai_epi32(s0, WeightBits),
+			        _mm_srai_epi32(s1, WeightBits)),
+			    _mm_packus_epi32(_mm_srai_epi32(s2, WeightBits),
+			        _mm_srai_epi32(s3, WeightBits))));
+		}
+
+		filterRowsScalar(in + x, width, taps, out + x, width - x);
+	}
+
+	PFTIII_TARGET_AVX2
+	void
+	filterRowsAVX2(
+	    const uint8_t *in,
+	    const std::size_t width,
+	    const Taps &taps,
+	    uint8_t *out)
+	{
+		const __m256i round = _mm256_set1_epi32(WeightRound);
+
+		std::size_t x{0};
+		for (; x + 16 <= width; x += 16) {
+			__m256i s0{round}, s1{round};
+			for (std::size_t t{0}; t < taps.weights.size(); ++t) {
+				const __m256i w = _mm256_set1_epi32(
+				    taps.weights[t]);
+				const __m128i p = _mm_loadu_si128(
+				    reinterpret_cast<const __m128i*>(in +
+				    ((taps.first + t) * width) + x));
+				s0 = _mm256_add_epi32(s0, _mm256_mullo_epi32(w,
+				    _mm256_cvtepu8_epi32(p)));
+				s1 = _mm256_add_epi32(s1, _mm256_mullo_epi32(w,
+				    _mm256_cvtepu8_epi32(_mm_srli_si128(p, 8))));
+			}
+			/* Packing interleaves 128-bit lanes, so restore order */
+			const __m256i packed = _mm256_permute4x64_epi64(
+			    _mm256_packus_epi32(_mm256_srai_epi32(s0, WeightBits),
+			    _mm256_srai_epi32(s1, WeightBits)), 0xD8);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm_packus_epi16(_mm256_castsi256_si128(packed),
+			    _mm256_extracti128_si256(packed, 1)));
+		}
+
+		filterRowsScalar(in + x, width, taps, out + x, width - x);
+	}
+
+	/* GCC 12 intrinsics headers trip -Wuninitialized (GCC PR 105593) */
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wuninitialized"
+	#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+	PFTIII_TARGET_AVX512
+	void
+	filterRowsAVX512(
+	    const uint8_t *in,
+	    const std::size_t width,
+	    const Taps &taps,
+	    uint8_t *out)
+	{
+		const __m512i round = _mm512_set1_epi32(WeightRound);
+		const __m512i zero = _mm512_setzero_si512();
+
+		std::size_t x{0};
+		for (; x + 16 <= width; x += 16) {
+			__m512i sum{round};
+			for (std::size_t t{0}; t < taps.weights.size(); ++t)
+				sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(
+				    _mm512_set1_epi32(taps.weights[t]),
+				    _mm512_cvtepu8_epi32(_mm_loadu_si128(
+				    reinterpret_cast<const __m128i*>(in +
+				    ((taps.first + t) * width) + x)))));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm512_cvtusepi32_epi8(_mm512_max_epi32(zero,
+			    _mm512_srai_epi32(sum, WeightBits))));
+		}
+
+		filterRowsScalar(in + x, width, taps, out + x, width - x);
+	}
+
+	#pragma GCC diagnostic pop
+
+	/**
+	 * @brief
+	 * Filter columns of an image.
+	 *
+	 * @param in
+	 * Input image, `width` pixels wide.
+	 * @param width
+	 * Width of `in` and the output image.
+	 * @param taps
+	 * One set of taps per output row.
+	 *
+	 * @return
+	 * Image of `width` * `taps.size()` pixels.
+	 */
+	std::vector<uint8_t>
+	filterRows(
+	    const uint8_t *in,
+	    const std::size_t width,
+	    const std::vector<Taps> &taps)
+	{
+		std::vector<uint8_t> out(width * taps.size());
+
+		const auto isa = PFTIII::Kernels::Impl::active();
+		for (std::size_t y{0}; y < taps.size(); ++y) {
+			uint8_t *row = out.data() + (y * width);
+			switch (isa) {
+			case PFTIII::Kernels::InstructionSet::AVX512:
+				filterRowsAVX512(in, width, taps[y], row);
+				break;
+			case PFTIII::Kernels::InstructionSet::AVX2:
+				filterRowsAVX2(in, width, taps[y], row);
+				break;
+			case PFTIII::Kernels::InstructionSet::SSE42:
+				filterRowsSSE42(in, width, taps[y], row);
+				break;
+			case PFTIII::Kernels::InstructionSet::Scalar:
+				filterRowsScalar(in, width, taps[y], row,
+				    width);
+				break;
+			}
+		}
+
+		return (out);
+	}
+
+	/**
+	 * @brief
+	 * Transpose an image.
+	 *
+	 * @param in
+	 * Image `width` * `height` pixels.
+	 * @param width
+	 * Width of `in`.
+	 * @param height
+	 * Height of `in`.
+	 *
+	 * @return
+	 * `in`, `height` pixels wide and `width` pixels tall.
+	 */
+	std::vector<uint8_t>
+	transpose(
+	    const uint8_t *in,
+	    const std::size_t width,
+	    const std::size_t height)
+	{
+		/* Tiles keep both the source and destination in cache */
+		static constexpr std::size_t Tile{32};
+
+		std::vector<uint8_t> out(width * height);
+		for (std::size_t ty{0}; ty < height; ty += Tile)
+			for (std::size_t tx{0}; tx < width; tx += Tile)
+				for (std::size_t y{ty}; y < std::min(ty + Tile,
+				    height); ++y)
+					for (std::size_t x{tx}; x < std::min(
+					    tx + Tile, width); ++x)
+						out[(x * height) + y] =
+						    in[(y * width) + x];
+
+		return (out);
+	}
+
+	/**
+	 * @brief
+	 * Average 2x2 blocks from two rows of an image.
+	 *
+	 * @param top
+	 * First row of input.
+	 * @param bottom
+	 * Second row of input.
+	 * @param inWidth
+	 * Number of pixels in `top` and `bottom`.
+	 * @param out
+	 * Row of output, receiving half as many pixels as the input.
+	 *
+	 * @return
+	 * Number of output pixels written. Only complete blocks are
+	 * averaged.
+	 */
+	PFTIII_TARGET_AVX2
+	std::size_t
+	boxFilterRowAVX2(
+	    const uint8_t *top,
+	    const uint8_t *bottom,
+	    const std::size_t inWidth,
+	    uint8_t *out)
+	{
+		const __m256i ones = _mm256_set1_epi8(1);
+		const __m256i two = _mm256_set1_epi16(2);
+
+		std::size_t x{0};
+		for (; (2 * x) + 32 <= inWidth; x += 16) {
+			/* Sum horizontally adjacent pixels into 16 bits */
+			const __m256i sums = _mm256_add_epi16(
+			    _mm256_maddubs_epi16(_mm256_loadu_si256(
+			        reinterpret_cast<const __m256i*>(top + (2 * x))),
+			        ones),
+			    _mm256_maddubs_epi16(_mm256_loadu_si256(
+			        reinterpret_cast<const __m256i*>(bottom +
+			        (2 * x))), ones));
+			const __m256i averages = _mm256_srli_epi16(
+			    _mm256_add_epi16(sums, two), 2);
+			/* Pack within lanes, then gather the low halves */
+			const __m256i packed = _mm256_permute4x64_epi64(
+			    _mm256_packus_epi16(averages, averages), 0x08);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x),
+			    _mm256_castsi256_si128(packed));
+		}
+
+		return (x);
+	}
+
+	/**
+	 * @brief
+	 * Validate an image and compute its dimensions at another resolution.
+	 *
+	 * @param fingerImage
+	 * Image to be resampled.
+	 * @param ppi
+	 * Desired resolution.
+	 *
+	 * @return
+	 * Width and height of `fingerImage` at `ppi`.
+	 */
+	std::tuple<uint16_t, uint16_t>
+	scaledDimensions(
+	    const PFTIII::FingerImage &fingerImage,
+	    const uint16_t ppi)
+	{
+		if ((fingerImage.ppi == 0) || (ppi == 0))
+			throw std::invalid_argument("Resolution cannot be 0");
+		if (fingerImage.pixels.size() != (static_cast<std::size_t>(
+		    fingerImage.width) * fingerImage.height))
+			throw std::invalid_argument("Expected " + std::to_string(
+			    fingerImage.width) + "x" + std::to_string(
+			    fingerImage.height) + " pixels, but received " +
+			    std::to_string(fingerImage.pixels.size()));
+
+		const auto scale = [&](const uint16_t size) -> uint16_t {
+			const uint64_t scaled{((static_cast<uint64_t>(size) *
+			    ppi) + (fingerImage.ppi / 2u)) / fingerImage.ppi};
+			if (scaled > std::numeric_limits<uint16_t>::max())
+				throw std::invalid_argument("Resampled image "
+				    "would be too large");
+			return (static_cast<uint16_t>(std::max<uint64_t>(
+			    scaled, size == 0 ? 0 : 1)));
+		};
+
+		return {scale(fingerImage.width), scale(fingerImage.height)};
+	}
+}
+
+template<>
+PFTIII::FingerImage
+PFTIII::Kernels::resample<500, 500>(
+    const FingerImage &fingerImage)
+{
+	if (fingerImage.ppi != 500)
+		throw std::invalid_argument("Image is " + std::to_string(
+		    fingerImage.ppi) + " PPI, not 500");
+	scaledDimensions(fingerImage, 500);
+
+	return (fingerImage);
+}
+
+template<>
+PFTIII::FingerImage
+PFTIII::Kernels::resample<1000, 500>(
+    const FingerImage &fingerImage)
+{
+	if (fingerImage.ppi != 1000)
+		throw std::invalid_argument("Image is " + std::to_string(
+		    fingerImage.ppi) + " PPI, not 1000");
+	const auto [width, height] = scaledDimensions(fingerImage, 500);
+
+	FingerImage resampled{fingerImage};
+	resampled.width = width;
+	resampled.height = height;
+	resampled.ppi = 500;
+	resampled.pixels.resize(static_cast<std::size_t>(width) * height);
+	if (resampled.pixels.empty())
+		return (resampled);
+
+	/*
+	 * Average each 2x2 block. Odd dimensions replicate the last row or
+	 * column, so that dimensions match the general filter.
+	 */
+	const auto *in = reinterpret_cast<const uint8_t*>(
+	    fingerImage.pixels.data());
+	auto *out = reinterpret_cast<uint8_t*>(resampled.pixels.data());
+	const std::size_t inWidth{fingerImage.width};
+	const std::size_t lastX{inWidth - 1};
+	const std::size_t lastY{fingerImage.height - 1u};
+	for (std::size_t y{0}; y < height; ++y) {
+		const uint8_t *top = in + ((2 * y) * inWidth);
+		const uint8_t *bottom = in + (std::min(2 * y + 1, lastY) *
+		    inWidth);
+		std::size_t x{0};
+		if (PFTIII::Kernels::Impl::active() >=
+		    PFTIII::Kernels::InstructionSet::AVX2)
+			x = boxFilterRowAVX2(top, bottom, inWidth,
+			    out + (y * width));
+		for (; x < width; ++x) {
+			const std::size_t left{2 * x};
+			const std::size_t right{std::min(left + 1, lastX)};
+			out[(y * width) + x] = static_cast<uint8_t>(
+			    (static_cast<unsigned>(top[left] + top[right] +
+			    bottom[left] + bottom[right]) + 2u) >> 2);
+		}
+	}
+
+	return (resampled);
+}
+
+PFTIII::FingerImage
+PFTIII::Kernels::resample(
+    const FingerImage &fingerImage,
+    const uint16_t ppi)
+{
+	if ((fingerImage.ppi == 500) && (ppi == 500))
+		return (resample<500, 500>(fingerImage));
+	if ((fingerImage.ppi == 1000) && (ppi == 500))
+		return (resample<1000, 500>(fingerImage));
+
+	const auto [width, height] = scaledDimensions(fingerImage, ppi);
+
+	FingerImage resampled{fingerImage};
+	resampled.width = width;
+	resampled.height = height;
+	resampled.ppi = ppi;
+	if ((width == 0) || (height == 0)) {
+		resampled.pixels.clear();
+		return (resampled);
+	}
+
+	/* Filter columns, then filter the columns of the transpose */
+	const auto *in = reinterpret_cast<const uint8_t*>(
+	    fingerImage.pixels.data());
+	const auto vertical = filterRows(in, fingerImage.width,
+	    computeTaps(fingerImage.height, height));
+	const auto horizontal = filterRows(transpose(vertical.data(),
+	    fingerImage.width, height).data(), height,
+	    computeTaps(fingerImage.width, width));
+	const auto out = transpose(horizontal.data(), height, width);
+
+	resampled.pixels.resize(out.size());
+	std::copy(out.begin(), out.end(), reinterpret_cast<uint8_t*>(
+	    resampled.pixels.data()));
+
+	return (resampled);
+}
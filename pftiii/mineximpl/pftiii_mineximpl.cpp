@@ -9,12 +9,14 @@
  */
 
 #include <cstring>
+#include <exception>
 #include <type_traits>
 
 #include <arpa/inet.h>
 
 #include "minexiii.h"
 
+#include <pftiii_kernels.h>
 #include <pftiii_mineximpl.h>
 
 PFTIII::MINEXImplementation::MINEXImplementation(
@@ -28,6 +30,13 @@ PFTIII::MINEXImplementation::MINEXImplementation(
 PFTIII::SubmissionIdentification
 PFTIII::MINEXImplementation::getIdentification()
     const
+{
+	/* Identification must match getSubmissionIdentification() */
+	return (Interface::getSubmissionIdentification());
+}
+
+PFTIII::SubmissionIdentification
+PFTIII::Interface::getSubmissionIdentification()
 {
 	SubmissionIdentification si{};
 	/* TODO: Replace with your version number. */
@@ -56,26 +65,38 @@ PFTIII::MINEXImplementation::createProprietaryTemplate(
 	 *	   - Image quality is not provided by the PFT III API.
 	 *       * Image Resolution:
 	 *         - All images were 500 PPI. PFT III images can be of any
-	 *           resolution.
+	 *           resolution, so they are resampled to 500 PPI below.
 	 *
 	 * If the MINEX algorithm made these assumptions, it must be revised.
 	 */
 
+	const FingerImage *image{&fingerImage};
+	FingerImage resampled{};
+	if (fingerImage.ppi != MINEX_IMAGE_PPI) {
+		try {
+			resampled = Kernels::resample(fingerImage,
+			    MINEX_IMAGE_PPI);
+		} catch (const std::exception &e) {
+			return (createFailure(e.what()));
+		}
+		image = &resampled;
+	}
+
 	uint8_t incitsTemplate[MINEX_MAX_TEMPLATE_SIZE] = {};
 	static_assert(std::is_same_v<uint8_t,
 	    std::underlying_type_t<std::byte>>);
 	const auto rv = create_template(
-	    reinterpret_cast<const uint8_t*>(fingerImage.pixels.data()),
+	    reinterpret_cast<const uint8_t*>(image->pixels.data()),
 	    /*
 	     * NOTE: The PFT III API does not provide quality values, since it
 	     *       is capable of testing more types of images than NIST
 	     *       Fingerprint Image Quality (NFIQ) 2.0 knows how to handle.
 	     */
 	    0,
-	    static_cast<uint8_t>(fingerImage.frgp),
-	    static_cast<uint8_t>(fingerImage.imp),
-	    fingerImage.height,
-	    fingerImage.width,
+	    static_cast<uint8_t>(image->frgp),
+	    static_cast<uint8_t>(image->imp),
+	    image->height,
+	    image->width,
 	    incitsTemplate);
 
 	if (rv != MINEX_RET_SUCCESS)
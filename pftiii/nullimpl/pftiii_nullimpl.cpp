@@ -21,6 +21,13 @@ PFTIII::NullImplementation::NullImplementation(
 PFTIII::SubmissionIdentification
 PFTIII::NullImplementation::getIdentification()
     const
+{
+	/* Identification must match getSubmissionIdentification() */
+	return (Interface::getSubmissionIdentification());
+}
+
+PFTIII::SubmissionIdentification
+PFTIII::Interface::getSubmissionIdentification()
 {
 	SubmissionIdentification si{};
 
@@ -102,6 +109,14 @@ PFTIII::NullImplementation::compareProprietaryTemplates(
 //	return (std::make_tuple(status, 0));
 }
 
+bool
+PFTIII::NullImplementation::isReentrant()
+    const
+{
+	/* Methods do not modify any state, so may run concurrently */
+	return (true);
+}
+
 std::shared_ptr<PFTIII::Interface>
 PFTIII::Interface::getImplementation(
     const std::filesystem::path &configurationDirectory)
@@ -34,6 +34,11 @@ namespace PFTIII
 		    const std::vector<std::byte> &referenceTemplate)
 		    override;
 
+		bool
+		isReentrant()
+		    const
+		    override;
+
 		NullImplementation(
 		    const std::filesystem::path &configurationDirectory = "");
 		~NullImplementation() = default;
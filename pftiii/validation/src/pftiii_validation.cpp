@@ -18,28 +18,52 @@
 #include <cctype>
 #include <chrono>
 #include <exception>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <numeric>
 #include <sstream>
 #include <system_error>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <pftiii_validation.h>
 #include <pftiii_validation_data.h>
+#include <pftiii_validation_file.h>
 #include <pftiii_validation_utils.h>
 
-std::string
+namespace
+{
+	/**
+	 * @return
+	 * Start of every log entry for an item: the quoted name of an
+	 * image (Operation::Create), or of both images of a pair
+	 * (Operation::Compare).
+	 */
+	std::string
+	getLogKey(
+	    const PFTIII::Validation::Dataset &dataset,
+	    const PFTIII::Validation::Operation operation,
+	    const uint64_t item)
+	{
+		if (operation == PFTIII::Validation::Operation::Create)
+			return ('"' + std::string(dataset.getImageName(item)) +
+			    '"');
+		const auto [probe, reference] = dataset.getPairNames(item);
+		return ('"' + std::string(probe) + "\",\"" +
+		    std::string(reference) + '"');
+	}
+}
+
+std::tuple<std::string, std::vector<std::byte>>
 PFTIII::Validation::create(
     const std::shared_ptr<Interface> impl,
-    const uint64_t imageIndex)
+    const std::string_view name,
+    const FingerImage &image)
 {
-	const auto name = std::get<0>(Data::Images.at(imageIndex));
-	const auto md = std::get<1>(Data::Images.at(imageIndex));
-	const FingerImage image{md.width, md.height, md.ppi,
-	    readFile(ImageDir + "/" + name), md.imp, md.frct, md.frgp};
-
 	std::tuple<FingerImageStatus, CreateProprietaryTemplateResult> rv{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
@@ -48,13 +72,13 @@ PFTIII::Validation::create(
 		stop = std::chrono::steady_clock::now();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while creating template "
-		    "from " + name + " (" + e.what() + ")");
+		    "from " + std::string(name) + " (" + e.what() + ")");
 	} catch (...) {
 		throw std::runtime_error("Unknown exception while creating "
-		    "template from " + name);
+		    "template from " + std::string(name));
 	}
 
-	std::string logLine{'"' + name + "\"," +
+	std::string logLine{'"' + std::string(name) + "\"," +
 	    std::to_string(std::chrono::duration_cast<
 	        std::chrono::microseconds>(stop - start).count()) + ',' +
 	    e2i2s(std::get<0>(rv).code) + ',' +
@@ -70,27 +94,22 @@ PFTIII::Validation::create(
 	} else
 		logLine += "NA,\"\",NA";
 
-	/* Write template */
+	/* Template to write */
 	if ((std::get<0>(rv).code == FingerImageStatus::Code::Supported) &&
 	    (std::get<1>(rv).result == Result::Success))
-		writeFile(std::get<1>(rv).proprietaryTemplate,
-		    TemplateDir + "/" + name + TemplateSuffix);
-	else
-		writeFile({}, TemplateDir + "/" + name + TemplateSuffix);
-
-	return (logLine);
+		return {logLine, std::move(
+		    std::get<1>(rv).proprietaryTemplate)};
+	return {logLine, {}};
 }
 
 std::string
 PFTIII::Validation::compare(
     const std::shared_ptr<Interface> impl,
-    const uint64_t pairsIndex)
+    const std::string_view probeName,
+    const std::string_view referenceName,
+    const std::vector<std::byte> &probe,
+    const std::vector<std::byte> &reference)
 {
-	const auto probe = readFile(TemplateDir + "/" + std::get<0>(
-	    Data::Pairs.at(pairsIndex)) + TemplateSuffix);
-	const auto reference = readFile(TemplateDir + "/" + std::get<1>(
-	    Data::Pairs.at(pairsIndex)) + TemplateSuffix);
-
 	std::tuple<CompareProprietaryTemplatesStatus, double> rv{};
 	std::chrono::steady_clock::time_point start{}, stop{};
 	try {
@@ -99,17 +118,16 @@ PFTIII::Validation::compare(
 		stop = std::chrono::steady_clock::now();
 	} catch (const std::exception &e) {
 		throw std::runtime_error("Exception while comparing " +
-		    std::get<0>(Data::Pairs.at(pairsIndex)) + " to " +
-		    std::get<1>(Data::Pairs.at(pairsIndex)) + " (" + e.what() +
-		    ")");
+		    std::string(probeName) + " to " +
+		    std::string(referenceName) + " (" + e.what() + ")");
 	} catch (...) {
 		throw std::runtime_error("Unknown exception while comparing " +
-		    std::get<0>(Data::Pairs.at(pairsIndex)) + " to " +
-		    std::get<1>(Data::Pairs.at(pairsIndex)));
+		    std::string(probeName) + " to " +
+		    std::string(referenceName));
 	}
 
-	return {'"' + std::get<0>(Data::Pairs.at(pairsIndex)) + "\",\"" +
-	    std::get<1>(Data::Pairs.at(pairsIndex)) + "\"," +
+	return {'"' + std::string(probeName) + "\",\"" +
+	    std::string(referenceName) + "\"," +
 	    std::to_string(std::chrono::duration_cast<
 	        std::chrono::microseconds>(stop - start).count()) + ',' +
 	    e2i2s(std::get<0>(rv).result) + ',' +
@@ -118,12 +136,24 @@ PFTIII::Validation::compare(
 	        std::to_string(std::get<1>(rv)) : "NA")};
 }
 
+void
+PFTIII::Validation::checkIdentification(
+    const std::shared_ptr<Interface> impl)
+{
+	const auto instanceID = impl->getIdentification();
+	const auto staticID = PFTIII::Interface::getSubmissionIdentification();
+
+	if ((instanceID.versionNumber != staticID.versionNumber) ||
+	    (instanceID.libraryIdentifier != staticID.libraryIdentifier))
+		throw std::runtime_error("getIdentification() and "
+		    "getSubmissionIdentification() return different library "
+		    "identifiers or version numbers");
+}
+
 std::string
-PFTIII::Validation::getIdentificationString(
-    const Arguments &args)
+PFTIII::Validation::getIdentificationString()
 {
-	const auto id = PFTIII::Interface::getImplementation(args.configDir)->
-	    getIdentification();
+	const auto id = PFTIII::Interface::getSubmissionIdentification();
 
 	std::stringstream ss{};
 	ss << "Identifier = " << id.libraryIdentifier << '\n' <<
@@ -176,6 +206,22 @@ PFTIII::Validation::getIdentificationString(
 	return (ss.str());
 }
 
+std::vector<std::shared_ptr<PFTIII::Interface>>
+PFTIII::Validation::getImplementationPool(
+    const std::string &configDir,
+    const uint8_t numInstances)
+{
+	std::vector<std::shared_ptr<Interface>> impls{};
+	impls.reserve(numInstances);
+	for (uint8_t i{0}; i < numInstances; ++i) {
+		impls.push_back(PFTIII::Interface::getImplementation(
+		    configDir));
+		checkIdentification(impls.back());
+	}
+
+	return (impls);
+}
+
 std::string
 PFTIII::Validation::getUsageString(
     const std::string &name)
@@ -184,11 +230,44 @@ PFTIII::Validation::getUsageString(
 
 	std::stringstream ss{};
 	ss << "Usage: " << name << "\n";
-	ss << prefix << "# Identify\n" << prefix << "-i -z <configDir>\n";
+	ss << prefix << "# Identify\n" << prefix << "-i\n";
 	ss << prefix << "# createProprietaryTemplate()\n" << prefix <<
-	    "-e -z <configDir> [-r random_seed] [-f num_procs]\n";
+	    "-e -z <configDir> [-r random_seed] "
+	    "[-f num_procs | -t num_threads [-p]]\n" << prefix <<
+	    "   [--template-archive path] [--image-corpus path] "
+	    "[--pipeline-depth n]\n" << prefix <<
+	    "   [--order random | cost [--cost-log path]]\n" << prefix <<
+	    "   [--shard i/n] [--resume] [--timeout s] [--retries n] "
+	    "[--progress s]\n" << prefix <<
+	    "   [--pin core | thread [--bind-memory]] [--manifest path]\n";
 	ss << prefix << "# compareProprietaryTemplates()\n" << prefix <<
-	    "-c -z <configDir> [-r random_seed] [-f num_procs]";
+	    "-c -z <configDir> [-r random_seed] "
+	    "[-f num_procs | -t num_threads [-p]]\n" << prefix <<
+	    "   [--cache-size MiB] [--preload | --shared-templates] "
+	    "[--template-archive path]\n" << prefix <<
+	    "   [--pipeline-depth n] "
+	    "[--order random | {probe | reference} [--tile-size n] |\n" <<
+	    prefix << "      cost [--cost-log path]]\n" <<
+	    prefix << "   [--shard i/n] [--resume] [--timeout s] "
+	    "[--retries n] [--progress s]\n" << prefix <<
+	    "   [--pin core | thread [--bind-memory]] [--manifest path]\n";
+	ss << prefix << "# Both, comparing pairs as soon as templates "
+	    "exist\n" << prefix << "-s -z <configDir> [-r random_seed] "
+	    "[-t num_threads [-p]]\n" << prefix <<
+	    "   [--keep-templates [--template-archive path]] "
+	    "[--image-corpus path]\n" << prefix <<
+	    "   [--order random | cost [--cost-log path]] "
+	    "[--progress s]\n" << prefix <<
+	    "   [--pin core | thread [--bind-memory]] [--manifest path]\n";
+	ss << prefix << "# Extract archived templates to " << TemplateDir <<
+	    "\n" << prefix << "-x --template-archive path\n";
+	ss << prefix << "# Pack " << ImageDir << " into an image corpus\n" <<
+	    prefix << "-b --image-corpus path [--manifest path]\n";
+	ss << prefix << "# Merge logs of all shards (--shard), checking "
+	    "that none are missing\n" << prefix << "-m [--manifest path]\n";
+	ss << prefix << "# Write images and pairs (built-in, or a CSV "
+	    "manifest) as a binary manifest\n" << prefix <<
+	    "-n path [--manifest path]";
 
 	return (ss.str());
 }
@@ -198,14 +277,67 @@ PFTIII::Validation::parseArguments(
     const int argc,
     char * const argv[])
 {
-	static const char options[] {"ceir:f:z:"};
+	/* Values returned by getopt_long() for options without short forms */
+	enum LongOption : int
+	{
+		CacheSize = 256,
+		Preload,
+		Archive,
+		Corpus,
+		PipelineDepth,
+		SharedTemplates,
+		PairOrder,
+		TileSize,
+		Shard,
+		Resume,
+		Timeout,
+		Retries,
+		Progress,
+		CostLog,
+		KeepTemplates,
+		Pin,
+		BindMemory,
+		Manifest
+	};
+
+	static const char options[] {"bceimpsxn:r:f:t:z:"};
+	static const struct option longOptions[] {
+	    {"cache-size", required_argument, nullptr, CacheSize},
+	    {"preload", no_argument, nullptr, Preload},
+	    {"template-archive", required_argument, nullptr, Archive},
+	    {"image-corpus", required_argument, nullptr, Corpus},
+	    {"pipeline-depth", required_argument, nullptr, PipelineDepth},
+	    {"shared-templates", no_argument, nullptr, SharedTemplates},
+	    {"order", required_argument, nullptr, PairOrder},
+	    {"tile-size", required_argument, nullptr, TileSize},
+	    {"shard", required_argument, nullptr, Shard},
+	    {"resume", no_argument, nullptr, Resume},
+	    {"timeout", required_argument, nullptr, Timeout},
+	    {"retries", required_argument, nullptr, Retries},
+	    {"progress", required_argument, nullptr, Progress},
+	    {"cost-log", required_argument, nullptr, CostLog},
+	    {"keep-templates", no_argument, nullptr, KeepTemplates},
+	    {"pin", required_argument, nullptr, Pin},
+	    {"bind-memory", no_argument, nullptr, BindMemory},
+	    {"manifest", required_argument, nullptr, Manifest},
+	    {nullptr, 0, nullptr, 0}
+	};
 
 	bool seenOperation{false};
 	Validation::Arguments args{};
 
 	int c{};
-	while ((c = getopt(argc, argv, options)) != -1) {
+	while ((c = getopt_long(argc, argv, options, longOptions,
+	    nullptr)) != -1) {
 		switch (c) {
+		case 'b':	/* Build image corpus */
+			if (seenOperation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			seenOperation = true;
+
+			args.operation = Operation::Build;
+			break;
 		case 'c':	/* Compare templates */
 			if (seenOperation)
 				throw std::logic_error{"Multiple operations "
@@ -252,6 +384,42 @@ PFTIII::Validation::parseArguments(
 
 			args.operation = Operation::Identify;
 			break;
+		case 'm':	/* Merge logs */
+			if (seenOperation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			seenOperation = true;
+
+			args.operation = Operation::Merge;
+			break;
+		case 'n':	/* Write binary manifest */
+			if (seenOperation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			seenOperation = true;
+
+			args.operation = Operation::Manifest;
+			args.packedManifest = optarg;
+			break;
+		case 's':	/* Stream templates from creation to comparison */
+			if (seenOperation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			seenOperation = true;
+
+			args.operation = Operation::Stream;
+			break;
+		case 'x':	/* Extract template archive */
+			if (seenOperation)
+				throw std::logic_error{"Multiple operations "
+				    "specified"};
+			seenOperation = true;
+
+			args.operation = Operation::Extract;
+			break;
+		case 'p':	/* One implementation per thread */
+			args.instancePerThread = true;
+			break;
 		case 'r':	/* Random seed */
 			try {
 				args.randomSeed = std::stoul(optarg);
@@ -261,114 +429,950 @@ PFTIII::Validation::parseArguments(
 				    std::string(optarg) + "\""};
 			}
 			break;
+		case 't': {	/* Number of threads */
+			try {
+				auto numThreads = std::stoul(optarg);
+				if ((numThreads == 0) || (numThreads > UINT8_MAX))
+					throw std::exception{};
+				args.numThreads = static_cast<uint8_t>(
+				    numThreads);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Number of "
+				    "threads (-t): an error occurred when "
+				    "parsing \"" + std::string(optarg) + "\""};
+			}
+
+			const auto threadCount = std::thread::
+			    hardware_concurrency();
+			if ((threadCount == 0 && args.numThreads > 4) ||
+			    (args.numThreads > threadCount))
+				throw std::invalid_argument{"Number of "
+				    "threads (-t): Asked to spawn " +
+				    std::to_string(args.numThreads) + " "
+				    "threads, but refusing"};
+			break;
+		}
 		case 'z':
 			args.configDir = optarg;
 			break;
+		case CacheSize: {	/* Template cache budget, MiB */
+			static constexpr uint64_t MiB{1024 * 1024};
+			try {
+				const auto size = std::stoull(optarg);
+				if (size > (UINT64_MAX / MiB))
+					throw std::exception{};
+				args.templateCacheSize = size * MiB;
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Template cache size "
+				    "(--cache-size): an error occurred when "
+				    "parsing \"" + std::string(optarg) + "\""};
+			}
+			break;
+		}
+		case Preload:	/* Fill template cache before comparing */
+			args.preloadTemplates = true;
+			break;
+		case Archive:	/* Template archive */
+			args.templateArchive = optarg;
+			break;
+		case Corpus:	/* Image corpus */
+			args.imageCorpus = optarg;
+			break;
+		case Manifest:	/* Images and pairs to use */
+			args.manifest = optarg;
+			break;
+		case PairOrder: {	/* Order of comparisons */
+			const std::string order{optarg};
+			if (order == "random")
+				args.order = Order::Random;
+			else if (order == "probe")
+				args.order = Order::Probe;
+			else if (order == "reference")
+				args.order = Order::Reference;
+			else if (order == "cost")
+				args.order = Order::Cost;
+			else
+				throw std::invalid_argument{"Order (--order): "
+				    "expected random, probe, reference, or "
+				    "cost, not \"" + order + "\""};
+			break;
+		}
+		case CostLog:	/* Timings that predict Order::Cost */
+			args.costLog = optarg;
+			break;
+		case KeepTemplates:	/* Write streamed templates */
+			args.keepTemplates = true;
+			break;
+		case TileSize:	/* Templates per tile of ordered pairs */
+			try {
+				args.tileSize = std::stoull(optarg);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Tile size "
+				    "(--tile-size): an error occurred when "
+				    "parsing \"" + std::string(optarg) + "\""};
+			}
+			break;
+		case Shard:	/* Slice of the permutation, "i/n" */
+			try {
+				const std::string shard{optarg};
+				const auto slash = shard.find('/');
+				if ((slash == std::string::npos) ||
+				    (shard.find_first_not_of("0123456789/") !=
+				    std::string::npos))
+					throw std::exception{};
+				const auto index = std::stoul(shard.substr(0,
+				    slash));
+				const auto count = std::stoul(shard.substr(
+				    slash + 1));
+				if ((count == 0) || (index >= count) ||
+				    (count > UINT32_MAX))
+					throw std::exception{};
+				args.shardIndex = static_cast<uint32_t>(index);
+				args.shardCount = static_cast<uint32_t>(count);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Shard (--shard): "
+				    "expected i/n with 0 <= i < n, not \"" +
+				    std::string(optarg) + "\""};
+			}
+			break;
+		case Timeout:	/* Seconds allowed per supervised item */
+			try {
+				args.callTimeout = std::chrono::seconds{
+				    std::stoul(optarg)};
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Timeout "
+				    "(--timeout): an error occurred when "
+				    "parsing \"" + std::string(optarg) +
+				    "\""};
+			}
+			args.supervise = true;
+			break;
+		case Retries: {	/* Attempts after losing a worker */
+			/* Bounded well below the range of attempt counters */
+			static constexpr unsigned long MaxRetries{100};
+			try {
+				const auto retries = std::stoul(optarg);
+				if (retries > MaxRetries)
+					throw std::exception{};
+				args.maxRetries = static_cast<uint8_t>(retries);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Retries (--retries): "
+				    "expected at most " + ts(MaxRetries) + ", "
+				    "not \"" + std::string(optarg) + "\""};
+			}
+			args.supervise = true;
+			break;
+		}
+		case Progress:	/* Seconds between progress reports */
+			try {
+				args.progressInterval = std::chrono::seconds{
+				    std::stoul(optarg)};
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Progress "
+				    "(--progress): an error occurred when "
+				    "parsing \"" + std::string(optarg) +
+				    "\""};
+			}
+			break;
+		case Pin: {	/* Pin workers to hardware threads */
+			const std::string pinning{optarg};
+			if (pinning == "core")
+				args.pinning = Pinning::Core;
+			else if (pinning == "thread")
+				args.pinning = Pinning::Thread;
+			else
+				throw std::invalid_argument{"Pinning (--pin): "
+				    "expected core or thread, not \"" +
+				    pinning + "\""};
+			break;
+		}
+		case BindMemory:	/* Allocate from the local NUMA node */
+			args.bindMemory = true;
+			break;
+		case Resume:	/* Continue an interrupted run */
+			args.resume = true;
+			break;
+		case SharedTemplates:	/* Templates in shared memory */
+			args.sharedTemplates = true;
+			break;
+		case PipelineDepth:	/* Items between pipeline stages */
+			try {
+				const auto depth = std::stoul(optarg);
+				if (depth > UINT16_MAX)
+					throw std::exception{};
+				args.pipelineDepth = static_cast<uint16_t>(
+				    depth);
+			} catch (const std::exception&) {
+				throw std::invalid_argument{"Pipeline depth "
+				    "(--pipeline-depth): an error occurred "
+				    "when parsing \"" + std::string(optarg) +
+				    "\""};
+			}
+			break;
 		}
 	}
 
+	if ((args.numProcs > 1) && (args.numThreads > 1))
+		throw std::invalid_argument{"Cannot combine processes (-f) "
+		    "and threads (-t)"};
+	if (args.instancePerThread && (args.numThreads <= 1))
+		throw std::invalid_argument{"One implementation per thread "
+		    "(-p) requires multiple threads (-t)"};
+	if ((args.order != Order::Probe) &&
+	    (args.order != Order::Reference) && (args.tileSize != 0))
+		throw std::invalid_argument{"Tile size (--tile-size) requires "
+		    "probe or reference order (--order)"};
+	if ((args.order != Order::Cost) && !args.costLog.empty())
+		throw std::invalid_argument{"Cost log (--cost-log) requires "
+		    "cost order (--order)"};
+	if (args.bindMemory && (args.pinning == Pinning::None))
+		throw std::invalid_argument{"Binding memory (--bind-memory) "
+		    "requires pinning (--pin)"};
+	if (args.preloadTemplates && args.sharedTemplates)
+		throw std::invalid_argument{"Cannot combine preloading the "
+		    "cache (--preload) and shared templates "
+		    "(--shared-templates)"};
+
 	if (!seenOperation)
 		args.operation = Operation::Usage;
-	if (args.configDir.empty() && (args.operation != Operation::Usage))
+	if (args.configDir.empty() && (args.operation != Operation::Usage) &&
+	    (args.operation != Operation::Identify) &&
+	    (args.operation != Operation::Extract) &&
+	    (args.operation != Operation::Build) &&
+	    (args.operation != Operation::Merge) &&
+	    (args.operation != Operation::Manifest))
 		throw std::invalid_argument{"Must provide path to "
 		     "configuration directory"};
+	if (args.templateArchive.empty() &&
+	    (args.operation == Operation::Extract))
+		throw std::invalid_argument{"Must provide path to template "
+		    "archive (--template-archive)"};
+	if (((args.order == Order::Probe) ||
+	    (args.order == Order::Reference)) &&
+	    (args.operation != Operation::Compare))
+		throw std::invalid_argument{"Probe and reference order "
+		    "(--order) apply only to comparisons (-c)"};
+	if ((args.order == Order::Cost) &&
+	    (args.operation != Operation::Create) &&
+	    (args.operation != Operation::Compare) &&
+	    (args.operation != Operation::Stream))
+		throw std::invalid_argument{"Cost order (--order) applies "
+		    "only to creation (-e), comparison (-c), and streaming "
+		    "(-s)"};
+	if ((args.shardCount > 1) && (args.operation != Operation::Create) &&
+	    (args.operation != Operation::Compare))
+		throw std::invalid_argument{"Shard (--shard) applies only to "
+		    "creation (-e) and comparison (-c)"};
+	if (args.resume && (args.operation != Operation::Create) &&
+	    (args.operation != Operation::Compare))
+		throw std::invalid_argument{"Resume (--resume) applies only to "
+		    "creation (-e) and comparison (-c)"};
+	if (args.supervise && (args.operation != Operation::Create) &&
+	    (args.operation != Operation::Compare))
+		throw std::invalid_argument{"Supervision (--timeout, --retries) "
+		    "applies only to creation (-e) and comparison (-c)"};
+	if ((args.progressInterval.count() != 0) &&
+	    (args.operation != Operation::Create) &&
+	    (args.operation != Operation::Compare) &&
+	    (args.operation != Operation::Stream))
+		throw std::invalid_argument{"Progress (--progress) applies "
+		    "only to creation (-e), comparison (-c), and streaming "
+		    "(-s)"};
+	if ((args.pinning != Pinning::None) &&
+	    (args.operation != Operation::Create) &&
+	    (args.operation != Operation::Compare) &&
+	    (args.operation != Operation::Stream))
+		throw std::invalid_argument{"Pinning (--pin) applies only to "
+		    "creation (-e), comparison (-c), and streaming (-s)"};
+	if (args.supervise && (args.numThreads > 1))
+		throw std::invalid_argument{"Cannot supervise (--timeout, "
+		    "--retries) threads (-t), only processes (-f)"};
+	/* Supervised items must be in progress on one stage at a time */
+	if (args.supervise && (args.pipelineDepth != 0))
+		throw std::invalid_argument{"Cannot combine supervision "
+		    "(--timeout, --retries) with pipelining (--pipeline-depth)"};
+	/* Templates pass between workers in memory */
+	if ((args.operation == Operation::Stream) && (args.numProcs > 1))
+		throw std::invalid_argument{"Cannot stream (-s) in processes "
+		    "(-f), only threads (-t)"};
+	if ((args.operation == Operation::Stream) &&
+	    (args.pipelineDepth != 0))
+		throw std::invalid_argument{"Cannot combine streaming (-s) "
+		    "with pipelining (--pipeline-depth)"};
+	if ((args.operation == Operation::Stream) &&
+	    (args.preloadTemplates || args.sharedTemplates))
+		throw std::invalid_argument{"Streamed templates are already "
+		    "in memory, so --preload and --shared-templates do not "
+		    "apply to streaming (-s)"};
+	if (args.keepTemplates && (args.operation != Operation::Stream))
+		throw std::invalid_argument{"Keeping templates "
+		    "(--keep-templates) applies only to streaming (-s)"};
+	if ((args.operation == Operation::Stream) && !args.keepTemplates &&
+	    !args.templateArchive.empty())
+		throw std::invalid_argument{"Template archive "
+		    "(--template-archive) requires keeping templates "
+		    "(--keep-templates) when streaming (-s)"};
+	/* Each shard would truncate, then append to, the same archive */
+	if ((args.shardCount > 1) && (args.operation == Operation::Create) &&
+	    !args.templateArchive.empty())
+		throw std::invalid_argument{"Cannot combine shards (--shard) "
+		    "with creating a template archive (--template-archive)"};
+	if (!args.manifest.empty() && ((args.operation == Operation::Usage) ||
+	    (args.operation == Operation::Identify) ||
+	    (args.operation == Operation::Extract)))
+		throw std::invalid_argument{"Manifest (--manifest) does not "
+		    "apply to identification (-i) or extraction (-x)"};
+	if (args.imageCorpus.empty() && (args.operation == Operation::Build))
+		throw std::invalid_argument{"Must provide path to image "
+		    "corpus (--image-corpus)"};
 
 	return (args);
 }
 
+PFTIII::FingerImage
+PFTIII::Validation::readImage(
+    const Dataset &dataset,
+    const uint64_t imageIndex)
+{
+	const auto name = dataset.getImageName(imageIndex);
+	const auto md = dataset.getImageMetadata(imageIndex);
+	return {md.width, md.height, md.ppi, readFile(ImageDir + "/" +
+	    std::string(name)), md.imp, md.frct, md.frgp};
+}
+
+std::vector<double>
+PFTIII::Validation::predictCosts(
+    const Dataset &dataset,
+    const Operation operation,
+    const std::string &costLog)
+{
+	if ((operation != Operation::Create) &&
+	    (operation != Operation::Compare))
+		throw std::runtime_error("Unsupported operation was sent to "
+		    "predictCosts()");
+	const bool creating{operation == Operation::Create};
+
+	/* Larger images hold more to extract and, later, to compare */
+	std::vector<double> sizes(dataset.getImageCount());
+	for (uint64_t i{0}; i < sizes.size(); ++i) {
+		const auto md = dataset.getImageMetadata(i);
+		sizes[i] = static_cast<double>(md.width) * md.height * md.ppi;
+	}
+	std::vector<double> costs{};
+	if (creating) {
+		costs = sizes;
+	} else {
+		costs.reserve(dataset.getPairCount());
+		for (uint64_t i{0}; i < dataset.getPairCount(); ++i) {
+			const auto [probe, reference] = dataset.getPair(i);
+			costs.push_back(sizes[probe] + sizes[reference]);
+		}
+	}
+	if (costLog.empty())
+		return (costs);
+
+	/* As in mergeLogs(), entries start with the quoted name(s) */
+	std::unordered_map<std::string, uint64_t> keys{};
+	for (uint64_t i{0}; i < costs.size(); ++i)
+		keys[getLogKey(dataset, operation, i)] = i;
+	const uint8_t keyColumns{static_cast<uint8_t>(creating ? 1 : 2)};
+	const std::string prefix{creating ? CreateLogPrefix :
+	    CompareLogPrefix};
+
+	/* Worker logs and merged logs (-m) alike */
+	std::vector<std::string> logs{};
+	if (std::filesystem::is_directory(costLog)) {
+		for (const auto &entry : std::filesystem::directory_iterator(
+		    costLog)) {
+			const auto name = entry.path().filename().string();
+			if (entry.is_regular_file() &&
+			    ((name == prefix + ".log") ||
+			    name.starts_with(prefix + "-")) &&
+			    name.ends_with(".log"))
+				logs.push_back(entry.path().string());
+		}
+	} else {
+		logs.push_back(costLog);
+	}
+
+	/* Elapsed time follows the name(s) */
+	std::vector<double> totals(costs.size());
+	std::vector<uint64_t> counts(costs.size());
+	for (const auto &log : logs) {
+		std::ifstream file{log};
+		std::string line{};
+		if (!file || !std::getline(file, line))
+			throw std::runtime_error("Could not read header of " +
+			    log);
+
+		while (std::getline(file, line)) {
+			std::string::size_type end{0};
+			for (uint8_t i{0}; (i < keyColumns) &&
+			    (end != std::string::npos); ++i)
+				end = line.find(',', (i == 0) ? 0 : end + 1);
+			const auto it = keys.find(line.substr(0, end));
+			if ((it == keys.end()) || (end == std::string::npos))
+				throw std::runtime_error("Unexpected entry in " +
+				    log + ": " + line);
+			try {
+				totals[it->second] += std::stod(line.substr(
+				    end + 1));
+			} catch (const std::exception&) {
+				throw std::runtime_error("No elapsed time in "
+				    "entry in " + log + ": " + line);
+			}
+			++counts[it->second];
+		}
+		if (file.bad())
+			throw std::runtime_error("Could not read " + log);
+	}
+
+	/* Put sizes of items without timings into the same units */
+	double logged{0}, predicted{0};
+	for (uint64_t i{0}; i < costs.size(); ++i) {
+		if (counts[i] == 0)
+			continue;
+		totals[i] /= static_cast<double>(counts[i]);
+		logged += totals[i];
+		predicted += costs[i];
+	}
+	if (predicted == 0)
+		throw std::runtime_error("No " + prefix + " timings found in " +
+		    costLog);
+	const double scale{logged / predicted};
+	for (uint64_t i{0}; i < costs.size(); ++i)
+		costs[i] = ((counts[i] != 0) ? totals[i] : (costs[i] * scale));
+
+	return (costs);
+}
+
+std::vector<uint64_t>
+PFTIII::Validation::orderByCost(
+    const Dataset &dataset,
+    const Operation operation,
+    const std::string &costLog,
+    const uint32_t shardCount,
+    const uint64_t seed)
+{
+	const auto costs = predictCosts(dataset, operation, costLog);
+
+	/* Shuffle first, so the stable sort randomizes ties */
+	const Permutation shuffled{costs.size(), seed};
+	std::vector<uint64_t> sorted(costs.size());
+	for (uint64_t i{0}; i < costs.size(); ++i)
+		sorted[i] = shuffled[i];
+	std::stable_sort(sorted.begin(), sorted.end(),
+	    [&costs](const uint64_t lhs, const uint64_t rhs) {
+		return (costs[lhs] > costs[rhs]);
+	    });
+
+	/*
+	 * Deal to shards in turn. The first size % shardCount shards
+	 * receive one more, as getShard() expects.
+	 */
+	std::vector<uint64_t> indicies{};
+	indicies.reserve(sorted.size());
+	for (uint32_t shard{0}; shard < shardCount; ++shard)
+		for (uint64_t i{shard}; i < sorted.size(); i += shardCount)
+			indicies.push_back(sorted[i]);
+	return (indicies);
+}
+
 std::vector<uint64_t>
-PFTIII::Validation::randomizeIndicies(
-    const uint64_t size,
+PFTIII::Validation::orderPairs(
+    const Dataset &dataset,
+    const Order order,
+    const uint64_t tileSize,
     const uint64_t seed)
 {
-	std::vector<uint64_t> indicies(size);
+	if ((order != Order::Probe) && (order != Order::Reference))
+		throw std::invalid_argument("orderPairs() requires probe or "
+		    "reference order");
+
+	/* Rank the templates on each side of the pairs randomly */
+	const auto rank = [&dataset, &seed](const auto &side) {
+		std::unordered_map<uint64_t, uint64_t> ranks{};
+		for (uint64_t i{0}; i < dataset.getPairCount(); ++i)
+			ranks.try_emplace(side(dataset.getPair(i)),
+			    ranks.size());
+		const Permutation shuffled{ranks.size(), seed};
+
+		std::vector<uint64_t> ranked(dataset.getPairCount());
+		for (uint64_t i{0}; i < ranked.size(); ++i)
+			ranked[i] = shuffled[ranks.at(side(dataset.getPair(
+			    i)))];
+		return (ranked);
+	};
+	auto grouped = rank([](const auto &pair) {
+		return (std::get<0>(pair));
+	});
+	auto other = rank([](const auto &pair) {
+		return (std::get<1>(pair));
+	});
+	if (order == Order::Reference)
+		std::swap(grouped, other);
+
+	/* Tile by the other side, then group, then the other side */
+	const auto key = [&](const uint64_t i) {
+		return (std::make_tuple((tileSize == 0) ? 0 :
+		    (other[i] / tileSize), grouped[i], other[i]));
+	};
+	std::vector<uint64_t> indicies(dataset.getPairCount());
 	std::iota(indicies.begin(), indicies.end(), 0);
-	std::shuffle(indicies.begin(), indicies.end(), std::mt19937_64(seed));
+	std::sort(indicies.begin(), indicies.end(),
+	    [&key](const uint64_t lhs, const uint64_t rhs) {
+		return (key(lhs) < key(rhs));
+	    });
 	return (indicies);
 }
 
 std::vector<std::byte>
-PFTIII::Validation::readFile(
-    const std::string &pathName)
+PFTIII::Validation::readTemplate(
+    const std::string &name)
 {
-	std::ifstream file{pathName,
-	    std::ifstream::ate | std::ifstream::binary};
-	if (!file)
-		throw std::runtime_error{"Could not open " + pathName};
-	file.unsetf(std::ifstream::skipws);
+	return (readFile(TemplateDir + "/" + name + TemplateSuffix));
+}
 
-	const auto size = file.tellg();
-	if (size == -1)
-		throw std::runtime_error{"Could not open " + pathName};
+void
+PFTIII::Validation::writeTemplate(
+    const std::string &name,
+    const std::vector<std::byte> &data)
+{
+	writeFile(data, TemplateDir + "/" + name + TemplateSuffix);
+}
+
+void
+PFTIII::Validation::extractArchive(
+    const std::string &templateArchive)
+{
+	const TemplateArchiveReader archive{templateArchive};
+
+	makeDirectory(OutputDir);
+	makeDirectory(TemplateDir);
+	for (const auto &name : archive.getNames())
+		writeTemplate(name, archive.read(name));
+}
 
-	std::vector<std::byte> buf{};
-	buf.resize(static_cast<decltype(buf)::size_type>(size));
+void
+PFTIII::Validation::buildCorpus(
+    const Dataset &dataset,
+    const std::string &imageCorpus)
+{
+	buildImageCorpus(imageCorpus, dataset,
+	    [](const std::string &name) {
+		return (readFile(ImageDir + "/" + name));
+	});
+}
+
+std::string
+PFTIII::Validation::getWorkerID(
+    const Arguments &args)
+{
+	if (args.shardCount <= 1)
+		return (ts(getpid()));
+	return ("shard" + ts(args.shardIndex) + "of" + ts(args.shardCount) +
+	    "-" + ts(getpid()));
+}
 
-	file.seekg(std::ifstream::beg);
-	file.read(reinterpret_cast<char*>(buf.data()), size);
+std::tuple<std::string, std::string>
+PFTIII::Validation::getLogPathNames(
+    const Operation operation,
+    const std::string &workerID)
+{
+	const std::string prefix{(operation == Operation::Create) ?
+	    CreateLogPrefix : CompareLogPrefix};
 
-	return (buf);
+	/* Checkpoint names must not match the logs validate merges */
+	return {OutputDir + "/" + prefix + "-" + workerID + ".log",
+	    CheckpointDir + "/" + prefix + "/" + workerID + ".ckpt"};
+}
+
+std::vector<std::string>
+PFTIII::Validation::getCheckpointedWorkers(
+    const Arguments &args)
+{
+	const std::filesystem::path directory{CheckpointDir + "/" +
+	    ((args.operation == Operation::Create) ? CreateLogPrefix :
+	    CompareLogPrefix)};
+	if (!std::filesystem::exists(directory))
+		return {};
+
+	/* Worker IDs of unsharded runs are bare process IDs */
+	const std::string shard{(args.shardCount > 1) ?
+	    "shard" + ts(args.shardIndex) + "of" + ts(args.shardCount) + "-" :
+	    ""};
+	std::vector<std::string> workerIDs{};
+	for (const auto &entry : std::filesystem::directory_iterator(
+	    directory)) {
+		if (!entry.is_regular_file() ||
+		    (entry.path().extension() != ".ckpt"))
+			continue;
+		const auto workerID = entry.path().stem().string();
+		if (shard.empty() ? !workerID.starts_with("shard") :
+		    workerID.starts_with(shard))
+			workerIDs.push_back(workerID);
+	}
+	std::sort(workerIDs.begin(), workerIDs.end());
+
+	return (workerIDs);
+}
+
+bool
+PFTIII::Validation::mergeLogs(
+    const Dataset &dataset,
+    const Operation operation)
+{
+	if ((operation != Operation::Create) &&
+	    (operation != Operation::Compare))
+		throw std::runtime_error("Unsupported operation was sent to "
+		    "mergeLogs()");
+
+	/* Every log entry starts with the quoted name(s) of its item */
+	std::unordered_map<std::string, uint64_t> counts{};
+	const uint64_t itemCount{(operation == Operation::Create) ?
+	    dataset.getImageCount() : dataset.getPairCount()};
+	for (uint64_t i{0}; i < itemCount; ++i)
+		counts[getLogKey(dataset, operation, i)] = 0;
+	const uint8_t keyColumns{static_cast<uint8_t>(
+	    (operation == Operation::Create) ? 1 : 2)};
+	const std::string prefix{(operation == Operation::Create) ?
+	    CreateLogPrefix : CompareLogPrefix};
+
+	std::vector<std::string> logs{};
+	for (const auto &entry : std::filesystem::directory_iterator(
+	    OutputDir)) {
+		const auto name = entry.path().filename().string();
+		if (entry.is_regular_file() &&
+		    name.starts_with(prefix + "-") && name.ends_with(".log"))
+			logs.push_back(entry.path().string());
+	}
+	if (logs.empty())
+		return (false);
+	std::sort(logs.begin(), logs.end());
+
+	std::string header{};
+	std::vector<std::string> lines{};
+	for (const auto &log : logs) {
+		std::ifstream file{log};
+		std::string line{};
+		if (!file || !std::getline(file, line))
+			throw std::runtime_error("Could not read header of " +
+			    log);
+		if (header.empty())
+			header = line;
+		else if (line != header)
+			throw std::runtime_error("Header of " + log + " "
+			    "differs from header of " + logs.front());
+
+		while (std::getline(file, line)) {
+			std::string::size_type end{0};
+			for (uint8_t i{0}; (i < keyColumns) &&
+			    (end != std::string::npos); ++i)
+				end = line.find(',', (i == 0) ? 0 : end + 1);
+			const auto it = counts.find(line.substr(0, end));
+			if (it == counts.end())
+				throw std::runtime_error("Unexpected entry in " +
+				    log + ": " + line);
+			++it->second;
+			lines.push_back(std::move(line));
+		}
+		if (file.bad())
+			throw std::runtime_error("Could not read " + log);
+	}
+
+	uint64_t missing{0}, repeated{0};
+	for (const auto &[key, count] : counts) {
+		if (count == 0)
+			++missing;
+		else if (count > 1)
+			++repeated;
+	}
+	if ((missing != 0) || (repeated != 0))
+		throw std::runtime_error(ts(logs.size()) + " " + prefix +
+		    " logs are incomplete: " + ts(missing) + " of " +
+		    ts(counts.size()) + " entries missing and " +
+		    ts(repeated) + " repeated. Check that every shard "
+		    "(--shard) ran to completion with the same seed (-r), "
+		    "and that logs from earlier runs were removed.");
+
+	std::sort(lines.begin(), lines.end());
+	const std::string merged{OutputDir + "/" + prefix + ".log"};
+	std::ofstream file{merged, std::ofstream::trunc};
+	file << header << '\n';
+	for (const auto &line : lines)
+		file << line << '\n';
+	if (!file)
+		throw std::runtime_error("Could not write " + merged);
+
+	return (true);
 }
 
 void
-PFTIII::Validation::runCreate(
-    std::shared_ptr<Interface> impl,
-    const std::vector<uint64_t> &indicies)
+PFTIII::Validation::makeDirectory(
+    const std::string &pathName)
 {
-	if (mkdir(TemplateDir.c_str(), S_IRWXU | S_IRWXG) != 0) {
+	if (mkdir(pathName.c_str(), S_IRWXU | S_IRWXG) != 0) {
 		if (errno != EEXIST) {
 			const std::system_error error{errno,
 			    std::system_category()};
 			throw std::runtime_error("Could not create directory " +
-			    TemplateDir + " (" + error.code().message() + ")");
+			    pathName + " (" + error.code().message() + ")");
 		}
 	}
+}
 
-	std::ofstream file{OutputDir + "/createProprietaryTemplate-" +
-	    std::to_string(getpid()) + ".log"};
-	if (!file)
-		throw std::runtime_error(std::to_string(getpid()) + ": Error "
-		    "creating log file");
+std::vector<std::byte>
+PFTIII::Validation::readFile(
+    const std::string &pathName)
+{
+	/* Copy straight from the page cache, without zero-filling first */
+	const MappedFile file{pathName, Advice::Sequential};
+	const auto data = file.getData();
+	return {data.begin(), data.end()};
+}
 
-	static const std::string header{"name,elapsed,fisCode,\"fisMessage\","
-	    "cptrResult,\"cptrMessage\",size"};
-	file << header << '\n';
-	if (!file)
-		throw std::runtime_error(std::to_string(getpid()) + ": Error "
-		    "writing to log");
+void
+PFTIII::Validation::runStream(
+    std::shared_ptr<Interface> impl,
+    const Dataset &dataset,
+    StreamScheduler &scheduler,
+    const ImageLoader &images,
+    const std::string &templateArchive,
+    const bool keepTemplates,
+    const Worker &worker)
+{
+	if (worker.placement)
+		applyPlacement(*worker.placement);
+
+	/* As in runCreate(), each worker appends through its own descriptor */
+	std::unique_ptr<TemplateArchiveWriter> archive{};
+	TemplateWriter writer{};
+	if (keepTemplates && templateArchive.empty()) {
+		writer = writeTemplate;
+	} else if (keepTemplates) {
+		archive = std::make_unique<TemplateArchiveWriter>(
+		    templateArchive);
+		writer = [&archive](const std::string &name,
+		    const std::vector<std::byte> &data) {
+			archive->append(name, data);
+		};
+	}
+
+	const auto [createLogPathName, createCheckpointPathName] =
+	    getLogPathNames(Operation::Create, worker.id);
+	CheckpointedLog createLog{createLogPathName, createCheckpointPathName,
+	    CreateLogHeader, worker.checkpointInterval};
+	const auto [compareLogPathName, compareCheckpointPathName] =
+	    getLogPathNames(Operation::Compare, worker.id);
+	CheckpointedLog compareLog{compareLogPathName,
+	    compareCheckpointPathName, CompareLogHeader,
+	    worker.checkpointInterval};
+
+	while (const auto task = scheduler.next()) {
+		switch (task->kind) {
+		case StreamScheduler::Task::Kind::Create: {
+			const auto image = images(task->index);
+			worker.status.begin(task->index);
+			const auto name = dataset.getImageName(task->index);
+			auto [logLine, proprietaryTemplate] = create(impl,
+			    name, image);
+			worker.status.returned();
+
+			if (writer)
+				writer(std::string(name), proprietaryTemplate);
+			createLog.append(task->index, logLine);
+			scheduler.created(task->index, std::make_shared<
+			    const std::vector<std::byte>>(std::move(
+			    proprietaryTemplate)));
+			break;
+		}
+		case StreamScheduler::Task::Kind::Compare: {
+			const auto [probeName, referenceName] =
+			    dataset.getPairNames(task->index);
+			worker.status.begin(task->index);
+			const auto logLine = compare(impl, probeName,
+			    referenceName, *task->probe, *task->reference);
+			worker.status.returned();
+
+			compareLog.append(task->index, logLine);
+			scheduler.compared(task->index);
+			break;
+		}
+		}
+		worker.status.end(task->index);
+	}
+	createLog.save();
+	compareLog.save();
+}
 
-	for (const auto &n : indicies) {
-		file << create(impl, n) << '\n';
-		if (!file)
-			throw std::runtime_error(std::to_string(getpid()) + ": "
-			    "Error writing to log");
+void
+PFTIII::Validation::runCreate(
+    std::shared_ptr<Interface> impl,
+    const Dataset &dataset,
+    const Permutation &indicies,
+    WorkQueue &queue,
+    const ImageLoader &images,
+    const std::string &templateArchive,
+    const uint16_t pipelineDepth,
+    const Worker &worker)
+{
+	/* Each worker appends to the archive through its own descriptor */
+	std::unique_ptr<TemplateArchiveWriter> archive{};
+	TemplateWriter writer{writeTemplate};
+	if (templateArchive.empty()) {
+		makeDirectory(TemplateDir);
+	} else {
+		archive = std::make_unique<TemplateArchiveWriter>(
+		    templateArchive);
+		writer = [&archive](const std::string &name,
+		    const std::vector<std::byte> &data) {
+			archive->append(name, data);
+		};
 	}
+
+	const auto [logPathName, checkpointPathName] = getLogPathNames(
+	    Operation::Create, worker.id);
+	CheckpointedLog log{logPathName, checkpointPathName, CreateLogHeader,
+	    worker.checkpointInterval};
+
+	/* Image index and image */
+	using Input = std::tuple<uint64_t, FingerImage>;
+	/* Image index, log entry, and template */
+	using Output = std::tuple<uint64_t, std::string,
+	    std::vector<std::byte>>;
+	runPipeline<Input, Output>(queue, pipelineDepth,
+	    [&](const uint64_t position) -> Input {
+		return {indicies[position], images(indicies[position])};
+	    },
+	    [&](Input &input) -> Output {
+		worker.status.begin(std::get<0>(input));
+		auto [logLine, proprietaryTemplate] = create(impl,
+		    dataset.getImageName(std::get<0>(input)),
+		    std::get<1>(input));
+		worker.status.returned();
+		return {std::get<0>(input), std::move(logLine),
+		    std::move(proprietaryTemplate)};
+	    },
+	    [&](Output &output) {
+		writer(std::string(dataset.getImageName(std::get<0>(output))),
+		    std::get<2>(output));
+		log.append(std::get<0>(output), std::get<1>(output));
+		worker.status.end(std::get<0>(output));
+	    });
+	log.save();
 }
 
 void
 PFTIII::Validation::runCompare(
     std::shared_ptr<Interface> impl,
-    const std::vector<uint64_t> &indicies)
+    const Dataset &dataset,
+    const Permutation &indicies,
+    WorkQueue &queue,
+    TemplateCache &cache,
+    const uint16_t pipelineDepth,
+    const Worker &worker)
 {
-	std::ofstream file{OutputDir + "/compareProprietaryTemplates-" +
-	    std::to_string(getpid()) + ".log"};
-	if (!file)
-		throw std::runtime_error(std::to_string(getpid()) + ": Error "
-		    "creating log file");
+	const auto [logPathName, checkpointPathName] = getLogPathNames(
+	    Operation::Compare, worker.id);
+	CheckpointedLog log{logPathName, checkpointPathName,
+	    CompareLogHeader, worker.checkpointInterval};
+
+	/* Pairs index, probe template, and reference template */
+	using Input = std::tuple<uint64_t, TemplateCache::Template,
+	    TemplateCache::Template>;
+	/* Pairs index and log entry */
+	using Output = std::tuple<uint64_t, std::string>;
+	runPipeline<Input, Output>(queue, pipelineDepth,
+	    [&](const uint64_t position) -> Input {
+		const auto [probe, reference] = dataset.getPairNames(
+		    indicies[position]);
+		return {indicies[position], cache.get(std::string(probe)),
+		    cache.get(std::string(reference))};
+	    },
+	    [&](Input &input) -> Output {
+		const auto [probe, reference] = dataset.getPairNames(
+		    std::get<0>(input));
+		worker.status.begin(std::get<0>(input));
+		auto logLine = compare(impl, probe, reference,
+		    *std::get<1>(input), *std::get<2>(input));
+		worker.status.returned();
+		return {std::get<0>(input), std::move(logLine)};
+	    },
+	    [&](Output &output) {
+		log.append(std::get<0>(output), std::get<1>(output));
+		worker.status.end(std::get<0>(output));
+	    });
+	log.save();
+}
 
-	static const std::string header{"\"probeName\",\"referenceName\","
-	    "elapsed,rCode,\"rMessage\",similarity"};
-	file << header << '\n';
-	if (!file)
-		throw std::runtime_error(std::to_string(getpid()) + ": Error "
-		    "writing to log");
+void
+PFTIII::Validation::runOperation(
+    std::shared_ptr<Interface> impl,
+    const Arguments &args,
+    const Dataset &dataset,
+    const Permutation &indicies,
+    WorkQueue &queue,
+    const ImageLoader &images,
+    TemplateCache &cache,
+    const Worker &worker)
+{
+	if (worker.placement)
+		applyPlacement(*worker.placement);
+
+	switch (args.operation) {
+	case Operation::Create:
+		runCreate(impl, dataset, indicies, queue, images,
+		    args.templateArchive, args.pipelineDepth, worker);
+		break;
+	case Operation::Compare:
+		runCompare(impl, dataset, indicies, queue, cache,
+		    args.pipelineDepth, worker);
+		break;
+	default:
+		throw std::runtime_error("Unsupported operation was sent to "
+		    "runOperation()");
+	}
+}
 
-	for (const auto &n : indicies) {
-		file << compare(impl, n) << '\n';
-		if (!file)
-			throw std::runtime_error(std::to_string(getpid()) + ": "
-			    "Error writing to log");
+void
+PFTIII::Validation::runThreads(
+    const std::vector<std::shared_ptr<Interface>> &impls,
+    const Arguments &args,
+    const Dataset &dataset,
+    const Permutation &indicies,
+    WorkQueue &queue,
+    const ImageLoader &images,
+    TemplateCache &cache,
+    const std::vector<Worker> &workers)
+{
+	const uint8_t numThreads{args.numThreads};
+	if (impls.empty())
+		throw std::invalid_argument("No implementations provided to "
+		    "runThreads()");
+	if (workers.size() != numThreads)
+		throw std::invalid_argument("Number of workers provided to "
+		    "runThreads() differs from number of threads");
+
+	std::vector<std::exception_ptr> errors(numThreads);
+	std::vector<std::thread> threads{};
+	threads.reserve(numThreads);
+	for (uint8_t i{0}; i < numThreads; ++i) {
+		threads.emplace_back([&, i]() {
+			try {
+				runOperation(impls[i % impls.size()], args,
+				    dataset, indicies, queue, images, cache,
+				    workers[i]);
+			} catch (...) {
+				errors[i] = std::current_exception();
+			}
+		});
 	}
+	for (auto &thread : threads)
+		thread.join();
+
+	for (const auto &error : errors)
+		if (error)
+			std::rethrow_exception(error);
 }
 
 std::string
@@ -405,40 +1409,116 @@ PFTIII::Validation::sanitizeMessage(
 	return (wrapInQuotes ? '"' + sanitized + '"' : sanitized);
 }
 
-std::vector<std::vector<uint64_t>>
-PFTIII::Validation::splitSet(
-    const std::vector<uint64_t> &combinedSet,
-    const uint8_t numSets)
+void
+PFTIII::Validation::superviseProcesses(
+    std::shared_ptr<Interface> impl,
+    const Arguments &args,
+    const Dataset &dataset,
+    const Permutation &indicies,
+    WorkQueue &queue,
+    const ImageLoader &images,
+    TemplateCache &cache,
+    WorkerStatusTable &statuses,
+    const std::function<std::string(const uint8_t worker,
+        const std::string &suffix)> &workerID,
+    const std::vector<std::optional<Placement>> &placements,
+    const TickHandler &onTick)
 {
-	if (numSets == 0)
-		return {};
-	if (numSets == 1)
-		return {combinedSet};
-
-	using diff_t = decltype(combinedSet.begin())::difference_type;
-	if (combinedSet.size() >
-	    static_cast<uint64_t>(std::numeric_limits<diff_t>::max()))
-		return {combinedSet};
-
-	const std::vector<uint64_t>::size_type size{static_cast<
-	    std::vector<uint64_t>::size_type>(
-	    std::ceil(static_cast<float>(combinedSet.size()) /
-	    static_cast<float>(numSets)))};
-	if (size < numSets)
-		throw std::invalid_argument("Too many sets.");
-
-	std::vector<std::vector<uint64_t>> sets{};
-	sets.reserve(numSets);
-	for (uint8_t i{0}; i < numSets; ++i) {
-
-		sets.emplace_back(std::next(combinedSet.begin(),
-		    static_cast<diff_t>(size * i)),
-		    std::next(combinedSet.begin(),
-		    static_cast<diff_t>(std::min(size * (i + 1u),
-		    combinedSet.size()))));
-	}
+	/* Identifiers are chosen before fork() so the parent knows them */
+	std::unordered_map<pid_t, std::string> workerIDs{};
+	uint64_t spawned{0};
+	const auto spawn = [&](const uint8_t worker,
+	    const std::optional<uint64_t> retry) -> pid_t {
+		const auto id = workerID(worker, "-" + ts(spawned++));
+		const auto pid = fork();
+		switch (pid) {
+		case 0:		/* Child */
+			break;
+		case -1:	/* Error */
+			throw std::runtime_error("Error during fork()");
+		default:	/* Parent */
+			workerIDs[pid] = id;
+			return (pid);
+		}
 
-	return (sets);
+		/* Save after every item, so a killed worker loses nothing */
+		const Worker self{id, statuses[worker],
+		    std::chrono::seconds{0}, placements[worker]};
+		try {
+			/* Retry the item alone, then rejoin the others */
+			if (retry) {
+				WorkQueue single{0, 1};
+				runOperation(impl, args, dataset, Permutation{
+				    std::vector<uint64_t>{*retry}}, single,
+				    images, cache, self);
+			}
+			runOperation(impl, args, dataset, indicies, queue,
+			    images, cache, self);
+		} catch (const std::exception &e) {
+			std::cerr << e.what() << '\n';
+			std::exit(EXIT_FAILURE);
+		} catch (...) {
+			std::cerr << "Caught unknown exception\n";
+			std::exit(EXIT_FAILURE);
+		}
+		std::exit(EXIT_SUCCESS);
+	};
+
+	const bool creating{args.operation == Operation::Create};
+	const std::string incidentsPathName{OutputDir + "/incidents-" +
+	    (creating ? CreateLogPrefix : CompareLogPrefix) + "-" +
+	    getWorkerID(args) + ".log"};
+	std::ofstream incidents{};
+	const auto onIncident = [&](const Incident &incident) {
+		/* Cut anything the lost worker logged but did not save */
+		const auto [logPathName, checkpointPathName] = getLogPathNames(
+		    args.operation, workerIDs.at(incident.pid));
+		if (std::filesystem::exists(checkpointPathName))
+			restoreCheckpoint(logPathName, checkpointPathName);
+		workerIDs.erase(incident.pid);
+
+		if (!incidents.is_open()) {
+			incidents.open(incidentsPathName);
+			incidents << (creating ? "name," :
+			    "\"probeName\",\"referenceName\",") <<
+			    "incident,\"detail\",attempt,action\n";
+		}
+		incidents << getLogKey(dataset, args.operation,
+		    incident.item) << ',';
+		switch (incident.kind) {
+		case Incident::Kind::Timeout:
+			incidents << "timeout,";
+			break;
+		case Incident::Kind::Signal:
+			incidents << "signal,";
+			break;
+		case Incident::Kind::Exit:
+			incidents << "exit,";
+			break;
+		}
+		incidents << sanitizeMessage(incident.detail) << ',' <<
+		    ts(incident.attempt) << ',' << (incident.retrying ?
+		    "retry" : "abandon") << std::endl;
+		if (!incidents)
+			throw std::runtime_error("Could not write to " +
+			    incidentsPathName);
+	};
+
+	const auto result = superviseWorkers(statuses, queue,
+	    args.callTimeout, args.maxRetries, spawn, onIncident, onTick);
+	if (result.failed != 0)
+		throw std::runtime_error(ts(result.failed) + " processes "
+		    "failed while not processing an item. Completed work is "
+		    "checkpointed, so run again with --resume to continue.");
+	if (result.gaveUp)
+		throw std::runtime_error("Stopped replacing processes after " +
+		    ts(result.abandoned) + " items were lost in a row without "
+		    "any finishing (see " + incidentsPathName + ").");
+	if (result.abandoned != 0)
+		throw std::runtime_error(ts(result.abandoned) + " items were "
+		    "abandoned after losing their workers (see " +
+		    incidentsPathName + "). Completed work is checkpointed, "
+		    "so run again with --resume to retry them.");
 }
 
 void
@@ -450,55 +1530,210 @@ PFTIII::Validation::testOperation(
 		throw std::runtime_error("Unsupported operation was sent to "
 		    "testOperation()");
 
-	if (mkdir(OutputDir.c_str(), S_IRWXU | S_IRWXG) != 0) {
-		if (errno != EEXIST) {
-			const std::system_error error{errno,
-			    std::system_category()};
-			throw std::runtime_error("Could not create directory " +
-			    OutputDir + " (" + error.code().message() + ")");
-		}
-	}
+	makeDirectory(OutputDir);
+	makeDirectory(CheckpointDir);
+	makeDirectory(CheckpointDir + "/" + ((args.operation ==
+	    Operation::Create) ? CreateLogPrefix : CompareLogPrefix));
 
 	const auto impl = PFTIII::Interface::getImplementation(args.configDir);
+	checkIdentification(impl);
+
+	/* Opened before fork(), so children share a mapped manifest */
+	const auto dataset = Dataset::open(args.manifest);
 	const auto containerSize = (args.operation == Operation::Create ?
-	    Data::Images.size() : Data::Pairs.size());
-	const auto indicies = randomizeIndicies(containerSize, args.randomSeed);
+	    dataset->getImageCount() : dataset->getPairCount());
+	auto indicies = (args.order == Order::Random ?
+	    Permutation{containerSize, args.randomSeed} :
+	    Permutation{(args.order == Order::Cost) ?
+	    orderByCost(*dataset, args.operation, args.costLog,
+	    args.shardCount, args.randomSeed) : orderPairs(*dataset,
+	    args.order, args.tileSize, args.randomSeed)});
+	auto [first, last] = getShard(indicies.size(), args.shardIndex,
+	    args.shardCount);
+
+	/*
+	 * Workers of this run append to the logs of an interrupted run,
+	 * skipping whatever those logs already hold. Otherwise, stale
+	 * checkpoints are discarded.
+	 */
+	std::vector<std::string> resumedIDs{};
+	std::unordered_set<uint64_t> completed{};
+	for (const auto &workerID : getCheckpointedWorkers(args)) {
+		const auto [logPathName, checkpointPathName] = getLogPathNames(
+		    args.operation, workerID);
+		if (!args.resume) {
+			std::filesystem::remove(checkpointPathName);
+			continue;
+		}
 
-	if (args.numProcs <= 1) {
-		switch (args.operation) {
-		case Operation::Create:
-			runCreate(impl, indicies);
-			break;
-		case Operation::Compare:
-			runCompare(impl, indicies);
-			break;
-		default:
-			throw std::runtime_error("Unsupported operation was "
-			    "sent to testOperation()");
-			break;
+		const auto done = restoreCheckpoint(logPathName,
+		    checkpointPathName);
+		if (!done)
+			continue;
+		resumedIDs.push_back(workerID);
+		completed.insert(done->cbegin(), done->cend());
+	}
+	if (!completed.empty()) {
+		std::vector<uint64_t> remaining{};
+		for (uint64_t i{first}; i < last; ++i)
+			if (!completed.contains(indicies[i]))
+				remaining.push_back(indicies[i]);
+		indicies = Permutation{std::move(remaining)};
+		first = 0;
+		last = indicies.size();
+	}
+	const auto workerID = [&](const uint8_t worker,
+	    const std::string &suffix) -> std::string {
+		if (worker < resumedIDs.size())
+			return (resumedIDs[worker]);
+		return (getWorkerID(args) + suffix);
+	};
+
+	/*
+	 * Workers claim chunks of this shard's slice of indicies from a
+	 * cursor shared by all, until SIGTERM drains it. Cost-ordered
+	 * items are claimed singly, so the most costly spread across all
+	 * workers.
+	 */
+	const uint8_t numWorkers{std::max(args.numProcs, args.numThreads)};
+	WorkQueue queue{first, last, (args.supervise ||
+	    (args.order == Order::Cost)) ? 1 :
+	    getChunkSize(last - first, numWorkers)};
+	const SignalDrain drain{queue};
+	const auto placements = placeWorkers(args, numWorkers,
+	    (args.operation == Operation::Create) ? CreateLogPrefix :
+	    CompareLogPrefix);
+
+	/*
+	 * Templates preloaded here are shared copy-on-write with forked
+	 * children. Otherwise, each process fills its own cache.
+	 */
+	std::unique_ptr<TemplateArchiveReader> archive{};
+	TemplateCache::Loader loader{readTemplate};
+	if (!args.templateArchive.empty()) {
+		if (args.operation == Operation::Create) {
+			if (!args.resume)
+				TemplateArchiveWriter::truncate(
+				    args.templateArchive);
+		} else {
+			archive = std::make_unique<TemplateArchiveReader>(
+			    args.templateArchive);
+			loader = [&archive](const std::string &name) {
+				return (archive->read(name));
+			};
 		}
-	} else {
-		/* Split into multiple sets of indicies */
-		const auto sets = splitSet(indicies, args.numProcs);
+	}
+
+	/* Templates in the order they will first be compared */
+	std::vector<std::string> names{};
+	if ((args.operation == Operation::Compare) &&
+	    (args.preloadTemplates || args.sharedTemplates)) {
+		std::unordered_set<std::string> seen{};
+		for (uint64_t i{first}; i < last; ++i) {
+			const auto [probe, reference] = dataset->getPairNames(
+			    indicies[i]);
+			for (const auto &name : {std::string(probe),
+			    std::string(reference)})
+				if (seen.insert(name).second)
+					names.push_back(name);
+		}
+	}
 
+	/*
+	 * Every process maps the same copy of a shared store, so caching
+	 * its templates would only duplicate them.
+	 */
+	std::unique_ptr<SharedTemplateStore> store{};
+	uint64_t cacheSize{args.templateCacheSize};
+	if ((args.operation == Operation::Compare) && args.sharedTemplates) {
+		store = std::make_unique<SharedTemplateStore>(names, loader);
+		loader = [&store](const std::string &name) {
+			return (store->read(name));
+		};
+		cacheSize = 0;
+	}
+
+	TemplateCache cache{loader, cacheSize};
+	if ((args.operation == Operation::Compare) && args.preloadTemplates)
+		cache.preload(names);
+
+	/* As with the archive, forked children share the corpus reader */
+	std::unique_ptr<ImageCorpusReader> corpus{};
+	ImageLoader images{[&dataset](const uint64_t imageIndex) {
+		return (readImage(*dataset, imageIndex));
+	}};
+	if (!args.imageCorpus.empty() &&
+	    (args.operation == Operation::Create)) {
+		corpus = std::make_unique<ImageCorpusReader>(args.imageCorpus);
+		images = [&corpus, &dataset](const uint64_t imageIndex) {
+			return (corpus->read(std::string(
+			    dataset->getImageName(imageIndex))));
+		};
+	}
+
+	WorkerStatusTable statuses{numWorkers};
+	std::unique_ptr<ProgressReporter> progress{};
+	TickHandler onTick{};
+	if (args.progressInterval.count() != 0) {
+		progress = std::make_unique<ProgressReporter>(statuses,
+		    last - first, args.progressInterval);
+		onTick = [&progress]() {
+			progress->update();
+		};
+	}
+
+	/*
+	 * Forked workers are awaited by an event loop that ticks on its
+	 * own. Otherwise, this process is busy working or joining, so
+	 * another thread ticks.
+	 */
+	std::jthread ticker{};
+	if (onTick && !args.supervise && (args.numProcs <= 1))
+		ticker = startTicking(onTick);
+
+	if (args.supervise) {
+		superviseProcesses(impl, args, *dataset, indicies, queue,
+		    images, cache, statuses, workerID, placements, onTick);
+	} else if (args.numThreads > 1) {
+		std::vector<Worker> workers{};
+		for (uint8_t i{0}; i < args.numThreads; ++i)
+			workers.push_back({workerID(i, "-" + ts(i)),
+			    statuses[i], CheckpointedLog::DefaultInterval,
+			    placements[i]});
+
+		if (args.instancePerThread) {
+			/* impl becomes the first instance of the pool */
+			auto impls = getImplementationPool(args.configDir,
+			    static_cast<uint8_t>(args.numThreads - 1));
+			impls.insert(impls.begin(), impl);
+			runThreads(impls, args, *dataset, indicies, queue,
+			    images, cache, workers);
+		} else {
+			if (!impl->isReentrant())
+				throw std::runtime_error("Implementation is "
+				    "not reentrant (isReentrant() returned "
+				    "false), so threads (-t) require one "
+				    "implementation per thread (-p)");
+			runThreads({impl}, args, *dataset, indicies, queue,
+			    images, cache, workers);
+		}
+	} else if (args.numProcs <= 1) {
+		runOperation(impl, args, *dataset, indicies, queue, images,
+		    cache, {workerID(0, ""), statuses[0],
+		    CheckpointedLog::DefaultInterval, placements[0]});
+	} else {
 		/* Fork */
-		for (const auto &set : sets) {
+		std::vector<pid_t> children{};
+		for (uint8_t i{0}; i < args.numProcs; ++i) {
 			const auto pid = fork();
 			switch (pid) {
 			case 0:		/* Child */
 				try {
-					switch (args.operation) {
-					case Operation::Create:
-						runCreate(impl, set);
-						break;
-					case Operation::Compare:
-						runCompare(impl, set);
-						break;
-					default:
-						throw std::runtime_error(
-						    "Invalid operation sent to"
-						    "testOperation()");
-					}
+					runOperation(impl, args, *dataset,
+					    indicies, queue, images, cache,
+					    {workerID(i, ""), statuses[i],
+					    CheckpointedLog::DefaultInterval,
+					    placements[i]});
 				} catch (const std::exception &e) {
 					std::cerr << e.what() << '\n';
 					std::exit(EXIT_FAILURE);
@@ -515,49 +1750,210 @@ PFTIII::Validation::testOperation(
 				throw std::runtime_error("Error during "
 				    "fork()");
 			default:	/* Parent */
+				children.push_back(pid);
 				break;
 			}
 		}
 
-		waitForExit(args.numProcs);
+		const auto failures = waitForExit(children, onTick);
+		if (failures != 0)
+			throw std::runtime_error(ts(failures) + " of " +
+			    ts(args.numProcs) + " processes failed. Completed "
+			    "work is checkpointed, so run again with --resume "
+			    "to continue.");
 	}
+
+	ticker = {};
+	if (progress)
+		progress->finish();
+
+	if (queue.isDraining())
+		throw std::runtime_error("Stopped by SIGTERM. Completed work "
+		    "is checkpointed, so run again with --resume to "
+		    "continue.");
+
+	/* Every item is logged, so there is nothing left to resume */
+	for (const auto &id : getCheckpointedWorkers(args))
+		std::filesystem::remove(std::get<1>(getLogPathNames(
+		    args.operation, id)));
+	std::error_code ignored{};
+	std::filesystem::remove(CheckpointDir + "/" + ((args.operation ==
+	    Operation::Create) ? CreateLogPrefix : CompareLogPrefix),
+	    ignored);
+	std::filesystem::remove(CheckpointDir, ignored);
+}
+
+std::vector<std::optional<PFTIII::Validation::Placement>>
+PFTIII::Validation::placeWorkers(
+    const Arguments &args,
+    const uint8_t count,
+    const std::string &logPrefix)
+{
+	std::vector<std::optional<Placement>> placements(count);
+	if (args.pinning == Pinning::None)
+		return (placements);
+
+	/* Not named for logPrefix, which merging would take for a log */
+	const auto pinned = getPlacements(args.pinning, count,
+	    args.bindMemory);
+	writePlacements(OutputDir + "/placement-" + logPrefix + "-" +
+	    getWorkerID(args) + ".log", args.pinning, pinned);
+	std::copy(pinned.cbegin(), pinned.cend(), placements.begin());
+	return (placements);
 }
 
 void
-PFTIII::Validation::waitForExit(
-    const uint8_t numChildren)
-{
-	pid_t pid{-1};
-	bool stop{false};
-	uint8_t exitedChildren{0};
-	int status{};
-	while (exitedChildren != numChildren) {
-		stop = false;
-		while (!stop) {
-			pid = ::wait(&status);
-			switch (pid) {
-			case 0:		/* Status not available */
-				break;
-			case -1:	/* Delivery of signal */
-				switch (errno) {
-				case ECHILD:	/* No child processes remain */
-					stop = true;
-					break;
-				case EINTR:	/* Interruption, try again */
-					break;
-				default:
-					throw std::runtime_error{"Error while "
-					    "reaping: " + std::system_error(
-					        errno, std::system_category()).
-					        code().message()};
-				}
-				break;
-			default:	/* Child exited */
-				++exitedChildren;
-				break;
+PFTIII::Validation::streamOperation(
+    const Validation::Arguments &args)
+{
+	makeDirectory(OutputDir);
+	makeDirectory(CheckpointDir);
+	for (const auto &prefix : {CreateLogPrefix, CompareLogPrefix})
+		makeDirectory(CheckpointDir + "/" + prefix);
+
+	const auto impl = PFTIII::Interface::getImplementation(args.configDir);
+	checkIdentification(impl);
+
+	/* Images are created in the order creation (-e) would use */
+	const auto dataset = Dataset::open(args.manifest);
+	std::vector<uint64_t> createOrder{};
+	if (args.order == Order::Cost) {
+		createOrder = orderByCost(*dataset, Operation::Create,
+		    args.costLog, 1, args.randomSeed);
+	} else {
+		const Permutation shuffled{dataset->getImageCount(),
+		    args.randomSeed};
+		createOrder.reserve(shuffled.size());
+		for (uint64_t i{0}; i < shuffled.size(); ++i)
+			createOrder.push_back(shuffled[i]);
+	}
+
+	std::vector<std::tuple<uint64_t, uint64_t>> pairImages{};
+	pairImages.reserve(dataset->getPairCount());
+	for (uint64_t i{0}; i < dataset->getPairCount(); ++i)
+		pairImages.push_back(dataset->getPair(i));
+	StreamScheduler scheduler{createOrder, pairImages};
+
+	if (args.keepTemplates) {
+		if (args.templateArchive.empty())
+			makeDirectory(TemplateDir);
+		else
+			TemplateArchiveWriter::truncate(args.templateArchive);
+	}
+
+	std::unique_ptr<ImageCorpusReader> corpus{};
+	ImageLoader images{[&dataset](const uint64_t imageIndex) {
+		return (readImage(*dataset, imageIndex));
+	}};
+	if (!args.imageCorpus.empty()) {
+		corpus = std::make_unique<ImageCorpusReader>(args.imageCorpus);
+		images = [&corpus, &dataset](const uint64_t imageIndex) {
+			return (corpus->read(std::string(
+			    dataset->getImageName(imageIndex))));
+		};
+	}
+
+	const uint8_t numThreads{args.numThreads};
+	std::vector<std::shared_ptr<Interface>> impls{impl};
+	if ((numThreads > 1) && args.instancePerThread) {
+		auto pool = getImplementationPool(args.configDir,
+		    static_cast<uint8_t>(numThreads - 1));
+		impls.insert(impls.end(), pool.begin(), pool.end());
+	} else if ((numThreads > 1) && !impl->isReentrant()) {
+		throw std::runtime_error("Implementation is not reentrant "
+		    "(isReentrant() returned false), so threads (-t) require "
+		    "one implementation per thread (-p)");
+	}
+
+	/* Nothing is resumed, so stale checkpoints must not be continued */
+	WorkerStatusTable statuses{numThreads};
+	const auto placements = placeWorkers(args, numThreads, "stream");
+	std::vector<Worker> workers{};
+	for (uint8_t i{0}; i < numThreads; ++i) {
+		const auto id = getWorkerID(args) + "-" + ts(i);
+		for (const auto operation : {Operation::Create,
+		    Operation::Compare})
+			std::filesystem::remove(std::get<1>(getLogPathNames(
+			    operation, id)));
+		workers.push_back({id, statuses[i],
+		    CheckpointedLog::DefaultInterval, placements[i]});
+	}
+
+	std::unique_ptr<ProgressReporter> progress{};
+	TickHandler onTick{};
+	if (args.progressInterval.count() != 0) {
+		progress = std::make_unique<ProgressReporter>(statuses,
+		    dataset->getImageCount() + dataset->getPairCount(),
+		    args.progressInterval);
+		onTick = [&progress]() {
+			progress->update();
+		};
+	}
+	std::jthread ticker{};
+	if (onTick)
+		ticker = startTicking(onTick);
+
+	/* A failed worker stops the others, which would wait on it */
+	std::vector<std::exception_ptr> errors(numThreads);
+	std::vector<std::thread> threads{};
+	threads.reserve(numThreads);
+	for (uint8_t i{0}; i < numThreads; ++i) {
+		threads.emplace_back([&, i]() {
+			try {
+				runStream(impls[i % impls.size()], *dataset,
+				    scheduler, images, args.templateArchive,
+				    args.keepTemplates, workers[i]);
+			} catch (...) {
+				errors[i] = std::current_exception();
+				scheduler.abort();
 			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	ticker = {};
+
+	for (const auto &error : errors)
+		if (error)
+			std::rethrow_exception(error);
+	if (progress)
+		progress->finish();
+
+	std::error_code ignored{};
+	for (const auto &worker : workers)
+		for (const auto operation : {Operation::Create,
+		    Operation::Compare})
+			std::filesystem::remove(std::get<1>(getLogPathNames(
+			    operation, worker.id)), ignored);
+	for (const auto &prefix : {CreateLogPrefix, CompareLogPrefix})
+		std::filesystem::remove(CheckpointDir + "/" + prefix, ignored);
+	std::filesystem::remove(CheckpointDir, ignored);
+}
+
+uint8_t
+PFTIII::Validation::waitForExit(
+    const std::vector<pid_t> &children,
+    const TickHandler &onTick)
+{
+	ProcessMonitor monitor{std::chrono::seconds{1}};
+	for (const auto &child : children)
+		monitor.watch(child);
+
+	uint8_t failedChildren{0};
+	while (monitor.size() != 0) {
+		const auto exited = monitor.wait();
+		if (!exited) {
+			if (onTick)
+				onTick();
+			continue;
 		}
+
+		if (!WIFEXITED(exited->status) ||
+		    (WEXITSTATUS(exited->status) != EXIT_SUCCESS))
+			++failedChildren;
 	}
+
+	return (failedChildren);
 }
 
 void
@@ -586,9 +1982,9 @@ main(
 	int rv{EXIT_FAILURE};
 
 	if (!((PFTIII::API_MAJOR_VERSION == 1) &&
-	    (PFTIII::API_MINOR_VERSION == 1))) {
+	    (PFTIII::API_MINOR_VERSION == 3))) {
 		std::cerr << "Incompatible API version encountered.\n "
-		    "- Validation: 1.1.*\n - Participant: " <<
+		    "- Validation: 1.3.*\n - Participant: " <<
 		    PFTIII::API_MAJOR_VERSION << '.' <<
 		    PFTIII::API_MINOR_VERSION << '.' <<
 		    PFTIII::API_PATCH_VERSION << '\n';
@@ -611,13 +2007,13 @@ main(
 	case PFTIII::Validation::Operation::Identify:
 		try {
 			std::cout << PFTIII::Validation::
-			    getIdentificationString(args) << '\n';
+			    getIdentificationString() << '\n';
 			rv = EXIT_SUCCESS;
 		} catch (const std::exception &e) {
-			std::cerr << "Interface::getIdentification(): " <<
-			    e.what() << '\n';
+			std::cerr << "Interface::getSubmissionIdentification(): "
+			    << e.what() << '\n';
 		} catch (...) {
-			std::cerr << "Interface::getIdentification(): "
+			std::cerr << "Interface::getSubmissionIdentification(): "
 			    "Non-standard exception\n";
 		}
 		break;
@@ -645,6 +2041,77 @@ main(
 			    "Templates(): Non-standard exception\n";
 		}
 		break;
+	case PFTIII::Validation::Operation::Stream:
+		try {
+			PFTIII::Validation::streamOperation(args);
+			rv = EXIT_SUCCESS;
+		} catch (const std::exception &e) {
+			std::cerr << "Streaming templates: " << e.what() <<
+			    '\n';
+		} catch (...) {
+			std::cerr << "Streaming templates: Non-standard "
+			    "exception\n";
+		}
+		break;
+	case PFTIII::Validation::Operation::Extract:
+		try {
+			PFTIII::Validation::extractArchive(args.templateArchive);
+			rv = EXIT_SUCCESS;
+		} catch (const std::exception &e) {
+			std::cerr << "Extracting template archive: " <<
+			    e.what() << '\n';
+		} catch (...) {
+			std::cerr << "Extracting template archive: "
+			    "Non-standard exception\n";
+		}
+		break;
+	case PFTIII::Validation::Operation::Build:
+		try {
+			PFTIII::Validation::buildCorpus(
+			    *PFTIII::Validation::Dataset::open(args.manifest),
+			    args.imageCorpus);
+			rv = EXIT_SUCCESS;
+		} catch (const std::exception &e) {
+			std::cerr << "Building image corpus: " << e.what() <<
+			    '\n';
+		} catch (...) {
+			std::cerr << "Building image corpus: Non-standard "
+			    "exception\n";
+		}
+		break;
+	case PFTIII::Validation::Operation::Merge:
+		try {
+			const auto dataset = PFTIII::Validation::Dataset::open(
+			    args.manifest);
+			bool merged{false};
+			for (const auto operation : {
+			    PFTIII::Validation::Operation::Create,
+			    PFTIII::Validation::Operation::Compare})
+				if (PFTIII::Validation::mergeLogs(*dataset,
+				    operation))
+					merged = true;
+			if (!merged)
+				throw std::runtime_error("No logs found in " +
+				    PFTIII::Validation::OutputDir);
+			rv = EXIT_SUCCESS;
+		} catch (const std::exception &e) {
+			std::cerr << "Merging logs: " << e.what() << '\n';
+		} catch (...) {
+			std::cerr << "Merging logs: Non-standard exception\n";
+		}
+		break;
+	case PFTIII::Validation::Operation::Manifest:
+		try {
+			PFTIII::Validation::writeManifest(args.packedManifest,
+			    *PFTIII::Validation::Dataset::open(args.manifest));
+			rv = EXIT_SUCCESS;
+		} catch (const std::exception &e) {
+			std::cerr << "Writing manifest: " << e.what() << '\n';
+		} catch (...) {
+			std::cerr << "Writing manifest: Non-standard "
+			    "exception\n";
+		}
+		break;
 	case PFTIII::Validation::Operation::Usage:
 		std::cout << PFTIII::Validation::getUsageString(argv[0]) <<
 		    '\n';
@@ -11,14 +11,30 @@
 #ifndef PFTIII_VALIDATION_H_
 #define PFTIII_VALIDATION_H_
 
+#include <chrono>
+#include <functional>
 #include <iostream>
+#include <optional>
 #include <random>
 #include <string>
 #include <type_traits>
 #include <vector>
 
 #include <pftiii.h>
+#include <pftiii_validation_archive.h>
+#include <pftiii_validation_cache.h>
+#include <pftiii_validation_checkpoint.h>
+#include <pftiii_validation_corpus.h>
 #include <pftiii_validation_data.h>
+#include <pftiii_validation_dataset.h>
+#include <pftiii_validation_permutation.h>
+#include <pftiii_validation_pipeline.h>
+#include <pftiii_validation_placement.h>
+#include <pftiii_validation_progress.h>
+#include <pftiii_validation_scheduler.h>
+#include <pftiii_validation_store.h>
+#include <pftiii_validation_stream.h>
+#include <pftiii_validation_supervisor.h>
 
 namespace PFTIII
 {
@@ -33,10 +49,33 @@ namespace PFTIII
 			Compare,
 			/** Print library identification. */
 			Identify,
+			/** Write archived templates to individual files. */
+			Extract,
+			/** Pack validation imagery into an image corpus. */
+			Build,
+			/** Combine logs from all shards, checking coverage. */
+			Merge,
+			/** Create templates, comparing pairs once both exist. */
+			Stream,
+			/** Write the dataset as a binary manifest. */
+			Manifest,
 			/** Print usage. */
 			Usage
 		};
 
+		/** Orders in which comparisons can be performed. */
+		enum class Order
+		{
+			/** Uniformly shuffled, for timing. */
+			Random,
+			/** Each probe's candidates consecutively. */
+			Probe,
+			/** Each reference's candidates consecutively. */
+			Reference,
+			/** Most costly first, as predicted by predictCosts(). */
+			Cost
+		};
+
 		/** Arguments passed on the command line */
 		struct Arguments
 		{
@@ -47,30 +86,169 @@ namespace PFTIII
 			Operation operation{};
 			/** Number of processes to run. */
 			uint8_t numProcs{1};
+			/** Number of threads sharing one implementation. */
+			uint8_t numThreads{1};
+			/** Whether each thread gets its own implementation. */
+			bool instancePerThread{false};
+			/** Bytes of templates to cache when comparing. */
+			uint64_t templateCacheSize{256 * 1024 * 1024};
+			/** Whether to fill the template cache before comparing. */
+			bool preloadTemplates{false};
+			/**
+			 * Whether to load all templates into memory shared
+			 * by all processes before comparing, instead of
+			 * caching templates in each process.
+			 */
+			bool sharedTemplates{false};
+			/**
+			 * Template archive to write when creating and read
+			 * when comparing or extracting. When empty, each
+			 * template is a separate file in TemplateDir.
+			 */
+			std::string templateArchive{};
+			/**
+			 * Whether streaming (Operation::Stream) writes the
+			 * templates it creates to `templateArchive` or, if
+			 * empty, TemplateDir. Otherwise, templates are only
+			 * kept in memory.
+			 */
+			bool keepTemplates{false};
+			/**
+			 * Image corpus to write when building and read when
+			 * creating. When empty, each image is read from a
+			 * separate file in ImageDir.
+			 */
+			std::string imageCorpus{};
+			/**
+			 * Manifest of the images and pairs to use. When
+			 * empty, the built-in validation set is used.
+			 */
+			std::string manifest{};
+			/** Binary manifest to write (Operation::Manifest). */
+			std::string packedManifest{};
+			/**
+			 * Number of items that may wait between the read,
+			 * compute, and write stages of each worker. 0 runs
+			 * the stages serially.
+			 */
+			uint16_t pipelineDepth{0};
+			/** Order in which to create or compare. */
+			Order order{Order::Random};
+			/**
+			 * Log, or directory of logs, from an earlier run of
+			 * the operation, whose timings predict the cost of
+			 * each item for Order::Cost. When empty, costs are
+			 * predicted from image sizes.
+			 */
+			std::string costLog{};
+			/**
+			 * Number of templates on the side not grouped by
+			 * `order` to visit before moving on to the next
+			 * tile. 0 visits all of them.
+			 */
+			uint64_t tileSize{0};
+			/**
+			 * Slice of the permutation this run performs, in
+			 * [0, shardCount). Runs with the same seed and
+			 * shardCount perform disjoint slices that together
+			 * cover every item.
+			 */
+			uint32_t shardIndex{0};
+			/** Number of runs dividing the permutation. */
+			uint32_t shardCount{1};
+			/**
+			 * Whether the parent process supervises forked
+			 * workers, replacing those that are lost.
+			 */
+			bool supervise{false};
+			/**
+			 * Time an item may take before a supervised worker
+			 * is killed, or 0 for no limit.
+			 */
+			std::chrono::seconds callTimeout{0};
+			/**
+			 * Times an item whose supervised worker was lost is
+			 * attempted again.
+			 */
+			uint8_t maxRetries{0};
+			/**
+			 * Time between reports of progress to stderr, or 0
+			 * for no reports.
+			 */
+			std::chrono::seconds progressInterval{0};
+			/** How to pin workers to hardware threads. */
+			Pinning pinning{Pinning::None};
+			/**
+			 * Whether pinned workers allocate memory only from
+			 * the NUMA node they run on.
+			 */
+			bool bindMemory{false};
+			/**
+			 * Whether to continue from the checkpoints of an
+			 * interrupted run of the same shard, instead of
+			 * starting over.
+			 */
+			bool resume{false};
 			/** Configuration directory. */
 			std::string configDir{};
 		};
 
+		/** A process or thread performing an operation. */
+		struct Worker
+		{
+			/**
+			 * Unique identifier, used to name the log and
+			 * checkpoint. An existing checkpoint is continued.
+			 */
+			std::string id;
+			/** Where progress is reported. */
+			WorkerStatus &status;
+			/** Time between checkpoints of the log. */
+			std::chrono::seconds checkpointInterval{
+			    CheckpointedLog::DefaultInterval};
+			/**
+			 * Where the worker runs, applied when it starts, or
+			 * std::nullopt to run anywhere.
+			 */
+			std::optional<Placement> placement{};
+		};
+
+		/** Function that reads the image at an index in a Dataset. */
+		using ImageLoader = std::function<FingerImage(
+		    const uint64_t imageIndex)>;
+
+		/**
+		 * Function that stores a template created from the image
+		 * with a name.
+		 */
+		using TemplateWriter = std::function<void(const std::string &name,
+		    const std::vector<std::byte> &data)>;
+
 		/**
 		 * @brief
 		 * Create a template from a single image.
 		 *
 		 * @param impl
 		 * Pointer to PFTIII implementation.
-		 * @param imageIndex
-		 * Index in Data::Images representing the image that should
-		 * be converted into a template.
+		 * @param name
+		 * Name of the image that should be converted into a
+		 * template.
+		 * @param image
+		 * The image named `name`.
 		 *
 		 * @return
-		 * Entry for log file.
+		 * A tuple whose first member is the entry for the log file
+		 * and whose second member is the template to store, empty if
+		 * no template was created.
 		 *
 		 * @throw
-		 * Error reading image or creating template
+		 * Error creating template
 		 */
-		std::string
+		std::tuple<std::string, std::vector<std::byte>>
 		create(
 		    const std::shared_ptr<Interface> impl,
-		    const uint64_t imageIndex);
+		    const std::string_view name,
+		    const FingerImage &image);
 
 		/**
 		 * @brief
@@ -78,36 +256,60 @@ namespace PFTIII
 		 *
 		 * @param impl
 		 * Pointer to PFTIII implementation.
-		 * @param pairsIndex
-		 * Index in pairs list that should be performed.
+		 * @param probeName
+		 * Name of the first image of the pair.
+		 * @param referenceName
+		 * Name of the second image of the pair.
+		 * @param probe
+		 * Template created from the first image of the pair.
+		 * @param reference
+		 * Template created from the second image of the pair.
 		 *
 		 * @return
 		 * Entry for log file.
 		 *
 		 * @throw
-		 * Error reading or comparing templates.
+		 * Error comparing templates.
 		 */
 		std::string
 		compare(
 		    const std::shared_ptr<Interface> impl,
-		    const uint64_t pairsIndex);
+		    const std::string_view probeName,
+		    const std::string_view referenceName,
+		    const std::vector<std::byte> &probe,
+		    const std::vector<std::byte> &reference);
+
+		/**
+		 * @brief
+		 * Ensure an instantiated implementation identifies itself
+		 * the same way as the library does statically.
+		 *
+		 * @param impl
+		 * Pointer to PFTIII implementation.
+		 *
+		 * @throw runtime_error
+		 * Library identifier or version number differs between
+		 * getIdentification() and getSubmissionIdentification().
+		 */
+		void
+		checkIdentification(
+		    const std::shared_ptr<Interface> impl);
 
 		/**
 		 * @brief
 		 * Format identification information about a PFTIII
 		 * implementation.
 		 *
-		 * @param args
-		 * Arguments parsed from command line (needed to retrieve
-		 * configuration directory).
-		 *
 		 * @return
 		 * Multiple "key = value" lines of information about the linked
 		 * PFTIII implementation.
+		 *
+		 * @note
+		 * Information is obtained without instantiating the
+		 * implementation, so the configuration directory is not read.
 		 */
 		std::string
-		getIdentificationString(
-		    const Arguments &args);
+		getIdentificationString();
 
 		/**
 		 * @brief
@@ -145,20 +347,147 @@ namespace PFTIII
 
 		/**
 		 * @brief
-		 * Generate a random set of container indicies.
+		 * Predict the relative time the implementation takes on each
+		 * item of an operation.
+		 *
+		 * @param dataset
+		 * Images and pairs.
+		 * @param operation
+		 * Operation::Create or Operation::Compare.
+		 * @param costLog
+		 * Log, or directory of logs, from an earlier run of
+		 * `operation`, or empty.
 		 *
-		 * @param size
-		 * The number of items to be in the container.
+		 * @return
+		 * Cost of each image (Operation::Create) or pair
+		 * (Operation::Compare) of `dataset`, in arbitrary units.
+		 *
+		 * @throw runtime_error
+		 * Error reading the logs, or they contain no timings.
+		 *
+		 * @note
+		 * Without logs, creating from an image is predicted to cost
+		 * its width * height * ppi, and comparing a pair the sum of
+		 * the costs of its images. The mean time logged for an item
+		 * replaces its prediction. Items without timings keep their
+		 * size-based prediction, scaled by the ratio of time logged
+		 * to size predicted over the items with timings.
+		 */
+		std::vector<double>
+		predictCosts(
+		    const Dataset &dataset,
+		    const Operation operation,
+		    const std::string &costLog);
+
+		/**
+		 * @brief
+		 * Order the items of an operation from most to least costly.
+		 *
+		 * @param dataset
+		 * Images and pairs.
+		 * @param operation
+		 * Operation::Create or Operation::Compare.
+		 * @param costLog
+		 * Passed to predictCosts().
+		 * @param shardCount
+		 * Number of shards (getShard()) that will divide the order.
+		 * @param seed
+		 * Randomization seed, which orders items of equal cost.
+		 *
+		 * @return
+		 * Indicies of images or pairs of `dataset`. Each shard's
+		 * slice is ordered from most to least costly.
+		 *
+		 * @throw runtime_error
+		 * Error from predictCosts().
+		 *
+		 * @note
+		 * Workers claiming items in this order finish the longest
+		 * items first, leaving short ones to fill the gaps at the
+		 * end of the run. Items are dealt to shards in turn, so
+		 * every shard receives a similar mix of costs.
+		 */
+		std::vector<uint64_t>
+		orderByCost(
+		    const Dataset &dataset,
+		    const Operation operation,
+		    const std::string &costLog,
+		    const uint32_t shardCount,
+		    const uint64_t seed);
+
+		/**
+		 * @brief
+		 * Order pairs so that consecutive comparisons share
+		 * templates.
+		 *
+		 * @param dataset
+		 * Images and pairs.
+		 * @param order
+		 * Order::Probe or Order::Reference.
+		 * @param tileSize
+		 * Number of templates on the other side of the pair to visit
+		 * before moving on to the next tile, or 0 for all of them.
 		 * @param seed
 		 * Randomization seed.
 		 *
 		 * @return
-		 * Vector of size unique values.
+		 * Indicies of pairs of `dataset`, in which all pairs sharing a
+		 * probe (Order::Probe) or reference (Order::Reference) are
+		 * consecutive within each tile. Templates are visited in
+		 * an order randomized by `seed`.
+		 *
+		 * @throw invalid_argument
+		 * `order` is not Order::Probe or Order::Reference.
+		 *
+		 * @note
+		 * Pairs are visited in blocks: for each tile of
+		 * `tileSize` references (Order::Probe), each probe is
+		 * compared against all of its candidates in the tile. A
+		 * tile that fits in cache stays resident while a probe,
+		 * decoded once, is compared against it.
 		 */
 		std::vector<uint64_t>
-		randomizeIndicies(
-		    const uint64_t size,
-		    const uint64_t seed = std::random_device()());
+		orderPairs(
+		    const Dataset &dataset,
+		    const Order order,
+		    const uint64_t tileSize,
+		    const uint64_t seed);
+
+		/**
+		 * @brief
+		 * Create and compare templates as a StreamScheduler directs.
+		 *
+		 * @param impl
+		 * Pointer to PFTIII API implementation.
+		 * @param dataset
+		 * Images and pairs the scheduler's indicies refer to.
+		 * @param scheduler
+		 * Source of tasks, shared with other workers.
+		 * @param images
+		 * Source of images.
+		 * @param templateArchive
+		 * Archive to which templates are appended, or empty to write
+		 * each template to a file in TemplateDir.
+		 * @param keepTemplates
+		 * Whether to write templates at all.
+		 * @param worker
+		 * The calling thread. Its ID names both a creation and a
+		 * comparison log. It is first moved to the worker's
+		 * placement, if any.
+		 *
+		 * @throw runtime_error
+		 * Error applying the placement, creating, comparing, or
+		 * writing.
+		 */
+		void
+		runStream(
+		    std::shared_ptr<Interface> impl,
+		    const Dataset &dataset,
+		    StreamScheduler &scheduler,
+		    const ImageLoader &images,
+		    const std::string &templateArchive,
+		    const bool keepTemplates,
+		    const Worker &worker);
 
 		/**
 		 * @brief
@@ -166,13 +495,35 @@ namespace PFTIII
 		 *
 		 * @param impl
 		 * Pointer to PFTIII API implementation.
-		 * @param keys
-		 * The keys from Data::Images from which to create templates.
+		 * @param dataset
+		 * Images and pairs.
+		 * @param indicies
+		 * Indicies of images of `dataset` from which to create
+		 * templates.
+		 * @param queue
+		 * Source of positions within `indicies` to process, shared
+		 * with other workers.
+		 * @param images
+		 * Source of images.
+		 * @param templateArchive
+		 * Archive to which templates are appended, or empty to write
+		 * each template to a file in TemplateDir.
+		 * @param pipelineDepth
+		 * Number of images read ahead and templates waiting to be
+		 * written, or 0 to read, create, and write serially.
+		 * @param worker
+		 * The calling process or thread.
 		 */
 		void
 		runCreate(
 		    std::shared_ptr<Interface> impl,
-		    const std::vector<uint64_t> &indicies);
+		    const Dataset &dataset,
+		    const Permutation &indicies,
+		    WorkQueue &queue,
+		    const ImageLoader &images,
+		    const std::string &templateArchive,
+		    const uint16_t pipelineDepth,
+		    const Worker &worker);
 
 		/**
 		 * @brief
@@ -180,13 +531,366 @@ namespace PFTIII
 		 *
 		 * @param impl
 		 * Pointer to PFTIII API implementation.
-		 * @param comparisons
-		 * The pairs from Data::Pairs to compare.
+		 * @param dataset
+		 * Images and pairs.
+		 * @param indicies
+		 * Indicies of pairs of `dataset` to compare.
+		 * @param queue
+		 * Source of positions within `indicies` to process, shared
+		 * with other workers.
+		 * @param cache
+		 * Source of templates.
+		 * @param pipelineDepth
+		 * Number of template pairs read ahead and log entries
+		 * waiting to be written, or 0 to read, compare, and write
+		 * serially.
+		 * @param worker
+		 * The calling process or thread.
 		 */
 		void
 		runCompare(
 		    std::shared_ptr<Interface> impl,
-		    const std::vector<uint64_t> &indicies);
+		    const Dataset &dataset,
+		    const Permutation &indicies,
+		    WorkQueue &queue,
+		    TemplateCache &cache,
+		    const uint16_t pipelineDepth,
+		    const Worker &worker);
+
+		/**
+		 * @brief
+		 * Instantiate one implementation per thread.
+		 *
+		 * @param configDir
+		 * Configuration directory passed to getImplementation().
+		 * @param numInstances
+		 * Number of implementations to instantiate.
+		 *
+		 * @return
+		 * `numInstances` implementations, each checked with
+		 * checkIdentification().
+		 *
+		 * @note
+		 * Instances are created serially, since getImplementation()
+		 * need not be thread-safe.
+		 */
+		std::vector<std::shared_ptr<Interface>>
+		getImplementationPool(
+		    const std::string &configDir,
+		    const uint8_t numInstances);
+
+		/**
+		 * @brief
+		 * Run runCreate() or runCompare(), depending on `operation`.
+		 *
+		 * @param impl
+		 * Pointer to PFTIII API implementation.
+		 * @param args
+		 * Arguments parsed from command line, with operation
+		 * Operation::Create or Operation::Compare.
+		 * @param dataset
+		 * Images and pairs.
+		 * @param indicies
+		 * Indicies in `dataset` for the operation.
+		 * @param queue
+		 * Source of positions within `indicies` to process.
+		 * @param images
+		 * Source of images for Operation::Create.
+		 * @param cache
+		 * Source of templates for Operation::Compare.
+		 * @param worker
+		 * The calling process or thread, which is first moved to
+		 * the worker's placement, if any.
+		 *
+		 * @throw runtime_error
+		 * Unsupported operation, error applying the placement, or
+		 * error from runCreate() or runCompare().
+		 */
+		void
+		runOperation(
+		    std::shared_ptr<Interface> impl,
+		    const Arguments &args,
+		    const Dataset &dataset,
+		    const Permutation &indicies,
+		    WorkQueue &queue,
+		    const ImageLoader &images,
+		    TemplateCache &cache,
+		    const Worker &worker);
+
+		/**
+		 * @brief
+		 * Run an operation from multiple threads.
+		 *
+		 * @param impls
+		 * Pointers to PFTIII API implementations. Thread `i` uses
+		 * `impls[i % impls.size()]`, so a single implementation
+		 * shared by all threads must be reentrant.
+		 * @param args
+		 * Arguments parsed from command line, including the
+		 * operation and number of threads.
+		 * @param dataset
+		 * Images and pairs.
+		 * @param indicies
+		 * Indicies in `dataset` for the operation.
+		 * @param queue
+		 * Source of positions within `indicies` to process.
+		 * @param images
+		 * Source of images for Operation::Create.
+		 * @param cache
+		 * Source of templates for Operation::Compare.
+		 * @param workers
+		 * Each thread to run.
+		 *
+		 * @throw
+		 * The first exception thrown by any thread, rethrown after
+		 * all threads have finished.
+		 */
+		void
+		runThreads(
+		    const std::vector<std::shared_ptr<Interface>> &impls,
+		    const Arguments &args,
+		    const Dataset &dataset,
+		    const Permutation &indicies,
+		    WorkQueue &queue,
+		    const ImageLoader &images,
+		    TemplateCache &cache,
+		    const std::vector<Worker> &workers);
+
+		/**
+		 * @brief
+		 * Run an operation in forked processes whose progress is
+		 * supervised by the calling process.
+		 *
+		 * @param impl
+		 * Pointer to PFTIII API implementation.
+		 * @param args
+		 * Arguments parsed from command line, including the
+		 * operation, number of processes, timeout, and retries.
+		 * @param dataset
+		 * Images and pairs.
+		 * @param indicies
+		 * Indicies in `dataset` for the operation.
+		 * @param queue
+		 * Source of positions within `indicies` to process.
+		 * @param images
+		 * Source of images for Operation::Create.
+		 * @param cache
+		 * Source of templates for Operation::Compare.
+		 * @param statuses
+		 * Status of each process.
+		 * @param workerID
+		 * Returns the identifier of a new process in a slot of
+		 * `statuses`, given a suffix that makes it unique.
+		 * @param placements
+		 * Where the process in each slot of `statuses` runs,
+		 * including those that replace it.
+		 * @param onTick
+		 * Called about once a second while processes run.
+		 *
+		 * @throw runtime_error
+		 * A process failed outside of an item, an item was
+		 * abandoned, or error forking or writing.
+		 *
+		 * @note
+		 * A process that exceeds the timeout on one item is killed.
+		 * Each item whose process was lost is logged to an
+		 * incidents file in OutputDir, and a replacement process
+		 * retries it (up to the retry limit) before continuing with
+		 * the remaining work.
+		 */
+		void
+		superviseProcesses(
+		    std::shared_ptr<Interface> impl,
+		    const Arguments &args,
+		    const Dataset &dataset,
+		    const Permutation &indicies,
+		    WorkQueue &queue,
+		    const ImageLoader &images,
+		    TemplateCache &cache,
+		    WorkerStatusTable &statuses,
+		    const std::function<std::string(const uint8_t worker,
+		        const std::string &suffix)> &workerID,
+		    const std::vector<std::optional<Placement>> &placements,
+		    const TickHandler &onTick = {});
+
+		/**
+		 * @brief
+		 * Obtain an identifier for the calling process.
+		 *
+		 * @param args
+		 * Arguments parsed from command line.
+		 *
+		 * @return
+		 * Process ID, prefixed by the shard when the permutation is
+		 * divided, so that logs from runs on different machines
+		 * writing to the same OutputDir do not collide.
+		 */
+		std::string
+		getWorkerID(
+		    const Arguments &args);
+
+		/**
+		 * @brief
+		 * Obtain the paths a worker writes.
+		 *
+		 * @param operation
+		 * Operation::Create or Operation::Compare.
+		 * @param workerID
+		 * Unique identifier of the worker.
+		 *
+		 * @return
+		 * Tuple of the path to the worker's log and the path to
+		 * its checkpoint.
+		 */
+		std::tuple<std::string, std::string>
+		getLogPathNames(
+		    const Operation operation,
+		    const std::string &workerID);
+
+		/**
+		 * @brief
+		 * Find workers of an earlier run of the same operation
+		 * and shard that left checkpoints.
+		 *
+		 * @param args
+		 * Arguments parsed from command line.
+		 *
+		 * @return
+		 * Sorted identifiers of the workers.
+		 */
+		std::vector<std::string>
+		getCheckpointedWorkers(
+		    const Arguments &args);
+
+		/**
+		 * @brief
+		 * Combine the logs written by every worker of every shard
+		 * of an operation, ensuring each item was logged once.
+		 *
+		 * @param dataset
+		 * Images and pairs that were logged.
+		 * @param operation
+		 * Operation::Create or Operation::Compare.
+		 *
+		 * @return
+		 * false if no logs for `operation` were found in OutputDir,
+		 * true if they were merged.
+		 *
+		 * @throw runtime_error
+		 * Error reading or writing a log, or an item of
+		 * `operation` was logged other than exactly once.
+		 *
+		 * @note
+		 * The merged log is written to OutputDir, named like the
+		 * logs it combines, without the worker identifier. Entries
+		 * are sorted beneath a single header, and the combined logs
+		 * are left in place.
+		 */
+		bool
+		mergeLogs(
+		    const Dataset &dataset,
+		    const Operation operation);
+
+		/**
+		 * @brief
+		 * Read an image from a file in ImageDir.
+		 *
+		 * @param dataset
+		 * Images and pairs.
+		 * @param imageIndex
+		 * Index of the image in `dataset`.
+		 *
+		 * @return
+		 * The image, with metadata from `dataset`.
+		 *
+		 * @throw runtime_error
+		 * Error reading from file.
+		 */
+		FingerImage
+		readImage(
+		    const Dataset &dataset,
+		    const uint64_t imageIndex);
+
+		/**
+		 * @brief
+		 * Read a template written by create().
+		 *
+		 * @param name
+		 * Name of the image from which the template was created.
+		 *
+		 * @return
+		 * Contents of the template.
+		 *
+		 * @throw runtime_error
+		 * Error reading from file.
+		 */
+		std::vector<std::byte>
+		readTemplate(
+		    const std::string &name);
+
+		/**
+		 * @brief
+		 * Write a template to a file in TemplateDir.
+		 *
+		 * @param name
+		 * Name of the image from which the template was created.
+		 * @param data
+		 * Contents of the template.
+		 *
+		 * @throw runtime_error
+		 * Error writing to file.
+		 */
+		void
+		writeTemplate(
+		    const std::string &name,
+		    const std::vector<std::byte> &data);
+
+		/**
+		 * @brief
+		 * Write every template in an archive to a file in
+		 * TemplateDir, as runCreate() does without an archive.
+		 *
+		 * @param templateArchive
+		 * Path to template archive.
+		 *
+		 * @throw runtime_error
+		 * Error reading the archive or writing a template.
+		 */
+		void
+		extractArchive(
+		    const std::string &templateArchive);
+
+		/**
+		 * @brief
+		 * Pack every image of a dataset from ImageDir into an image
+		 * corpus.
+		 *
+		 * @param dataset
+		 * Images to pack.
+		 * @param imageCorpus
+		 * Path to image corpus, replaced if it exists.
+		 *
+		 * @throw runtime_error
+		 * Error reading an image or writing the corpus.
+		 */
+		void
+		buildCorpus(
+		    const Dataset &dataset,
+		    const std::string &imageCorpus);
+
+		/**
+		 * @brief
+		 * Create a directory if it does not already exist.
+		 *
+		 * @param pathName
+		 * Path to directory.
+		 *
+		 * @throw runtime_error
+		 * Error creating directory.
+		 */
+		void
+		makeDirectory(
+		    const std::string &pathName);
 
 		/**
 		 * @brief
@@ -228,48 +932,96 @@ namespace PFTIII
 
 		/**
 		 * @brief
-		 * Create multiple smaller sets from a large set.
+		 * Test a PFTIII API implementation of template creation or
+		 * template matching (depending on `args`) for all validation
+		 * data.
+		 *
+		 * @param args
+		 * Arguments parsed from command line.
 		 *
-		 * @param combinedSet
-		 * Set of numbers to split.
-		 * @param numSets
-		 * Number of sets to create.
+		 * @throw runtime_error
+		 * Error performing the operation, a worker failed, or the
+		 * run was stopped by SIGTERM. Checkpoints are kept in these
+		 * cases, so a run with `args.resume` can continue; they are
+		 * removed when every item is done.
+		 *
+		 * @note
+		 * Workers pinned by `args.pinning` keep their placement
+		 * across replacement by supervision, and the placements are
+		 * recorded in OutputDir.
+		 */
+		void
+		testOperation(
+		    const Arguments &args);
+
+		/**
+		 * @brief
+		 * Choose where workers run, recording the choice in
+		 * OutputDir.
+		 *
+		 * @param args
+		 * Arguments parsed from command line, including the
+		 * pinning.
+		 * @param count
+		 * Number of workers.
+		 * @param logPrefix
+		 * Distinguishes the record of this operation's placements.
 		 *
 		 * @return
-		 * Collection of numSets collections, created sequentially
-		 * from combinedSet.
+		 * Placement of each worker, all std::nullopt when
+		 * `args.pinning` is Pinning::None.
 		 *
-		 * @throw
-		 * numSets > combinedSet.size()
+		 * @throw runtime_error
+		 * Too many workers to pin, or error writing the record.
 		 */
-		std::vector<std::vector<uint64_t>>
-		splitSet(
-		    const std::vector<uint64_t> &combinedSet,
-		    const uint8_t numSets);
+		std::vector<std::optional<Placement>>
+		placeWorkers(
+		    const Arguments &args,
+		    const uint8_t count,
+		    const std::string &logPrefix);
 
 		/**
 		 * @brief
-		 * Test a PFTIII API implementation of template creation or
-		 * template matching (depending on `args`) for all validation
-		 * data.
+		 * Test template creation and template matching together,
+		 * comparing each pair as soon as both of its templates
+		 * have been created.
 		 *
 		 * @param args
 		 * Arguments parsed from command line.
+		 *
+		 * @throw runtime_error
+		 * Error performing either operation, or a thread failed.
+		 *
+		 * @note
+		 * The implementation is loaded once, and templates pass
+		 * between creation and comparison in memory, unless
+		 * `args.keepTemplates` also writes them out. The logs are
+		 * those of Operation::Create and Operation::Compare, so
+		 * they may be merged (Operation::Merge) as usual.
 		 */
 		void
-		testOperation(
+		streamOperation(
 		    const Arguments &args);
 
 		/**
 		 * @brief
 		 * Wait for forked children to exit.
 		 *
-		 * @param numChildren
-		 * The expected number of children to exit.
+		 * @param children
+		 * Process IDs of the children.
+		 * @param onTick
+		 * Called about once a second while children run.
+		 *
+		 * @return
+		 * Number of children that did not exit successfully.
+		 *
+		 * @throw runtime_error
+		 * Error waiting for children, or from `onTick`.
 		 */
-		void
+		uint8_t
 		waitForExit(
-		    const uint8_t numChildren);
+		    const std::vector<pid_t> &children,
+		    const TickHandler &onTick = {});
 
 		/**
 		 * @brief
@@ -0,0 +1,253 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <pftiii_validation_archive.h>
+
+namespace
+{
+	/** @return Description of the current errno. */
+	std::string
+	errnoMessage()
+	{
+		return (std::system_error(errno, std::system_category()).
+		    code().message());
+	}
+
+	/**
+	 * @brief
+	 * Open a file, throwing on failure.
+	 */
+	int
+	openOrThrow(
+	    const std::string &pathName,
+	    const int flags)
+	{
+		const int fd{::open(pathName.c_str(), flags | O_CLOEXEC,
+		    S_IRUSR | S_IWUSR | S_IRGRP)};
+		if (fd == -1)
+			throw std::runtime_error("Could not open " + pathName +
+			    " (" + errnoMessage() + ")");
+		return (fd);
+	}
+
+	/**
+	 * @brief
+	 * Append buffers to a file with a single write.
+	 *
+	 * @return
+	 * Offset of the file immediately after the write.
+	 */
+	uint64_t
+	appendOrThrow(
+	    const int fd,
+	    const std::string &pathName,
+	    std::vector<iovec> &buffers)
+	{
+		std::size_t size{0};
+		for (const auto &buffer : buffers)
+			size += buffer.iov_len;
+
+		const ssize_t written{::writev(fd, buffers.data(),
+		    static_cast<int>(buffers.size()))};
+		if (written == -1)
+			throw std::runtime_error("Could not write to " +
+			    pathName + " (" + errnoMessage() + ")");
+		/* Retrying would break atomicity, so a short write is fatal */
+		if (static_cast<std::size_t>(written) != size)
+			throw std::runtime_error("Short write to " + pathName);
+
+		const off_t end{::lseek(fd, 0, SEEK_CUR)};
+		if (end == -1)
+			throw std::runtime_error("Could not seek in " +
+			    pathName + " (" + errnoMessage() + ")");
+		return (static_cast<uint64_t>(end));
+	}
+}
+
+PFTIII::Validation::TemplateArchiveWriter::TemplateArchiveWriter(
+    const std::string &pathName) :
+    pathName{pathName}
+{
+	this->archiveFD = openOrThrow(pathName, O_WRONLY | O_CREAT |
+	    O_APPEND);
+	try {
+		this->indexFD = openOrThrow(pathName + IndexSuffix, O_WRONLY |
+		    O_CREAT | O_APPEND);
+	} catch (...) {
+		::close(this->archiveFD);
+		throw;
+	}
+}
+
+void
+PFTIII::Validation::TemplateArchiveWriter::append(
+    const std::string &name,
+    const std::vector<std::byte> &data)
+{
+	RecordHeader record{};
+	record.nameLength = static_cast<uint32_t>(name.size());
+	record.dataLength = data.size();
+
+	std::vector<iovec> buffers{
+	    {&record, sizeof(record)},
+	    {const_cast<char*>(name.data()), name.size()},
+	    {const_cast<std::byte*>(data.data()), data.size()}};
+	const uint64_t end{appendOrThrow(this->archiveFD, this->pathName,
+	    buffers)};
+
+	/* O_APPEND leaves our offset at the end of our own record */
+	IndexHeader entry{};
+	entry.offset = end - (sizeof(record) + name.size() + data.size());
+	entry.dataLength = data.size();
+	entry.nameLength = record.nameLength;
+	buffers = {
+	    {&entry, sizeof(entry)},
+	    {const_cast<char*>(name.data()), name.size()}};
+	appendOrThrow(this->indexFD, this->pathName + IndexSuffix, buffers);
+}
+
+void
+PFTIII::Validation::TemplateArchiveWriter::truncate(
+    const std::string &pathName)
+{
+	for (const auto &path : {pathName, pathName + IndexSuffix})
+		::close(openOrThrow(path, O_WRONLY | O_CREAT | O_TRUNC));
+}
+
+PFTIII::Validation::TemplateArchiveWriter::~TemplateArchiveWriter()
+{
+	::close(this->indexFD);
+	::close(this->archiveFD);
+}
+
+PFTIII::Validation::TemplateArchiveReader::TemplateArchiveReader(
+    const std::string &pathName) :
+    pathName{pathName},
+    archive{pathName}
+{
+	if (!this->loadIndex())
+		this->scanArchive();
+}
+
+bool
+PFTIII::Validation::TemplateArchiveReader::loadIndex()
+{
+	const std::string indexPath{this->pathName + IndexSuffix};
+	if (::access(indexPath.c_str(), F_OK) != 0) {
+		if (errno == ENOENT)
+			return (false);
+		throw std::runtime_error("Could not open " + indexPath +
+		    " (" + errnoMessage() + ")");
+	}
+	const MappedFile indexFile{indexPath, Advice::Sequential};
+	const auto contents = indexFile.getData();
+	const uint64_t archiveSize{this->archive.getData().size()};
+
+	/* A trailing partial entry is from an interrupted append */
+	std::size_t position{0};
+	while (position + sizeof(IndexHeader) <= contents.size()) {
+		IndexHeader entry{};
+		std::copy_n(contents.data() + position, sizeof(entry),
+		    reinterpret_cast<std::byte*>(&entry));
+		position += sizeof(entry);
+		if (position + entry.nameLength > contents.size())
+			break;
+
+		const uint64_t dataOffset{entry.offset + sizeof(RecordHeader) +
+		    entry.nameLength};
+		if (dataOffset + entry.dataLength > archiveSize)
+			throw std::runtime_error(indexPath + " refers to data "
+			    "beyond the end of " + this->pathName);
+		this->index[std::string(reinterpret_cast<const char*>(
+		    contents.data() + position), entry.nameLength)] =
+		    {dataOffset, entry.dataLength};
+		position += entry.nameLength;
+	}
+
+	return (true);
+}
+
+void
+PFTIII::Validation::TemplateArchiveReader::scanArchive()
+{
+	const auto data = this->archive.getData();
+
+	uint64_t offset{0};
+	while (offset + sizeof(RecordHeader) <= data.size()) {
+		RecordHeader record{};
+		std::copy_n(data.data() + offset, sizeof(record),
+		    reinterpret_cast<std::byte*>(&record));
+		if (record.magic != ArchiveMagic)
+			throw std::runtime_error("Corrupt record at offset " +
+			    std::to_string(offset) + " of " + this->pathName);
+
+		const uint64_t dataOffset{offset + sizeof(record) +
+		    record.nameLength};
+		if (dataOffset + record.dataLength > data.size())
+			break;
+
+		this->index[std::string(reinterpret_cast<const char*>(
+		    data.data() + offset + sizeof(record)),
+		    record.nameLength)] = {dataOffset, record.dataLength};
+
+		offset = dataOffset + record.dataLength;
+	}
+}
+
+std::span<const std::byte>
+PFTIII::Validation::TemplateArchiveReader::view(
+    const std::string &name)
+    const
+{
+	const auto it = this->index.find(name);
+	if (it == this->index.end())
+		throw std::runtime_error("No template named " + name + " in " +
+		    this->pathName);
+
+	const auto [offset, length] = it->second;
+	return (this->archive.getData().subspan(offset, length));
+}
+
+std::vector<std::byte>
+PFTIII::Validation::TemplateArchiveReader::read(
+    const std::string &name)
+    const
+{
+	const auto data = this->view(name);
+	return {data.begin(), data.end()};
+}
+
+std::vector<std::string>
+PFTIII::Validation::TemplateArchiveReader::getNames()
+    const
+{
+	std::vector<std::tuple<uint64_t, std::string>> entries{};
+	entries.reserve(this->index.size());
+	for (const auto &[name, location] : this->index)
+		entries.emplace_back(std::get<0>(location), name);
+	std::sort(entries.begin(), entries.end());
+
+	std::vector<std::string> names{};
+	names.reserve(entries.size());
+	for (auto &entry : entries)
+		names.push_back(std::move(std::get<1>(entry)));
+	return (names);
+}
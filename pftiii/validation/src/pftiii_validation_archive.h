@@ -0,0 +1,241 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_ARCHIVE_H_
+#define PFTIII_VALIDATION_ARCHIVE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <pftiii_validation_file.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/*
+		 * An archive is a sequence of records, each a RecordHeader
+		 * followed by the template's name and data. A companion index
+		 * (the archive's path with IndexSuffix appended) is a sequence
+		 * of IndexHeaders, each followed by a name. All integers are
+		 * in host byte order.
+		 */
+
+		/** Identifies the start of an archive record. */
+		constexpr uint32_t ArchiveMagic{0x54544650}; /* "PFTT" */
+		/** Appended to an archive's path to name its index. */
+		const std::string IndexSuffix{".idx"};
+
+		/** Precedes each template in an archive. */
+		struct RecordHeader
+		{
+			/** ArchiveMagic. */
+			uint32_t magic{ArchiveMagic};
+			/** Number of bytes in the name that follows. */
+			uint32_t nameLength{};
+			/** Number of bytes in the template after the name. */
+			uint64_t dataLength{};
+		};
+		static_assert(sizeof(RecordHeader) == 16);
+
+		/** Precedes each name in an index. */
+		struct IndexHeader
+		{
+			/** Offset of the record's RecordHeader in the archive. */
+			uint64_t offset{};
+			/** Number of bytes in the template. */
+			uint64_t dataLength{};
+			/** Number of bytes in the name that follows. */
+			uint32_t nameLength{};
+			/** Zero. */
+			uint32_t reserved{};
+		};
+		static_assert(sizeof(IndexHeader) == 24);
+
+		/**
+		 * @brief
+		 * Appends templates to an archive and its index.
+		 *
+		 * @details
+		 * Each record is appended with a single write to a file
+		 * opened with O_APPEND, so any number of writers, in any
+		 * number of processes, may append to the same archive.
+		 */
+		class TemplateArchiveWriter
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param pathName
+			 * Path to the archive, created if it does not exist.
+			 *
+			 * @throw runtime_error
+			 * Error opening the archive or its index.
+			 */
+			explicit TemplateArchiveWriter(
+			    const std::string &pathName);
+
+			/**
+			 * @brief
+			 * Append a template.
+			 *
+			 * @param name
+			 * Name of the template.
+			 * @param data
+			 * The template.
+			 *
+			 * @throw runtime_error
+			 * Error writing the archive or its index.
+			 */
+			void
+			append(
+			    const std::string &name,
+			    const std::vector<std::byte> &data);
+
+			/**
+			 * @brief
+			 * Create an empty archive and index, replacing any
+			 * that exist.
+			 *
+			 * @param pathName
+			 * Path to the archive.
+			 *
+			 * @throw runtime_error
+			 * Error creating either file.
+			 */
+			static
+			void
+			truncate(
+			    const std::string &pathName);
+
+			~TemplateArchiveWriter();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			TemplateArchiveWriter(
+			    const TemplateArchiveWriter&) = delete;
+			TemplateArchiveWriter& operator=(
+			    const TemplateArchiveWriter&) = delete;
+			/** @endcond */
+
+		private:
+			/** Path to the archive. */
+			const std::string pathName;
+			/** Archive, opened for appending. */
+			int archiveFD{-1};
+			/** Index, opened for appending. */
+			int indexFD{-1};
+		};
+
+		/**
+		 * @brief
+		 * Reads templates from an archive by name.
+		 *
+		 * @details
+		 * The archive is mapped into memory, so a single reader may be
+		 * shared between threads and between processes fork()ed
+		 * after its construction.
+		 */
+		class TemplateArchiveReader
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param pathName
+			 * Path to the archive.
+			 *
+			 * @throw runtime_error
+			 * Error mapping or indexing the archive.
+			 *
+			 * @note
+			 * If the index is missing, it is rebuilt in memory by
+			 * scanning the archive. If a name appears more than
+			 * once, the last record appended wins.
+			 */
+			explicit TemplateArchiveReader(
+			    const std::string &pathName);
+
+			/**
+			 * @brief
+			 * Obtain a template without copying.
+			 *
+			 * @param name
+			 * Name of the template.
+			 *
+			 * @return
+			 * View of the template, valid for the lifetime of this
+			 * object.
+			 *
+			 * @throw runtime_error
+			 * `name` is not in the archive.
+			 */
+			std::span<const std::byte>
+			view(
+			    const std::string &name)
+			    const;
+
+			/**
+			 * @brief
+			 * Read a template.
+			 *
+			 * @param name
+			 * Name of the template.
+			 *
+			 * @return
+			 * Contents of the template.
+			 *
+			 * @throw runtime_error
+			 * `name` is not in the archive.
+			 */
+			std::vector<std::byte>
+			read(
+			    const std::string &name)
+			    const;
+
+			/** @return Names of all templates, in archive order. */
+			std::vector<std::string>
+			getNames()
+			    const;
+
+		private:
+			/**
+			 * @brief
+			 * Populate `index` from the index file.
+			 *
+			 * @return
+			 * true if the index file exists, false otherwise.
+			 */
+			bool
+			loadIndex();
+
+			/** Populate `index` by reading every RecordHeader. */
+			void
+			scanArchive();
+
+			/** Path to the archive. */
+			const std::string pathName;
+			/** The archive. */
+			const MappedFile archive;
+			/** Offset of template data and length, by name. */
+			std::unordered_map<std::string,
+			    std::tuple<uint64_t, uint64_t>> index{};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_ARCHIVE_H_ */
@@ -0,0 +1,85 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <utility>
+
+#include <pftiii_validation_cache.h>
+
+PFTIII::Validation::TemplateCache::TemplateCache(
+    Loader loader,
+    const uint64_t budget) :
+    loader{std::move(loader)},
+    budget{budget}
+{
+
+}
+
+PFTIII::Validation::TemplateCache::Template
+PFTIII::Validation::TemplateCache::get(
+    const std::string &name)
+{
+	if (this->budget == 0)
+		return (std::make_shared<const std::vector<std::byte>>(
+		    this->loader(name)));
+
+	{
+		std::lock_guard<std::mutex> lock{this->mutex};
+		const auto it = this->entries.find(name);
+		if (it != this->entries.end()) {
+			this->recency.splice(this->recency.begin(),
+			    this->recency, it->second.position);
+			return (it->second.data);
+		}
+	}
+
+	/* Load without holding the lock, so other threads can hit */
+	const auto data = std::make_shared<const std::vector<std::byte>>(
+	    this->loader(name));
+
+	std::lock_guard<std::mutex> lock{this->mutex};
+	this->insert(name, data);
+	return (data);
+}
+
+void
+PFTIII::Validation::TemplateCache::preload(
+    const std::vector<std::string> &names)
+{
+	for (const auto &name : names) {
+		const auto data = std::make_shared<
+		    const std::vector<std::byte>>(this->loader(name));
+
+		std::lock_guard<std::mutex> lock{this->mutex};
+		if (this->used + data->size() > this->budget)
+			break;
+		this->insert(name, data);
+	}
+}
+
+void
+PFTIII::Validation::TemplateCache::insert(
+    const std::string &name,
+    const Template &data)
+{
+	/* Another thread may have loaded the same template */
+	if ((data->size() > this->budget) || this->entries.contains(name))
+		return;
+
+	while (this->used + data->size() > this->budget) {
+		const auto &oldest = this->recency.back();
+		this->used -= this->entries.at(oldest).data->size();
+		this->entries.erase(oldest);
+		this->recency.pop_back();
+	}
+
+	this->recency.push_front(name);
+	this->entries.emplace(name, Entry{data, this->recency.begin()});
+	this->used += data->size();
+}
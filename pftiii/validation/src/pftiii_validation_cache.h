@@ -0,0 +1,136 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_CACHE_H_
+#define PFTIII_VALIDATION_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * Least-recently-used cache of templates, bounded by the
+		 * total size of cached templates.
+		 *
+		 * @details
+		 * Templates are obtained from a loader function, so the
+		 * cache is independent of how templates are stored. A
+		 * TemplateCache may be shared between threads.
+		 */
+		class TemplateCache
+		{
+		public:
+			/** Template data shared between the cache and callers. */
+			using Template = std::shared_ptr<
+			    const std::vector<std::byte>>;
+			/** Function returning the template with a name. */
+			using Loader = std::function<std::vector<std::byte>(
+			    const std::string &name)>;
+
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param loader
+			 * Function that reads a template from storage.
+			 * @param budget
+			 * Maximum number of template bytes to keep. 0
+			 * disables caching, so every get() calls `loader`.
+			 */
+			TemplateCache(
+			    Loader loader,
+			    const uint64_t budget);
+
+			/**
+			 * @brief
+			 * Obtain a template.
+			 *
+			 * @param name
+			 * Name of the template, as passed to the loader.
+			 *
+			 * @return
+			 * The template, from the cache if present.
+			 *
+			 * @throw
+			 * Exceptions from the loader.
+			 */
+			Template
+			get(
+			    const std::string &name);
+
+			/**
+			 * @brief
+			 * Load templates into the cache ahead of use.
+			 *
+			 * @param names
+			 * Names of templates to load, in order of preference.
+			 *
+			 * @note
+			 * Loading stops once the budget is reached, so
+			 * templates loaded earlier are never evicted by
+			 * templates loaded later.
+			 */
+			void
+			preload(
+			    const std::vector<std::string> &names);
+
+		private:
+			/** A cached template and its place in `recency`. */
+			struct Entry
+			{
+				Template data{};
+				std::list<std::string>::iterator position{};
+			};
+
+			/**
+			 * @brief
+			 * Add a template, evicting the least recently used
+			 * templates to stay within budget. Caller must hold
+			 * `mutex`.
+			 *
+			 * @param name
+			 * Name of the template.
+			 * @param data
+			 * The template.
+			 */
+			void
+			insert(
+			    const std::string &name,
+			    const Template &data);
+
+			/** Reads templates not in the cache. */
+			const Loader loader;
+			/** Maximum number of bytes in cached templates. */
+			const uint64_t budget;
+
+			/** Protects all members below. */
+			std::mutex mutex{};
+			/** Cached templates, by name. */
+			std::unordered_map<std::string, Entry> entries{};
+			/** Names of cached templates, most recently used first. */
+			std::list<std::string> recency{};
+			/** Number of bytes in cached templates. */
+			uint64_t used{0};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_CACHE_H_ */
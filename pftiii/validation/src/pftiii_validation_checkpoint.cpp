@@ -0,0 +1,154 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <filesystem>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include <pftiii_validation_checkpoint.h>
+
+PFTIII::Validation::CheckpointedLog::CheckpointedLog(
+    const std::string &logPathName,
+    const std::string &checkpointPathName,
+    const std::string &header,
+    const std::chrono::seconds interval) :
+    logPathName{logPathName},
+    checkpointPathName{checkpointPathName},
+    interval{interval}
+{
+	const bool resuming{std::filesystem::exists(checkpointPathName)};
+	const auto mode = (resuming ? std::ofstream::app :
+	    std::ofstream::trunc);
+
+	this->log.open(logPathName, mode);
+	if (!this->log)
+		throw std::runtime_error("Could not open " + logPathName);
+	this->checkpoint.open(checkpointPathName, mode);
+	if (!this->checkpoint)
+		throw std::runtime_error("Could not open " +
+		    checkpointPathName);
+
+	if (resuming) {
+		this->length = std::filesystem::file_size(logPathName);
+	} else {
+		this->log << header << '\n';
+		this->length = header.size() + 1;
+		this->save();
+	}
+	this->lastSave = std::chrono::steady_clock::now();
+}
+
+void
+PFTIII::Validation::CheckpointedLog::append(
+    const uint64_t index,
+    const std::string &entry)
+{
+	this->log << entry << '\n';
+	if (!this->log)
+		throw std::runtime_error("Could not write to " +
+		    this->logPathName);
+	this->length += entry.size() + 1;
+	this->unsaved.push_back(index);
+
+	if ((std::chrono::steady_clock::now() - this->lastSave) >=
+	    this->interval)
+		this->save();
+}
+
+void
+PFTIII::Validation::CheckpointedLog::save()
+{
+	/* Entries must be written before the checkpoint claims them */
+	if (!this->log.flush())
+		throw std::runtime_error("Could not write to " +
+		    this->logPathName);
+
+	this->checkpoint << this->length;
+	for (const auto &index : this->unsaved)
+		this->checkpoint << ' ' << index;
+	this->checkpoint << '\n';
+	if (!this->checkpoint.flush())
+		throw std::runtime_error("Could not write to " +
+		    this->checkpointPathName);
+
+	this->unsaved.clear();
+	this->lastSave = std::chrono::steady_clock::now();
+}
+
+PFTIII::Validation::CheckpointedLog::~CheckpointedLog()
+{
+	try {
+		if (!this->unsaved.empty())
+			this->save();
+	} catch (...) {}
+}
+
+std::optional<std::vector<uint64_t>>
+PFTIII::Validation::restoreCheckpoint(
+    const std::string &logPathName,
+    const std::string &checkpointPathName)
+{
+	std::ifstream file{checkpointPathName};
+	if (!file)
+		throw std::runtime_error("Could not open " +
+		    checkpointPathName);
+	const std::string contents{std::istreambuf_iterator<char>{file},
+	    std::istreambuf_iterator<char>{}};
+	if (file.bad())
+		throw std::runtime_error("Could not read " +
+		    checkpointPathName);
+	file.close();
+
+	/* A line without a newline was interrupted while being saved */
+	std::optional<uint64_t> length{};
+	std::vector<uint64_t> completed{};
+	std::istringstream lines{contents.substr(0,
+	    contents.rfind('\n') + 1)};
+	std::string line{};
+	while (std::getline(lines, line)) {
+		std::istringstream record{line};
+		uint64_t value{};
+		if (!(record >> value))
+			throw std::runtime_error("Malformed record in " +
+			    checkpointPathName);
+		length = value;
+		while (record >> value)
+			completed.push_back(value);
+		if (!record.eof())
+			throw std::runtime_error("Malformed record in " +
+			    checkpointPathName);
+	}
+
+	if (!length) {
+		std::filesystem::remove(logPathName);
+		std::filesystem::remove(checkpointPathName);
+		return (std::nullopt);
+	}
+
+	if (std::filesystem::file_size(logPathName) < *length)
+		throw std::runtime_error(logPathName + " is shorter than "
+		    "recorded in " + checkpointPathName);
+	std::filesystem::resize_file(logPathName, *length);
+
+	/* Replace, rather than rewrite, so a crash leaves one or the other */
+	const std::string compacted{checkpointPathName + ".tmp"};
+	std::ofstream output{compacted, std::ofstream::trunc};
+	output << *length;
+	for (const auto &index : completed)
+		output << ' ' << index;
+	output << '\n';
+	if (!output.flush())
+		throw std::runtime_error("Could not write " + compacted);
+	output.close();
+	std::filesystem::rename(compacted, checkpointPathName);
+
+	return (completed);
+}
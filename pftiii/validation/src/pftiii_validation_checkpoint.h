@@ -0,0 +1,157 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_CHECKPOINT_H_
+#define PFTIII_VALIDATION_CHECKPOINT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * A log that periodically records which items it holds.
+		 *
+		 * @details
+		 * Alongside the log, a checkpoint file receives one line
+		 * per save: the length of the log, flushed, followed by
+		 * the items logged since the previous save. Everything in
+		 * the log up to the last complete line of the checkpoint
+		 * is therefore durable, and restoreCheckpoint() can cut
+		 * the log back to that point after a crash.
+		 */
+		class CheckpointedLog
+		{
+		public:
+			/** Default time between saves. */
+			static constexpr std::chrono::seconds DefaultInterval{
+			    10};
+
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param logPathName
+			 * Path to the log.
+			 * @param checkpointPathName
+			 * Path to the checkpoint. If it exists, both files are
+			 * appended to, as left by restoreCheckpoint().
+			 * Otherwise, both are created.
+			 * @param header
+			 * First line of a newly created log.
+			 * @param interval
+			 * Minimum time between automatic saves.
+			 *
+			 * @throw runtime_error
+			 * Error opening or writing either file.
+			 */
+			CheckpointedLog(
+			    const std::string &logPathName,
+			    const std::string &checkpointPathName,
+			    const std::string &header,
+			    const std::chrono::seconds interval =
+			        DefaultInterval);
+
+			/**
+			 * @brief
+			 * Add an entry to the log, saving if the interval
+			 * has elapsed.
+			 *
+			 * @param index
+			 * Item the entry describes.
+			 * @param entry
+			 * Line to log, without a newline.
+			 *
+			 * @throw runtime_error
+			 * Error writing either file.
+			 */
+			void
+			append(
+			    const uint64_t index,
+			    const std::string &entry);
+
+			/**
+			 * @brief
+			 * Flush the log and record the items added since the
+			 * last save.
+			 *
+			 * @throw runtime_error
+			 * Error writing either file.
+			 */
+			void
+			save();
+
+			/** Saves, ignoring errors. */
+			~CheckpointedLog();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			CheckpointedLog(const CheckpointedLog&) = delete;
+			CheckpointedLog& operator=(
+			    const CheckpointedLog&) = delete;
+			/** @endcond */
+
+		private:
+			/** Path to the log. */
+			const std::string logPathName;
+			/** Path to the checkpoint. */
+			const std::string checkpointPathName;
+			/** The log. */
+			std::ofstream log{};
+			/** The checkpoint. */
+			std::ofstream checkpoint{};
+			/** Bytes in the log, including unflushed entries. */
+			uint64_t length{};
+			/** Items added since the last save. */
+			std::vector<uint64_t> unsaved{};
+			/** Minimum time between automatic saves. */
+			const std::chrono::seconds interval;
+			/** Time of the last save. */
+			std::chrono::steady_clock::time_point lastSave{};
+		};
+
+		/**
+		 * @brief
+		 * Prepare a log left by an interrupted CheckpointedLog to be
+		 * appended to.
+		 *
+		 * @param logPathName
+		 * Path to the log.
+		 * @param checkpointPathName
+		 * Path to the checkpoint.
+		 *
+		 * @return
+		 * Items in the log as of the last complete save, or
+		 * std::nullopt if there was none, in which case both files
+		 * are removed.
+		 *
+		 * @throw runtime_error
+		 * Error reading or writing either file, or the log is
+		 * shorter than its checkpoint records.
+		 *
+		 * @note
+		 * Entries after the last complete save are cut from the log
+		 * and the checkpoint is compacted to a single line, so the
+		 * items returned are exactly those in the log.
+		 */
+		std::optional<std::vector<uint64_t>>
+		restoreCheckpoint(
+		    const std::string &logPathName,
+		    const std::string &checkpointPathName);
+	}
+}
+
+#endif /* PFTIII_VALIDATION_CHECKPOINT_H_ */
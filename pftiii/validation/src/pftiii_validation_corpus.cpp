@@ -0,0 +1,263 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <sys/stat.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+#include <pftiii_validation_corpus.h>
+
+namespace
+{
+	/** @return Description of the current errno. */
+	std::string
+	errnoMessage()
+	{
+		return (std::system_error(errno, std::system_category()).
+		    code().message());
+	}
+
+	/** @return `offset` rounded up to a multiple of CorpusAlignment. */
+	uint64_t
+	align(
+	    const uint64_t offset)
+	{
+		using PFTIII::Validation::CorpusAlignment;
+		return (((offset + CorpusAlignment - 1) / CorpusAlignment) *
+		    CorpusAlignment);
+	}
+
+	/**
+	 * @brief
+	 * Write a buffer at an offset, throwing on failure.
+	 */
+	void
+	writeAt(
+	    const int fd,
+	    const std::string &pathName,
+	    const void *buffer,
+	    const uint64_t size,
+	    const uint64_t offset)
+	{
+		uint64_t done{0};
+		while (done < size) {
+			const ssize_t count{::pwrite(fd,
+			    static_cast<const char*>(buffer) + done,
+			    size - done, static_cast<off_t>(offset + done))};
+			if (count == -1) {
+				if (errno == EINTR)
+					continue;
+				throw std::runtime_error("Could not write to " +
+				    pathName + " (" + errnoMessage() + ")");
+			}
+			done += static_cast<uint64_t>(count);
+		}
+	}
+}
+
+void
+PFTIII::Validation::buildImageCorpus(
+    const std::string &pathName,
+    const Dataset &images,
+    const std::function<std::vector<std::byte>(const std::string &name)>
+    &loader)
+{
+	/* Lay out the index first, so pixels can be written in one pass */
+	CorpusHeader header{};
+	header.count = images.getImageCount();
+	std::vector<char> index{};
+	std::vector<uint64_t> offsets{};
+	offsets.reserve(header.count);
+	uint64_t offset{0};
+	header.indexLength = header.count * sizeof(CorpusEntry);
+	for (uint64_t i{0}; i < header.count; ++i) {
+		const auto name = images.getImageName(i);
+		const auto md = images.getImageMetadata(i);
+		if (name.size() > std::numeric_limits<uint16_t>::max())
+			throw std::runtime_error("Image name too long: " +
+			    std::string(name));
+		offsets.push_back(offset);
+		offset = align(offset + (static_cast<uint64_t>(md.width) *
+		    md.height));
+		header.indexLength += name.size();
+	}
+	const uint64_t dataOffset{align(sizeof(header) + header.indexLength)};
+
+	index.reserve(header.indexLength);
+	for (uint64_t i{0}; i < header.count; ++i) {
+		const auto name = images.getImageName(i);
+		const auto md = images.getImageMetadata(i);
+
+		CorpusEntry entry{};
+		entry.offset = dataOffset + offsets[i];
+		entry.width = md.width;
+		entry.height = md.height;
+		entry.ppi = md.ppi;
+		entry.nameLength = static_cast<uint16_t>(name.size());
+		entry.imp = static_cast<uint8_t>(md.imp);
+		entry.frct = static_cast<uint8_t>(md.frct);
+		entry.frgp = static_cast<uint8_t>(md.frgp);
+
+		const auto *bytes = reinterpret_cast<const char*>(&entry);
+		index.insert(index.end(), bytes, bytes + sizeof(entry));
+		index.insert(index.end(), name.cbegin(), name.cend());
+	}
+
+	const int fd{::open(pathName.c_str(), O_WRONLY | O_CREAT | O_TRUNC |
+	    O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP)};
+	if (fd == -1)
+		throw std::runtime_error("Could not open " + pathName + " (" +
+		    errnoMessage() + ")");
+	try {
+		writeAt(fd, pathName, &header, sizeof(header), 0);
+		writeAt(fd, pathName, index.data(), index.size(),
+		    sizeof(header));
+
+		for (uint64_t i{0}; i < header.count; ++i) {
+			const std::string name{images.getImageName(i)};
+			const auto md = images.getImageMetadata(i);
+			const auto pixels = loader(name);
+			if (pixels.size() != (static_cast<uint64_t>(md.width) *
+			    md.height))
+				throw std::runtime_error(name + " holds " +
+				    std::to_string(pixels.size()) + " bytes, "
+				    "expected " + std::to_string(md.width) +
+				    "x" + std::to_string(md.height));
+			writeAt(fd, pathName, pixels.data(), pixels.size(),
+			    dataOffset + offsets[i]);
+		}
+
+		/* Pad the final image, so every image spans whole pages */
+		if (::ftruncate(fd, static_cast<off_t>(dataOffset + offset)) !=
+		    0)
+			throw std::runtime_error("Could not resize " +
+			    pathName + " (" + errnoMessage() + ")");
+	} catch (...) {
+		::close(fd);
+		throw;
+	}
+	if (::close(fd) != 0)
+		throw std::runtime_error("Could not write to " + pathName +
+		    " (" + errnoMessage() + ")");
+}
+
+PFTIII::Validation::ImageCorpusReader::ImageCorpusReader(
+    const std::string &pathName) :
+    pathName{pathName},
+    corpus{pathName, Advice::Random}
+{
+	const auto data = this->corpus.getData();
+	CorpusHeader header{};
+	if (data.size() < sizeof(header))
+		throw std::runtime_error(pathName + " is not an image corpus");
+	std::copy_n(data.data(), sizeof(header),
+	    reinterpret_cast<std::byte*>(&header));
+	if (header.magic != CorpusMagic)
+		throw std::runtime_error(pathName + " is not an image corpus");
+	if (header.version != CorpusVersion)
+		throw std::runtime_error(pathName + " is version " +
+		    std::to_string(header.version) + " of the image corpus "
+		    "format, expected " + std::to_string(CorpusVersion));
+	if (header.indexLength > (data.size() - sizeof(header)))
+		throw std::runtime_error("Index of " + pathName + " is "
+		    "truncated");
+	/* Images are read in no particular order, but the index is not */
+	this->corpus.advise(sizeof(header), header.indexLength,
+	    Advice::WillNeed);
+
+	const auto index = data.subspan(sizeof(header), header.indexLength);
+	this->entries.reserve(header.count);
+	this->names.reserve(header.count);
+	std::size_t position{0};
+	for (uint64_t i{0}; i < header.count; ++i) {
+		CorpusEntry entry{};
+		if (position + sizeof(entry) > index.size())
+			throw std::runtime_error("Index of " + pathName +
+			    " is truncated");
+		std::copy_n(index.data() + position, sizeof(entry),
+		    reinterpret_cast<std::byte*>(&entry));
+		position += sizeof(entry);
+
+		if (position + entry.nameLength > index.size())
+			throw std::runtime_error("Index of " + pathName +
+			    " is truncated");
+		std::string name(reinterpret_cast<const char*>(
+		    index.data() + position), entry.nameLength);
+		position += entry.nameLength;
+
+		if ((entry.offset + (static_cast<uint64_t>(entry.width) *
+		    entry.height)) > data.size())
+			throw std::runtime_error(pathName + " refers to pixels "
+			    "of " + name + " beyond its end");
+
+		this->positions[name] = this->entries.size();
+		this->entries.push_back(entry);
+		this->names.push_back(std::move(name));
+	}
+}
+
+const PFTIII::Validation::CorpusEntry&
+PFTIII::Validation::ImageCorpusReader::getEntry(
+    const std::string &name)
+    const
+{
+	const auto it = this->positions.find(name);
+	if (it == this->positions.end())
+		throw std::runtime_error("No image named " + name + " in " +
+		    this->pathName);
+	return (this->entries[it->second]);
+}
+
+std::span<const std::byte>
+PFTIII::Validation::ImageCorpusReader::view(
+    const std::string &name)
+    const
+{
+	const auto &entry = this->getEntry(name);
+	const uint64_t size{static_cast<uint64_t>(entry.width) *
+	    entry.height};
+	this->corpus.advise(entry.offset, size, Advice::WillNeed);
+	return (this->corpus.getData().subspan(entry.offset, size));
+}
+
+PFTIII::FingerImage
+PFTIII::Validation::ImageCorpusReader::read(
+    const std::string &name)
+    const
+{
+	const auto &entry = this->getEntry(name);
+	const auto pixels = this->view(name);
+
+	FingerImage image{};
+	image.width = entry.width;
+	image.height = entry.height;
+	image.ppi = entry.ppi;
+	image.imp = static_cast<Impression>(entry.imp);
+	image.frct = static_cast<FrictionRidgeCaptureTechnology>(entry.frct);
+	image.frgp = static_cast<FrictionRidgeGeneralizedPosition>(
+	    entry.frgp);
+	image.pixels.assign(pixels.begin(), pixels.end());
+
+	return (image);
+}
+
+std::vector<std::string>
+PFTIII::Validation::ImageCorpusReader::getNames()
+    const
+{
+	return (this->names);
+}
@@ -0,0 +1,203 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_CORPUS_H_
+#define PFTIII_VALIDATION_CORPUS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pftiii.h>
+#include <pftiii_validation_dataset.h>
+#include <pftiii_validation_file.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/*
+		 * A corpus is a CorpusHeader, followed by an index of
+		 * CorpusHeader::count CorpusEntrys, each followed by an
+		 * image's name. Raw pixels of each image follow the index,
+		 * each image starting at a multiple of CorpusAlignment bytes.
+		 * All integers are in host byte order.
+		 */
+
+		/** Identifies an image corpus. */
+		constexpr uint32_t CorpusMagic{0x49544650}; /* "PFTI" */
+		/** Version of the corpus format described here. */
+		constexpr uint32_t CorpusVersion{1};
+		/** Alignment of each image's pixels within a corpus. */
+		constexpr uint64_t CorpusAlignment{4096};
+
+		/** Start of an image corpus. */
+		struct CorpusHeader
+		{
+			/** CorpusMagic. */
+			uint32_t magic{CorpusMagic};
+			/** CorpusVersion. */
+			uint32_t version{CorpusVersion};
+			/** Number of images. */
+			uint64_t count{};
+			/** Number of bytes in the index that follows. */
+			uint64_t indexLength{};
+			/** Zero. */
+			uint64_t reserved{};
+		};
+		static_assert(sizeof(CorpusHeader) == 32);
+
+		/** Describes one image in a corpus's index. */
+		struct CorpusEntry
+		{
+			/** Offset of the image's pixels in the corpus. */
+			uint64_t offset{};
+			/** Width of image. */
+			uint16_t width{};
+			/** Height of image. */
+			uint16_t height{};
+			/** Resolution of image in pixels per inch. */
+			uint16_t ppi{};
+			/** Number of bytes in the name that follows. */
+			uint16_t nameLength{};
+			/** Impression type of the finger. */
+			uint8_t imp{};
+			/** Technology used to capture the image. */
+			uint8_t frct{};
+			/** Position of the finger. */
+			uint8_t frgp{};
+			/** Zero. */
+			uint8_t reserved[5]{};
+		};
+		static_assert(sizeof(CorpusEntry) == 24);
+
+		/**
+		 * @brief
+		 * Write images to a new corpus.
+		 *
+		 * @param pathName
+		 * Path to the corpus, replaced if it exists.
+		 * @param images
+		 * Images to include, stored in the order of the dataset.
+		 * @param loader
+		 * Returns the pixels of the image with a name.
+		 *
+		 * @throw runtime_error
+		 * Error loading an image, an image's size does not match its
+		 * metadata, or error writing the corpus.
+		 */
+		void
+		buildImageCorpus(
+		    const std::string &pathName,
+		    const Dataset &images,
+		    const std::function<std::vector<std::byte>(
+		    const std::string &name)> &loader);
+
+		/**
+		 * @brief
+		 * Reads images from a corpus by name.
+		 *
+		 * @details
+		 * The corpus is mapped into memory, so a single reader may be
+		 * shared between threads and between processes fork()ed
+		 * after its construction.
+		 */
+		class ImageCorpusReader
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param pathName
+			 * Path to the corpus.
+			 *
+			 * @throw runtime_error
+			 * Error mapping the corpus, or the corpus is
+			 * malformed.
+			 */
+			explicit ImageCorpusReader(
+			    const std::string &pathName);
+
+			/**
+			 * @brief
+			 * Obtain an image's pixels without copying.
+			 *
+			 * @param name
+			 * Name of the image.
+			 *
+			 * @return
+			 * View of the image's pixels, valid for the lifetime
+			 * of this object.
+			 *
+			 * @throw runtime_error
+			 * `name` is not in the corpus.
+			 */
+			std::span<const std::byte>
+			view(
+			    const std::string &name)
+			    const;
+
+			/**
+			 * @brief
+			 * Read an image.
+			 *
+			 * @param name
+			 * Name of the image.
+			 *
+			 * @return
+			 * The image, with metadata from the corpus.
+			 *
+			 * @throw runtime_error
+			 * `name` is not in the corpus.
+			 */
+			FingerImage
+			read(
+			    const std::string &name)
+			    const;
+
+			/** @return Names of all images, in corpus order. */
+			std::vector<std::string>
+			getNames()
+			    const;
+
+		private:
+			/**
+			 * @return
+			 * Entry for the image with `name`.
+			 *
+			 * @throw runtime_error
+			 * `name` is not in the corpus.
+			 */
+			const CorpusEntry&
+			getEntry(
+			    const std::string &name)
+			    const;
+
+			/** Path to the corpus. */
+			const std::string pathName;
+			/** The corpus. */
+			const MappedFile corpus;
+			/** Index, in corpus order. */
+			std::vector<CorpusEntry> entries{};
+			/** Names of images, in corpus order. */
+			std::vector<std::string> names{};
+			/** Position in `entries`, by name. */
+			std::unordered_map<std::string, std::size_t> positions{};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_CORPUS_H_ */
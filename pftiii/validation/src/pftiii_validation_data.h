@@ -11,8 +11,11 @@
 #ifndef PFTIII_VALIDATION_DATA_H_
 #define PFTIII_VALIDATION_DATA_H_
 
-#include <map>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 #include <pftiii.h>
 
@@ -26,8 +29,20 @@ namespace PFTIII
 		const std::string ImageDir{"images"};
 		/** Directory containing generated templates. */
 		const std::string TemplateDir{OutputDir + "/templates"};
+		/** Directory containing progress of interrupted runs. */
+		const std::string CheckpointDir{OutputDir + "/checkpoints"};
 		/** Suffix added to template files. */
 		const std::string TemplateSuffix{".tmpl"};
+		/** Start of the name of each template creation log. */
+		const std::string CreateLogPrefix{"createProprietaryTemplate"};
+		/** Start of the name of each template comparison log. */
+		const std::string CompareLogPrefix{"compareProprietaryTemplates"};
+		/** First line of each template creation log. */
+		const std::string CreateLogHeader{"name,elapsed,fisCode,"
+		    "\"fisMessage\",cptrResult,\"cptrMessage\",size"};
+		/** First line of each template comparison log. */
+		const std::string CompareLogHeader{"\"probeName\","
+		    "\"referenceName\",elapsed,rCode,\"rMessage\",similarity"};
 
 		/** Information about an image. */
 		struct ImageMetadata
@@ -49,7 +64,7 @@ namespace PFTIII
 			 * @param frgp
 			 * Friction ridge generalized position of the finger.
 			 */
-			ImageMetadata(
+			constexpr ImageMetadata(
 			    const uint16_t width,
 			    const uint16_t height,
 			    const uint16_t ppi,
@@ -79,9 +94,31 @@ namespace PFTIII
 
 		namespace Data
 		{
-			/* Validation imagery. */
-			const std::vector<std::pair<std::string,
-			    ImageMetadata>> Images {
+			/** An image of the validation set. */
+			struct Image
+			{
+				/** Name of the image's file in ImageDir. */
+				std::string_view name;
+				/** Information about the image. */
+				ImageMetadata metadata;
+			};
+
+			/** Two images of the validation set to compare. */
+			struct Pair
+			{
+				/** Index in Images of the probe. */
+				uint16_t probe;
+				/** Index in Images of the reference. */
+				uint16_t reference;
+			};
+
+			/*
+			 * The tables are constant-initialized, so no code runs
+			 * to build them and every process shares their pages.
+			 */
+
+			/** Validation imagery. */
+			inline constexpr auto Images = std::to_array<Image>({
 				{"00001000_SD300_273x421_500_00_02_05.gray",
 				    {273, 421, 500,
 				    Impression::PlainContact,
@@ -6445,2604 +6482,1309 @@ namespace PFTIII
 				        OpticalTIRBright,
 				    FrictionRidgeGeneralizedPosition::
 				        LeftLittle}},
-			};
+			});
 
-			/** Validation matching pairs */
-			const std::vector<std::pair<std::string, std::string>>
-			    Pairs = {
+			/** Validation matching pairs, as indicies in Images. */
+			inline constexpr auto Pairs = std::to_array<Pair>({
 				/* Mated */
-				{"00001000_SD300_256x306_500_00_02_04.gray",
-				    "00001000_SD300_734x687_500_01_02_04.gray"},
-				{"00001000_SD300_843x666_500_01_02_05.gray",
-				    "00001000_SD300_273x421_500_00_02_05.gray"},
-				{"00002472_S_256x322_500_00_03_02.gray",
-				    "00002472_N_311x384_500_00_03_02.gray"},
-				{"00002472_S_256x344_500_00_03_03.gray",
-				    "00002472_N_311x409_500_00_03_03.gray"},
-				{"00002472_S_256x381_500_00_03_07.gray",
-				    "00002472_N_294x455_500_00_03_07.gray"},
-				{"00002472_S_256x364_500_00_03_04.gray",
-				    "00002472_N_319x403_500_00_03_04.gray"},
-				{"00002472_S_256x382_500_00_03_08.gray",
-				    "00002472_N_310x420_500_00_03_08.gray"},
-				{"00002472_S_256x394_500_00_03_09.gray",
-				    "00002472_N_335x454_500_00_03_09.gray"},
-				{"00002466_S_275x439_500_00_03_02.gray",
-				    "00002466_N_290x427_500_00_03_02.gray"},
-				{"00002466_S_263x489_500_00_03_03.gray",
-				    "00002466_N_316x475_500_00_03_03.gray"},
-				{"00002466_S_288x420_500_00_03_07.gray",
-				    "00002466_N_295x403_500_00_03_07.gray"},
-				{"00002466_S_256x463_500_00_03_04.gray",
-				    "00002466_N_325x460_500_00_03_04.gray"},
-				{"00002466_S_258x445_500_00_03_08.gray",
-				    "00002466_N_288x468_500_00_03_08.gray"},
-				{"00002466_S_256x442_500_00_03_09.gray",
-				    "00002466_N_277x477_500_00_03_09.gray"},
-				{"00002495_S_271x435_500_00_03_02.gray",
-				    "00002495_N_357x419_500_00_03_02.gray"},
-				{"00002495_S_336x493_500_00_03_03.gray",
-				    "00002495_N_367x378_500_00_03_03.gray"},
-				{"00002495_S_268x437_500_00_03_07.gray",
-				    "00002495_N_336x463_500_00_03_07.gray"},
-				{"00002495_S_290x513_500_00_03_04.gray",
-				    "00002495_N_321x394_500_00_03_04.gray"},
-				{"00002495_S_291x455_500_00_03_08.gray",
-				    "00002495_N_325x413_500_00_03_08.gray"},
-				{"00002495_S_286x455_500_00_03_09.gray",
-				    "00002495_N_313x457_500_00_03_09.gray"},
-				{"00002497_S_293x414_500_00_03_02.gray",
-				    "00002497_N_270x359_500_00_03_02.gray"},
-				{"00002497_S_284x386_500_00_03_03.gray",
-				    "00002497_N_323x455_500_00_03_03.gray"},
-				{"00002497_S_293x420_500_00_03_07.gray",
-				    "00002497_N_256x347_500_00_03_07.gray"},
-				{"00002497_S_302x428_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002497_S_278x409_500_00_03_08.gray",
-				    "00002497_N_280x412_500_00_03_08.gray"},
-				{"00002497_S_301x494_500_00_03_09.gray",
-				    "00002497_N_317x520_500_00_03_09.gray"},
-				{"00002571_S_283x446_500_00_03_02.gray",
-				    "00002571_N_312x487_500_00_03_02.gray"},
-				{"00002571_S_270x487_500_00_03_03.gray",
-				    "00002571_N_324x556_500_00_03_03.gray"},
-				{"00002571_S_290x482_500_00_03_07.gray",
-				    "00002571_N_329x527_500_00_03_07.gray"},
-				{"00002571_S_256x458_500_00_03_04.gray",
-				    "00002571_N_302x477_500_00_03_04.gray"},
-				{"00002571_S_256x504_500_00_03_08.gray",
-				    "00002571_N_337x513_500_00_03_08.gray"},
-				{"00002571_S_267x515_500_00_03_09.gray",
-				    "00002571_N_317x501_500_00_03_09.gray"},
-				{"00002558_S_313x499_500_00_03_02.gray",
-				    "00002558_N_324x452_500_00_03_02.gray"},
-				{"00002558_S_286x509_500_00_03_03.gray",
-				    "00002558_N_298x489_500_00_03_03.gray"},
-				{"00002558_S_313x420_500_00_03_07.gray",
-				    "00002558_N_306x488_500_00_03_07.gray"},
-				{"00002558_S_267x490_500_00_03_04.gray",
-				    "00002558_N_348x559_500_00_03_04.gray"},
-				{"00002558_S_265x434_500_00_03_08.gray",
-				    "00002558_N_272x450_500_00_03_08.gray"},
-				{"00002558_S_256x436_500_00_03_09.gray",
-				    "00002558_N_303x492_500_00_03_09.gray"},
-				{"00002574_S_256x444_500_00_03_02.gray",
-				    "00002574_N_258x455_500_00_03_02.gray"},
-				{"00002574_S_256x454_500_00_03_03.gray",
-				    "00002574_N_299x480_500_00_03_03.gray"},
-				{"00002574_S_257x416_500_00_03_07.gray",
-				    "00002574_N_256x395_500_00_03_07.gray"},
-				{"00002574_S_256x468_500_00_03_04.gray",
-				    "00002574_N_286x468_500_00_03_04.gray"},
-				{"00002574_S_256x444_500_00_03_08.gray",
-				    "00002574_N_256x422_500_00_03_08.gray"},
-				{"00002574_S_256x470_500_00_03_09.gray",
-				    "00002574_N_256x466_500_00_03_09.gray"},
-				{"00002555_S_256x414_500_00_03_02.gray",
-				    "00002555_N_256x427_500_00_03_02.gray"},
-				{"00002555_S_256x413_500_00_03_03.gray",
-				    "00002555_N_303x433_500_00_03_03.gray"},
-				{"00002555_S_256x422_500_00_03_07.gray",
-				    "00002555_N_256x356_500_00_03_07.gray"},
-				{"00002555_S_256x474_500_00_03_04.gray",
-				    "00002555_N_302x512_500_00_03_04.gray"},
-				{"00002555_S_256x468_500_00_03_08.gray",
-				    "00002555_N_256x461_500_00_03_08.gray"},
-				{"00002555_S_256x492_500_00_03_09.gray",
-				    "00002555_N_256x438_500_00_03_09.gray"},
-				{"00002578_S_256x421_500_00_03_02.gray",
-				    "00002578_N_267x446_500_00_03_02.gray"},
-				{"00002578_S_256x446_500_00_03_03.gray",
-				    "00002578_N_293x434_500_00_03_03.gray"},
-				{"00002578_S_256x432_500_00_03_07.gray",
-				    "00002578_N_256x376_500_00_03_07.gray"},
-				{"00002578_S_256x458_500_00_03_04.gray",
-				    "00002578_N_271x466_500_00_03_04.gray"},
-				{"00002578_S_279x475_500_00_03_08.gray",
-				    "00002578_N_256x435_500_00_03_08.gray"},
-				{"00002578_S_256x416_500_00_03_09.gray",
-				    "00002578_N_266x408_500_00_03_09.gray"},
-				{"00002579_S_99x99_500_00_03_02.gray",
-				    "00002579_N_315x419_500_00_03_02.gray"},
-				{"00002579_S_265x431_500_00_03_03.gray",
-				    "00002579_N_336x452_500_00_03_03.gray"},
-				{"00002579_S_265x431_500_29_00_00.gray",
-				    "00002579_N_336x452_500_00_03_03.gray"},
-				{"00002579_S_292x465_500_00_03_07.gray",
-				    "00002579_N_296x438_500_00_03_07.gray"},
-				{"00002579_S_276x433_500_00_03_04.gray",
-				    "00002579_N_329x433_500_00_03_04.gray"},
-				{"00002579_S_279x461_500_00_03_08.gray",
-				    "00002579_N_294x486_500_00_03_08.gray"},
-				{"00002579_S_278x444_500_00_03_09.gray",
-				    "00002579_N_311x490_500_00_03_09.gray"},
-				{"00002550_S_256x484_500_00_03_02.gray",
-				    "00002550_N_294x522_500_00_03_02.gray"},
-				{"00002550_S_261x479_500_00_03_03.gray",
-				    "00002550_N_256x494_500_00_03_03.gray"},
-				{"00002550_S_256x503_500_00_03_07.gray",
-				    "00002550_N_269x519_500_00_03_07.gray"},
-				{"00002550_S_256x419_500_00_03_04.gray",
-				    "00002550_N_275x533_500_00_03_04.gray"},
-				{"00002550_S_256x465_500_00_03_08.gray",
-				    "00002550_N_256x462_500_00_03_08.gray"},
-				{"00002550_S_256x401_500_00_03_09.gray",
-				    "00002550_N_259x505_500_00_03_09.gray"},
-				{"00002551_S_256x383_500_00_03_02.gray",
-				    "00002551_N_281x405_500_00_03_02.gray"},
-				{"00002551_S_256x414_500_00_03_03.gray",
-				    "00002551_N_268x449_500_00_03_03.gray"},
-				{"00002551_S_257x402_500_00_03_07.gray",
-				    "00002551_N_273x411_500_00_03_07.gray"},
-				{"00002551_S_256x420_500_00_03_04.gray",
-				    "00002551_N_256x420_500_00_03_04.gray"},
-				{"00002551_S_256x450_500_00_03_08.gray",
-				    "00002551_N_277x425_500_00_03_08.gray"},
-				{"00002551_S_256x425_500_00_03_09.gray",
-				    "00002551_N_256x425_500_00_03_09.gray"},
-				{"00002537_S_256x345_500_00_03_02.gray",
-				    "00002537_N_315x399_500_00_03_02.gray"},
-				{"00002537_S_256x375_500_00_03_03.gray",
-				    "00002537_N_318x422_500_00_03_03.gray"},
-				{"00002537_S_256x310_500_00_03_07.gray",
-				    "00002537_N_279x392_500_00_03_07.gray"},
-				{"00002537_S_256x379_500_00_03_04.gray",
-				    "00002537_N_322x413_500_00_03_04.gray"},
-				{"00002537_S_256x367_500_00_03_08.gray",
-				    "00002537_N_300x457_500_00_03_08.gray"},
-				{"00002537_S_256x375_500_00_03_09.gray",
-				    "00002537_N_294x439_500_00_03_09.gray"},
-				{"00002534_S_256x380_500_00_03_02.gray",
-				    "00002534_N_256x390_500_00_03_02.gray"},
-				{"00002534_S_256x352_500_00_03_03.gray",
-				    "00002534_N_256x378_500_00_03_03.gray"},
-				{"00002534_S_256x403_500_00_03_07.gray",
-				    "00002534_N_256x367_500_00_03_07.gray"},
-				{"00002534_S_256x388_500_00_03_04.gray",
-				    "00002534_N_256x434_500_00_03_04.gray"},
-				{"00002534_S_256x412_500_00_03_08.gray",
-				    "00002534_N_256x412_500_00_03_08.gray"},
-				{"00002534_S_256x418_500_00_03_09.gray",
-				    "00002534_N_256x434_500_00_03_09.gray"},
-				{"00002535_S_286x417_500_00_03_02.gray",
-				    "00002535_N_302x417_500_00_03_02.gray"},
-				{"00002535_S_279x428_500_00_03_03.gray",
-				    "00002535_N_297x408_500_00_03_03.gray"},
-				{"00002535_S_277x464_500_00_03_07.gray",
-				    "00002535_N_308x468_500_00_03_07.gray"},
-				{"00002535_S_273x447_500_00_03_04.gray",
-				    "00002535_N_302x468_500_00_03_04.gray"},
-				{"00002535_S_286x455_500_00_03_08.gray",
-				    "00002535_N_325x408_500_00_03_08.gray"},
-				{"00002535_S_290x444_500_00_03_09.gray",
-				    "00002535_N_290x426_500_00_03_09.gray"},
-				{"00002515_S_256x419_500_00_03_02.gray",
-				    "00002515_N_256x415_500_00_03_02.gray"},
-				{"00002515_S_256x440_500_00_03_03.gray",
-				    "00002515_N_256x486_500_00_03_03.gray"},
-				{"00002515_S_256x419_500_00_03_07.gray",
-				    "00002515_N_256x412_500_00_03_07.gray"},
-				{"00002515_S_256x425_500_00_03_04.gray",
-				    "00002515_N_256x420_500_00_03_04.gray"},
-				{"00002515_S_256x436_500_00_03_08.gray",
-				    "00002515_N_256x427_500_00_03_08.gray"},
-				{"00002515_S_256x425_500_00_03_09.gray",
-				    "00002515_N_256x460_500_00_03_09.gray"},
-				{"00002516_S_267x435_500_00_03_02.gray",
-				    "00002516_N_266x469_500_00_03_02.gray"},
-				{"00002516_S_261x436_500_00_03_03.gray",
-				    "00002516_N_308x471_500_00_03_03.gray"},
-				{"00002516_S_269x429_500_00_03_07.gray",
-				    "00002516_N_287x433_500_00_03_07.gray"},
-				{"00002516_S_256x420_500_00_03_04.gray",
-				    "00002516_N_270x443_500_00_03_04.gray"},
-				{"00002516_S_273x424_500_00_03_08.gray",
-				    "00002516_N_315x469_500_00_03_08.gray"},
-				{"00002516_S_256x431_500_00_03_09.gray",
-				    "00002516_N_265x453_500_00_03_09.gray"},
-				{"00002531_S_256x390_500_00_03_02.gray",
-				    "00002531_N_256x393_500_00_03_02.gray"},
-				{"00002531_S_256x374_500_00_03_03.gray",
-				    "00002531_N_256x368_500_00_03_03.gray"},
-				{"00002531_S_265x408_500_00_03_07.gray",
-				    "00002531_N_256x363_500_00_03_07.gray"},
-				{"00002531_S_256x420_500_00_03_04.gray",
-				    "00002531_N_269x430_500_00_03_04.gray"},
-				{"00002531_S_269x402_500_00_03_08.gray",
-				    "00002531_N_271x360_500_00_03_08.gray"},
-				{"00002531_S_261x420_500_00_03_09.gray",
-				    "00002531_N_256x375_500_00_03_09.gray"},
-				{"00002547_S_257x414_500_00_03_02.gray",
-				    "00002547_N_256x452_500_00_03_02.gray"},
-				{"00002547_S_266x483_500_00_03_03.gray",
-				    "00002547_N_278x430_500_00_03_03.gray"},
-				{"00002547_S_256x428_500_00_03_07.gray",
-				    "00002547_N_256x474_500_00_03_07.gray"},
-				{"00002547_S_256x433_500_00_03_04.gray",
-				    "00002547_N_256x431_500_00_03_04.gray"},
-				{"00002547_S_258x460_500_00_03_08.gray",
-				    "00002547_N_299x452_500_00_03_08.gray"},
-				{"00002547_S_256x478_500_00_03_09.gray",
-				    "00002547_N_274x485_500_00_03_09.gray"},
-				{"00002533_S_256x401_500_00_03_02.gray",
-				    "00002533_N_319x439_500_00_03_02.gray"},
-				{"00002533_S_256x391_500_00_03_03.gray",
-				    "00002533_N_296x433_500_00_03_03.gray"},
-				{"00002533_S_256x424_500_00_03_07.gray",
-				    "00002533_N_272x528_500_00_03_07.gray"},
-				{"00002533_S_256x444_500_00_03_04.gray",
-				    "00002533_N_313x475_500_00_03_04.gray"},
-				{"00002533_S_256x329_500_00_03_08.gray",
-				    "00002533_N_296x514_500_00_03_08.gray"},
-				{"00002533_S_256x380_500_00_03_09.gray",
-				    "00002533_N_307x541_500_00_03_09.gray"},
-				{"00002478_S_256x438_500_00_03_02.gray",
-				    "00002478_N_324x468_500_00_03_02.gray"},
-				{"00002478_S_256x461_500_00_03_03.gray",
-				    "00002478_N_324x471_500_00_03_03.gray"},
-				{"00002478_S_256x411_500_00_03_07.gray",
-				    "00002478_N_311x445_500_00_03_07.gray"},
-				{"00002478_S_256x405_500_00_03_04.gray",
-				    "00002478_N_308x478_500_00_03_04.gray"},
-				{"00002478_S_256x435_500_00_03_08.gray",
-				    "00002478_N_256x482_500_00_03_08.gray"},
-				{"00002478_S_256x404_500_00_03_09.gray",
-				    "00002478_N_277x463_500_00_03_09.gray"},
-				{"00002475_S_281x408_500_00_03_02.gray",
-				    "00002475_N_316x374_500_00_03_02.gray"},
-				{"00002475_S_277x454_500_00_03_03.gray",
-				    "00002475_N_277x412_500_00_03_03.gray"},
-				{"00002475_S_263x392_500_00_03_07.gray",
-				    "00002475_N_312x388_500_00_03_07.gray"},
-				{"00002475_S_264x421_500_00_03_04.gray",
-				    "00002475_N_327x452_500_00_03_04.gray"},
-				{"00002475_S_256x411_500_00_03_08.gray",
-				    "00002475_N_296x432_500_00_03_08.gray"},
-				{"00002475_S_256x431_500_00_03_09.gray",
-				    "00002475_N_296x433_500_00_03_09.gray"},
-				{"00002483_S_256x361_500_00_03_02.gray",
-				    "00002483_N_272x445_500_00_03_02.gray"},
-				{"00002483_S_256x374_500_00_03_03.gray",
-				    "00002483_N_300x430_500_00_03_03.gray"},
-				{"00002483_S_256x397_500_00_03_07.gray",
-				    "00002483_N_256x412_500_00_03_07.gray"},
-				{"00002483_S_256x410_500_00_03_04.gray",
-				    "00002483_N_281x522_500_00_03_04.gray"},
-				{"00002483_S_256x375_500_00_03_08.gray",
-				    "00002483_N_256x403_500_00_03_08.gray"},
-				{"00002483_S_256x442_500_00_03_09.gray",
-				    "00002483_N_256x441_500_00_03_09.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "00002480_N_334x463_500_00_03_02.gray"},
-				{"00002480_S_288x459_500_00_03_03.gray",
-				    "00002480_N_317x453_500_00_03_03.gray"},
-				{"00002480_S_293x429_500_00_03_07.gray",
-				    "00002480_N_318x452_500_00_03_07.gray"},
-				{"00002480_S_268x468_500_00_03_04.gray",
-				    "00002480_N_311x449_500_00_03_04.gray"},
-				{"00002480_S_280x449_500_00_03_08.gray",
-				    "00002480_N_295x429_500_00_03_08.gray"},
-				{"00002480_S_283x445_500_00_03_09.gray",
-				    "00002480_N_292x424_500_00_03_09.gray"},
-				{"00002561_S_263x377_500_00_03_02.gray",
-				    "00002561_N_319x391_500_00_03_02.gray"},
-				{"00002561_S_256x382_500_00_03_03.gray",
-				    "00002561_N_316x402_500_00_03_03.gray"},
-				{"00002561_S_260x379_500_00_03_07.gray",
-				    "00002561_N_301x413_500_00_03_07.gray"},
-				{"00002561_S_256x363_500_00_03_04.gray",
-				    "00002561_N_300x422_500_00_03_04.gray"},
-				{"00002561_S_257x411_500_00_03_08.gray",
-				    "00002561_N_322x405_500_00_03_08.gray"},
-				{"00002561_S_256x384_500_00_03_09.gray",
-				    "00002561_N_303x427_500_00_03_09.gray"},
-				{"00002560_S_259x388_500_00_03_02.gray",
-				    "00002560_N_331x447_500_00_03_02.gray"},
-				{"00002560_S_258x408_500_00_03_03.gray",
-				    "00002560_N_306x484_500_00_03_03.gray"},
-				{"00002560_S_256x401_500_00_03_07.gray",
-				    "00002560_N_311x453_500_00_03_07.gray"},
-				{"00002560_S_268x396_500_00_03_04.gray",
-				    "00002560_N_276x420_500_00_03_04.gray"},
-				{"00002560_S_256x418_500_00_03_08.gray",
-				    "00002560_N_263x432_500_00_03_08.gray"},
-				{"00002560_S_256x419_500_00_03_09.gray",
-				    "00002560_N_326x465_500_00_03_09.gray"},
-				{"00002484_S_257x339_500_00_03_02.gray",
-				    "00002484_N_292x362_500_00_03_02.gray"},
-				{"00002484_S_267x375_500_00_03_03.gray",
-				    "00002484_N_284x350_500_00_03_03.gray"},
-				{"00002484_S_275x361_500_00_03_07.gray",
-				    "00002484_N_280x330_500_00_03_07.gray"},
-				{"00002484_S_273x386_500_00_03_04.gray",
-				    "00002484_N_294x383_500_00_03_04.gray"},
-				{"00002484_S_256x352_500_00_03_08.gray",
-				    "00002484_N_266x361_500_00_03_08.gray"},
-				{"00002484_S_256x337_500_00_03_09.gray",
-				    "00002484_N_283x358_500_00_03_09.gray"},
-				{"00002556_S_256x346_500_00_03_02.gray",
-				    "00002556_N_266x437_500_00_03_02.gray"},
-				{"00002556_S_256x373_500_00_03_03.gray",
-				    "00002556_N_272x474_500_00_03_03.gray"},
-				{"00002556_S_256x378_500_00_03_07.gray",
-				    "00002556_N_263x414_500_00_03_07.gray"},
-				{"00002556_S_256x432_500_00_03_04.gray",
-				    "00002556_N_303x490_500_00_03_04.gray"},
-				{"00002556_S_256x380_500_00_03_08.gray",
-				    "00002556_N_269x467_500_00_03_08.gray"},
-				{"00002556_S_256x388_500_00_03_09.gray",
-				    "00002556_N_260x460_500_00_03_09.gray"},
-				{"00002521_S_308x483_500_00_03_02.gray",
-				    "00002521_N_344x490_500_00_03_02.gray"},
-				{"00002521_S_313x524_500_00_03_03.gray",
-				    "00002521_N_386x515_500_00_03_03.gray"},
-				{"00002521_S_309x503_500_00_03_07.gray",
-				    "00002521_N_361x490_500_00_03_07.gray"},
-				{"00002521_S_298x520_500_00_03_04.gray",
-				    "00002521_N_382x516_500_00_03_04.gray"},
-				{"00002521_S_310x552_500_00_03_08.gray",
-				    "00002521_N_334x512_500_00_03_08.gray"},
-				{"00002521_S_259x474_500_00_03_09.gray",
-				    "00002521_N_345x544_500_00_03_09.gray"},
-				{"00002546_S_280x469_500_00_03_02.gray",
-				    "00002546_N_294x441_500_00_03_02.gray"},
-				{"00002546_S_283x471_500_00_03_03.gray",
-				    "00002546_N_256x457_500_00_03_03.gray"},
-				{"00002546_S_256x423_500_00_03_07.gray",
-				    "00002546_N_256x423_500_00_03_07.gray"},
-				{"00002546_S_273x471_500_00_03_04.gray",
-				    "00002546_N_309x489_500_00_03_04.gray"},
-				{"00002546_S_256x469_500_00_03_08.gray",
-				    "00002546_N_256x450_500_00_03_08.gray"},
-				{"00002546_S_256x385_500_00_03_09.gray",
-				    "00002546_N_277x489_500_00_03_09.gray"},
-				{"00002523_S_275x358_500_00_03_02.gray",
-				    "00002523_N_256x308_500_00_03_02.gray"},
-				{"00002523_S_271x388_500_00_03_03.gray",
-				    "00002523_N_262x372_500_00_03_03.gray"},
-				{"00002523_S_256x328_500_00_03_07.gray",
-				    "00002523_N_307x321_500_00_03_07.gray"},
-				{"00002523_S_260x372_500_00_03_04.gray",
-				    "00002523_N_332x387_500_00_03_04.gray"},
-				{"00002523_S_256x357_500_00_03_08.gray",
-				    "00002523_N_301x336_500_00_03_08.gray"},
-				{"00002523_S_267x374_500_00_03_09.gray",
-				    "00002523_N_346x370_500_00_03_09.gray"},
-				{"00002569_S_256x427_500_00_03_02.gray",
-				    "00002569_N_305x420_500_00_03_02.gray"},
-				{"00002569_S_290x485_500_00_03_03.gray",
-				    "00002569_N_281x455_500_00_03_03.gray"},
-				{"00002569_S_267x411_500_00_03_07.gray",
-				    "00002569_N_256x424_500_00_03_07.gray"},
-				{"00002569_S_258x412_500_00_03_04.gray",
-				    "00002569_N_294x438_500_00_03_04.gray"},
-				{"00002569_S_290x443_500_00_03_08.gray",
-				    "00002569_N_258x467_500_00_03_08.gray"},
-				{"00002569_S_277x412_500_00_03_09.gray",
-				    "00002569_N_269x468_500_00_03_09.gray"},
-				{"00002542_S_260x419_500_00_03_02.gray",
-				    "00002542_N_282x477_500_00_03_02.gray"},
-				{"00002542_S_256x429_500_00_03_03.gray",
-				    "00002542_N_256x423_500_00_03_03.gray"},
-				{"00002542_S_256x425_500_00_03_07.gray",
-				    "00002542_N_282x461_500_00_03_07.gray"},
-				{"00002542_S_256x441_500_00_03_04.gray",
-				    "00002542_N_282x479_500_00_03_04.gray"},
-				{"00002542_S_256x426_500_00_03_08.gray",
-				    "00002542_N_303x442_500_00_03_08.gray"},
-				{"00002542_S_256x448_500_00_03_09.gray",
-				    "00002542_N_293x451_500_00_03_09.gray"},
-				{"00002541_S_277x472_500_00_03_02.gray",
-				    "00002541_N_302x485_500_00_03_02.gray"},
-				{"00002541_S_257x502_500_00_03_03.gray",
-				    "00002541_N_313x513_500_00_03_03.gray"},
-				{"00002541_S_262x486_500_00_03_07.gray",
-				    "00002541_N_259x447_500_00_03_07.gray"},
-				{"00002541_S_256x491_500_00_03_04.gray",
-				    "00002541_N_304x508_500_00_03_04.gray"},
-				{"00002541_S_256x496_500_00_03_08.gray",
-				    "00002541_N_283x453_500_00_03_08.gray"},
-				{"00002541_S_256x470_500_00_03_09.gray",
-				    "00002541_N_258x492_500_00_03_09.gray"},
-				{"00002502_S_256x377_500_00_03_02.gray",
-				    "00002502_N_256x327_500_00_03_02.gray"},
-				{"00002502_S_256x376_500_00_03_03.gray",
-				    "00002502_N_258x332_500_00_03_03.gray"},
-				{"00002502_S_256x379_500_00_03_07.gray",
-				    "00002502_N_298x446_500_00_03_07.gray"},
-				{"00002502_S_256x378_500_00_03_04.gray",
-				    "00002502_N_256x373_500_00_03_04.gray"},
-				{"00002502_S_256x402_500_00_03_08.gray",
-				    "00002502_N_280x427_500_00_03_08.gray"},
-				{"00002502_S_256x369_500_00_03_09.gray",
-				    "00002502_N_256x391_500_00_03_09.gray"},
-				{"00002500_S_256x397_500_00_03_02.gray",
-				    "00002500_N_276x386_500_00_03_02.gray"},
-				{"00002500_S_256x409_500_00_03_03.gray",
-				    "00002500_N_256x408_500_00_03_03.gray"},
-				{"00002500_S_256x394_500_00_03_07.gray",
-				    "00002500_N_256x373_500_00_03_07.gray"},
-				{"00002500_S_256x399_500_00_03_04.gray",
-				    "00002500_N_287x420_500_00_03_04.gray"},
-				{"00002500_S_256x415_500_00_03_08.gray",
-				    "00002500_N_256x400_500_00_03_08.gray"},
-				{"00002500_S_256x378_500_00_03_09.gray",
-				    "00002500_N_257x413_500_00_03_09.gray"},
-				{"00002505_S_307x442_500_00_03_02.gray",
-				    "00002505_N_331x443_500_00_03_02.gray"},
-				{"00002505_S_321x486_500_00_03_03.gray",
-				    "00002505_N_366x482_500_00_03_03.gray"},
-				{"00002505_S_302x480_500_00_03_07.gray",
-				    "00002505_N_283x363_500_00_03_07.gray"},
-				{"00002505_S_305x454_500_00_03_04.gray",
-				    "00002505_N_385x497_500_00_03_04.gray"},
-				{"00002505_S_329x485_500_00_03_08.gray",
-				    "00002505_N_259x386_500_00_03_08.gray"},
-				{"00002505_S_301x463_500_00_03_09.gray",
-				    "00002505_N_288x440_500_00_03_09.gray"},
-				{"00002504_S_268x441_500_00_03_02.gray",
-				    "00002504_N_310x458_500_00_03_02.gray"},
-				{"00002504_S_289x435_500_00_03_03.gray",
-				    "00002504_N_321x501_500_00_03_03.gray"},
-				{"00002504_S_284x456_500_00_03_07.gray",
-				    "00002504_N_320x470_500_00_03_07.gray"},
-				{"00002504_S_265x415_500_00_03_04.gray",
-				    "00002504_N_282x461_500_00_03_04.gray"},
-				{"00002504_S_309x431_500_00_03_08.gray",
-				    "00002504_N_286x481_500_00_03_08.gray"},
-				{"00002504_S_264x482_500_00_03_09.gray",
-				    "00002504_N_290x502_500_00_03_09.gray"},
-				{"00002488_S_324x483_500_00_03_02.gray",
-				    "00002488_N_365x494_500_00_03_02.gray"},
-				{"00002488_S_296x482_500_00_03_03.gray",
-				    "00002488_N_370x505_500_00_03_03.gray"},
-				{"00002488_S_334x470_500_00_03_07.gray",
-				    "00002488_N_316x459_500_00_03_07.gray"},
-				{"00002488_S_296x461_500_00_03_04.gray",
-				    "00002488_N_292x406_500_00_03_04.gray"},
-				{"00002488_S_278x455_500_00_03_08.gray",
-				    "00002488_N_334x487_500_00_03_08.gray"},
-				{"00002488_S_276x476_500_00_03_09.gray",
-				    "00002488_N_310x508_500_00_03_09.gray"},
-
+				{1, 3},
+				{4, 0},
+				{427, 838},
+				{211, 324},
+				{866, 470},
+				{541, 306},
+				{902, 246},
+				{497, 217},
+				{399, 224},
+				{569, 384},
+				{103, 801},
+				{898, 882},
+				{225, 519},
+				{331, 813},
+				{543, 575},
+				{704, 537},
+				{853, 864},
+				{118, 485},
+				{501, 460},
+				{710, 797},
+				{733, 289},
+				{837, 341},
+				{613, 315},
+				{394, 159},
+				{522, 861},
+				{665, 559},
+				{699, 365},
+				{873, 858},
+				{194, 249},
+				{848, 670},
+				{83, 483},
+				{481, 845},
+				{13, 333},
+				{720, 642},
+				{667, 309},
+				{716, 895},
+				{51, 754},
+				{132, 506},
+				{808, 121},
+				{689, 809},
+				{445, 692},
+				{830, 319},
+				{729, 818},
+				{637, 600},
+				{668, 892},
+				{204, 790},
+				{181, 489},
+				{539, 130},
+				{891, 329},
+				{171, 804},
+				{815, 673},
+				{894, 401},
+				{492, 416},
+				{718, 58},
+				{639, 227},
+				{351, 191},
+				{316, 533},
+				{148, 310},
+				{149, 310},
+				{431, 133},
+				{555, 366},
+				{888, 469},
+				{48, 380},
+				{588, 615},
+				{372, 796},
+				{741, 219},
+				{734, 442},
+				{76, 761},
+				{883, 251},
+				{79, 36},
+				{26, 185},
+				{296, 238},
+				{292, 257},
+				{323, 657},
+				{565, 875},
+				{387, 860},
+				{167, 282},
+				{833, 561},
+				{212, 67},
+				{564, 605},
+				{868, 155},
+				{834, 523},
+				{422, 178},
+				{160, 240},
+				{614, 455},
+				{783, 281},
+				{367, 471},
+				{476, 111},
+				{390, 609},
+				{824, 706},
+				{817, 379},
+				{574, 736},
+				{677, 454},
+				{643, 821},
+				{512, 64},
+				{150, 232},
+				{244, 393},
+				{757, 136},
+				{355, 164},
+				{398, 147},
+				{139, 795},
+				{28, 551},
+				{295, 353},
+				{653, 893},
+				{192, 738},
+				{223, 513},
+				{261, 788},
+				{403, 108},
+				{468, 879},
+				{669, 658},
+				{122, 439},
+				{183, 688},
+				{839, 46},
+				{421, 724},
+				{684, 835},
+				{235, 779},
+				{206, 193},
+				{175, 751},
+				{205, 456},
+				{321, 780},
+				{807, 831},
+				{354, 389},
+				{852, 180},
+				{184, 434},
+				{34, 773},
+				{270, 262},
+				{632, 151},
+				{115, 339},
+				{120, 661},
+				{37, 547},
+				{532, 369},
+				{526, 320},
+				{357, 604},
+				{307, 127},
+				{229, 694},
+				{345, 679},
+				{662, 760},
+				{775, 414},
+				{23, 640},
+				{693, 117},
+				{484, 248},
+				{616, 832},
+				{731, 823},
+				{218, 432},
+				{31, 247},
+				{213, 362},
+				{847, 597},
+				{349, 275},
+				{197, 39},
+				{477, 391},
+				{243, 664},
+				{35, 234},
+				{674, 573},
+				{702, 61},
+				{786, 44},
+				{877, 370},
+				{558, 690},
+				{131, 849},
+				{510, 443},
+				{9, 765},
+				{806, 143},
+				{869, 713},
+				{195, 101},
+				{846, 285},
+				{395, 578},
+				{854, 162},
+				{78, 459},
+				{645, 250},
+				{433, 698},
+				{752, 515},
+				{301, 462},
+				{650, 682},
+				{511, 548},
+				{388, 280},
+				{816, 899},
+				{15, 646},
+				{336, 691},
+				{800, 607},
+				{407, 636},
+				{426, 805},
+				{774, 96},
+				{435, 303},
+				{11, 42},
+				{458, 550},
+				{631, 408},
+				{625, 746},
+				{553, 758},
+				{47, 107},
+				{544, 437},
+				{890, 170},
+				{709, 743},
+				{887, 638},
+				{55, 419},
+				{24, 851},
+				{725, 263},
+				{628, 701},
+				{266, 196},
+				{90, 33},
+				{683, 678},
+				{93, 187},
+				{798, 332},
+				{722, 785},
+				{711, 778},
+				{110, 863},
+				{382, 719},
+				{69, 841},
+				{293, 29},
+				{626, 169},
+				{811, 482},
+				{687, 371},
+				{568, 314},
+				{74, 651},
+				{45, 119},
+				{340, 82},
+				{318, 648},
+				{300, 502},
+				{424, 43},
+				{98, 145},
+				{344, 732},
+				{571, 158},
+				{84, 504},
+				{165, 297},
+				{18, 325},
+				{142, 708},
+				{763, 727},
+				{386, 129},
+				{840, 776},
+				{141, 881},
+				{827, 871},
+				{525, 12},
+				{478, 703},
+				{671, 68},
+				{81, 602},
+				{392, 146},
+				{585, 545},
+				{157, 268},
+				{402, 865},
 				/* Same subject, different finger */
-				{"00001000_SD300_257x429_500_00_02_02.gray",
-				    "00001000_SD300_734x680_500_01_02_03.gray"},
-				{"00002448_A_512x512_500_41_05_07.gray",
-				    "00002448_U_1600x1500_1000_01_03_06.gray"},
-				{"00002449_A_512x512_500_41_05_09.gray",
-				    "00002449_M_256x360_500_00_09_08.gray"},
-				{"00002472_S_256x344_500_00_03_03.gray",
-				    "00002472_N_335x454_500_00_03_09.gray"},
-				{"00002445_A_512x512_500_41_05_03.gray",
-				    "00002445_U_1600x1500_1000_01_03_07.gray"},
-				{"00002466_S_256x442_500_00_03_09.gray",
-				    "00002466_N_316x475_500_00_03_03.gray"},
-				{"00002434_A_512x512_500_41_05_07.gray",
-				    "00002434_U_1600x1500_1000_01_03_01.gray"},
-				{"00002497_S_301x494_500_00_03_09.gray",
-				    "00002497_N_323x455_500_00_03_03.gray"},
-				{"00002571_S_270x487_500_00_03_03.gray",
-				    "00002571_N_312x487_500_00_03_02.gray"},
-				{"00002558_S_286x509_500_00_03_03.gray",
-				    "00002558_N_306x488_500_00_03_07.gray"},
-				{"00002574_S_257x416_500_00_03_07.gray",
-				    "00002574_N_256x422_500_00_03_08.gray"},
-				{"00002555_S_256x474_500_00_03_04.gray",
-				    "00002555_N_256x427_500_00_03_02.gray"},
-				{"00002578_S_256x446_500_00_03_03.gray",
-				    "00002578_N_267x446_500_00_03_02.gray"},
-				{"00002579_S_278x444_500_00_03_09.gray",
-				    "00002579_N_329x433_500_00_03_04.gray"},
-				{"00002550_S_256x484_500_00_03_02.gray",
-				    "00002550_N_259x505_500_00_03_09.gray"},
-				{"00002551_S_256x450_500_00_03_08.gray",
-				    "00002551_N_256x425_500_00_03_09.gray"},
-				{"00002537_S_256x310_500_00_03_07.gray",
-				    "00002537_N_322x413_500_00_03_04.gray"},
-				{"00002535_S_279x428_500_00_03_03.gray",
-				    "00002535_N_290x426_500_00_03_09.gray"},
-				{"00002515_S_256x419_500_00_03_02.gray",
-				    "00002515_N_256x460_500_00_03_09.gray"},
-				{"00002516_S_269x429_500_00_03_07.gray",
-				    "00002516_N_270x443_500_00_03_04.gray"},
-				{"00002531_S_269x402_500_00_03_08.gray",
-				    "00002531_N_256x375_500_00_03_09.gray"},
-				{"00002547_S_257x414_500_00_03_02.gray",
-				    "00002547_N_278x430_500_00_03_03.gray"},
-				{"00002435_A_512x512_500_41_05_01.gray",
-				    "00002435_U_1600x1500_1000_01_03_10.gray"},
-				{"00002478_S_256x405_500_00_03_04.gray",
-				    "00002478_N_324x471_500_00_03_03.gray"},
-				{"00002433_A_512x512_500_41_05_04.gray",
-				    "00002433_M_256x360_500_00_09_05.gray"},
-				{"00002457_A_512x512_500_41_05_10.gray",
-				    "00002457_M_256x360_500_00_09_04.gray"},
-				{"00002458_A_512x512_500_41_05_02.gray",
-				    "00002458_M_256x360_500_00_09_03.gray"},
-				{"00002439_A_512x512_500_41_05_09.gray",
-				    "00002439_U_1600x1500_1000_01_03_06.gray"},
-				{"00002475_S_277x454_500_00_03_03.gray",
-				    "00002475_N_312x388_500_00_03_07.gray"},
-				{"00002483_S_256x410_500_00_03_04.gray",
-				    "00002483_N_256x441_500_00_03_09.gray"},
-				{"00002480_S_293x429_500_00_03_07.gray",
-				    "00002480_N_292x424_500_00_03_09.gray"},
-				{"00002560_S_256x418_500_00_03_08.gray",
-				    "00002560_N_331x447_500_00_03_02.gray"},
-				{"00002556_S_256x346_500_00_03_02.gray",
-				    "00002556_N_269x467_500_00_03_08.gray"},
-				{"00002546_S_256x385_500_00_03_09.gray",
-				    "00002546_N_294x441_500_00_03_02.gray"},
-				{"00002523_S_260x372_500_00_03_04.gray",
-				    "00002523_N_346x370_500_00_03_09.gray"},
-				{"00002569_S_256x427_500_00_03_02.gray",
-				    "00002569_N_281x455_500_00_03_03.gray"},
-				{"00002542_S_256x426_500_00_03_08.gray",
-				    "00002542_N_293x451_500_00_03_09.gray"},
-				{"00002541_S_256x496_500_00_03_08.gray",
-				    "00002541_N_259x447_500_00_03_07.gray"},
-				{"00002500_S_256x397_500_00_03_02.gray",
-				    "00002500_N_257x413_500_00_03_09.gray"},
-				{"00002505_S_321x486_500_00_03_03.gray",
-				    "00002505_N_288x440_500_00_03_09.gray"},
-				{"00002504_S_289x435_500_00_03_03.gray",
-				    "00002504_N_286x481_500_00_03_08.gray"},
-
-				/* Same image */
-				{"00001000_SD300_742x687_500_01_02_02.gray",
-				    "00001000_SD300_742x687_500_01_02_02.gray"},
-				{"00002448_M_256x360_500_00_09_09.gray",
-				    "00002448_M_256x360_500_00_09_09.gray"},
-				{"00002449_S_302x436_500_00_03_03.gray",
-				    "00002449_S_302x436_500_00_03_03.gray"},
-				{"00002472_S_256x394_500_00_03_09.gray",
-				    "00002472_S_256x394_500_00_03_09.gray"},
-				{"00002445_M_256x360_500_00_09_10.gray",
-				    "00002445_M_256x360_500_00_09_10.gray"},
-				{"00002466_N_290x427_500_00_03_02.gray",
-				    "00002466_N_290x427_500_00_03_02.gray"},
-				{"00002434_N_277x475_500_00_03_08.gray",
-				    "00002434_N_277x475_500_00_03_08.gray"},
-				{"00002495_N_357x419_500_00_03_02.gray",
-				    "00002495_N_357x419_500_00_03_02.gray"},
-				{"00002497_N_265x276_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002571_N_312x487_500_00_03_02.gray",
-				    "00002571_N_312x487_500_00_03_02.gray"},
-				{"00002558_S_286x509_500_00_03_03.gray",
-				    "00002558_S_286x509_500_00_03_03.gray"},
-				{"00002574_N_258x455_500_00_03_02.gray",
-				    "00002574_N_258x455_500_00_03_02.gray"},
-				{"00002555_S_256x414_500_00_03_02.gray",
-				    "00002555_S_256x414_500_00_03_02.gray"},
-				{"00002578_N_271x466_500_00_03_04.gray",
-				    "00002578_N_271x466_500_00_03_04.gray"},
-				{"00002579_N_311x490_500_00_03_09.gray",
-				    "00002579_N_311x490_500_00_03_09.gray"},
-				{"00002550_S_256x419_500_00_03_04.gray",
-				    "00002550_S_256x419_500_00_03_04.gray"},
-				{"00002551_S_256x450_500_00_03_08.gray",
-				    "00002551_S_256x450_500_00_03_08.gray"},
-				{"00002537_S_256x375_500_00_03_09.gray",
-				    "00002537_S_256x375_500_00_03_09.gray"},
-				{"00002534_S_256x412_500_00_03_08.gray",
-				    "00002534_S_256x412_500_00_03_08.gray"},
-				{"00002535_N_325x408_500_00_03_08.gray",
-				    "00002535_N_325x408_500_00_03_08.gray"},
-				{"00002515_N_256x427_500_00_03_08.gray",
-				    "00002515_N_256x427_500_00_03_08.gray"},
-				{"00002516_S_273x424_500_00_03_08.gray",
-				    "00002516_S_273x424_500_00_03_08.gray"},
-				{"00002531_S_261x420_500_00_03_09.gray",
-				    "00002531_S_261x420_500_00_03_09.gray"},
-				{"00002547_N_278x430_500_00_03_03.gray",
-				    "00002547_N_278x430_500_00_03_03.gray"},
-				{"00002533_S_256x444_500_00_03_04.gray",
-				    "00002533_S_256x444_500_00_03_04.gray"},
-				{"00002435_M_256x360_500_00_09_07.gray",
-				    "00002435_M_256x360_500_00_09_07.gray"},
-				{"00002478_S_256x461_500_00_03_03.gray",
-				    "00002478_S_256x461_500_00_03_03.gray"},
-				{"00002433_M_256x360_500_00_09_05.gray",
-				    "00002433_M_256x360_500_00_09_05.gray"},
-				{"00002457_N_276x448_500_00_03_04.gray",
-				    "00002457_N_276x448_500_00_03_04.gray"},
-				{"00002456_N_256x485_500_00_03_09.gray",
-				    "00002456_N_256x485_500_00_03_09.gray"},
-				{"00002458_A_512x512_500_41_05_09.gray",
-				    "00002458_A_512x512_500_41_05_09.gray"},
-				{"00002439_A_512x512_500_41_05_04.gray",
-				    "00002439_A_512x512_500_41_05_04.gray"},
-				{"00002475_N_312x388_500_00_03_07.gray",
-				    "00002475_N_312x388_500_00_03_07.gray"},
-				{"00002483_S_256x361_500_00_03_02.gray",
-				    "00002483_S_256x361_500_00_03_02.gray"},
-				{"00002480_N_334x463_500_00_03_02.gray",
-				    "00002480_N_334x463_500_00_03_02.gray"},
-				{"00002561_S_256x382_500_00_03_03.gray",
-				    "00002561_S_256x382_500_00_03_03.gray"},
-				{"00002560_S_256x418_500_00_03_08.gray",
-				    "00002560_S_256x418_500_00_03_08.gray"},
-				{"00002484_S_256x337_500_00_03_09.gray",
-				    "00002484_S_256x337_500_00_03_09.gray"},
-				{"00002556_S_256x346_500_00_03_02.gray",
-				    "00002556_S_256x346_500_00_03_02.gray"},
-				{"00002521_N_361x490_500_00_03_07.gray",
-				    "00002521_N_361x490_500_00_03_07.gray"},
-				{"00002546_N_256x423_500_00_03_07.gray",
-				    "00002546_N_256x423_500_00_03_07.gray"},
-				{"00002523_S_256x328_500_00_03_07.gray",
-				    "00002523_S_256x328_500_00_03_07.gray"},
-				{"00002569_N_305x420_500_00_03_02.gray",
-				    "00002569_N_305x420_500_00_03_02.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002542_N_282x477_500_00_03_02.gray"},
-				{"00002541_N_302x485_500_00_03_02.gray",
-				    "00002541_N_302x485_500_00_03_02.gray"},
-				{"00002502_S_256x402_500_00_03_08.gray",
-				    "00002502_S_256x402_500_00_03_08.gray"},
-				{"00002500_S_256x415_500_00_03_08.gray",
-				    "00002500_S_256x415_500_00_03_08.gray"},
-				{"00002505_S_307x442_500_00_03_02.gray",
-				    "00002505_S_307x442_500_00_03_02.gray"},
-				{"00002504_S_289x435_500_00_03_03.gray",
-				    "00002504_S_289x435_500_00_03_03.gray"},
-				{"00002488_S_296x461_500_00_03_04.gray",
-				    "00002488_S_296x461_500_00_03_04.gray"},
-
-				/* Nonmated */
-				{"00001000_SD300_742x687_500_01_02_02.gray",
-				    "00002547_N_299x452_500_00_03_08.gray"},
-				{"00002547_N_299x452_500_00_03_08.gray",
-				    "00002579_S_279x461_500_00_03_08.gray"},
-				{"00002561_N_301x413_500_00_03_07.gray",
-				    "00002571_S_290x482_500_00_03_07.gray"},
-				{"00002495_S_268x437_500_00_03_07.gray",
-				    "00002547_N_256x474_500_00_03_07.gray"},
-				{"00002535_S_290x444_500_00_03_09.gray",
-				    "00002550_S_256x401_500_00_03_09.gray"},
-				{"00002541_S_277x472_500_00_03_02.gray",
-				    "00002533_N_319x439_500_00_03_02.gray"},
-				{"00002579_S_279x461_500_00_03_08.gray",
-				    "00002502_N_280x427_500_00_03_08.gray"},
-				{"00002534_S_256x412_500_00_03_08.gray",
-				    "00002466_N_288x468_500_00_03_08.gray"},
-				{"00002546_N_256x450_500_00_03_08.gray",
-				    "00002521_S_310x552_500_00_03_08.gray"},
-				{"00002497_S_301x494_500_00_03_09.gray",
-				    "00002561_N_303x427_500_00_03_09.gray"},
-				{"00002497_S_284x386_500_00_03_03.gray",
-				    "00002483_S_256x374_500_00_03_03.gray"},
-				{"00002546_S_256x469_500_00_03_08.gray",
-				    "00002551_S_256x450_500_00_03_08.gray"},
-				{"00002537_S_256x310_500_00_03_07.gray",
-				    "00002435_A_512x512_500_41_05_07.gray"},
-				{"00002435_U_1600x1500_1000_01_03_10.gray",
-				    "00002458_M_256x360_500_00_09_10.gray"},
-				{"00002472_N_310x420_500_00_03_08.gray",
-				    "00002546_S_256x469_500_00_03_08.gray"},
-				{"00002571_N_329x527_500_00_03_07.gray",
-				    "00002456_S_256x389_500_00_03_07.gray"},
-				{"00002531_S_256x420_500_00_03_04.gray",
-				    "00002523_S_260x372_500_00_03_04.gray"},
-				{"00002439_M_256x360_500_00_09_05.gray",
-				    "00002435_U_1600x1500_1000_01_03_05.gray"},
-				{"00002495_N_321x394_500_00_03_04.gray",
-				    "00002478_S_256x405_500_00_03_04.gray"},
-				{"00002555_S_256x422_500_00_03_07.gray",
-				    "00002458_U_1600x1500_1000_01_03_07.gray"},
-				{"00002533_S_256x444_500_00_03_04.gray",
-				    "00002456_U_1600x1500_1000_01_03_04.gray"},
-				{"00002534_N_256x434_500_00_03_09.gray",
-				    "00002500_N_257x413_500_00_03_09.gray"},
-				{"00002521_N_386x515_500_00_03_03.gray",
-				    "00002449_M_256x360_500_00_09_03.gray"},
-				{"00002556_S_256x432_500_00_03_04.gray",
-				    "00002480_N_311x449_500_00_03_04.gray"},
-				{"00002556_N_303x490_500_00_03_04.gray",
-				    "00002537_S_256x379_500_00_03_04.gray"},
-				{"00002434_M_256x360_500_00_09_02.gray",
-				    "00002497_S_293x414_500_00_03_02.gray"},
-				{"00002579_S_292x465_500_00_03_07.gray",
-				    "00002560_S_256x401_500_00_03_07.gray"},
-				{"00002515_S_256x425_500_00_03_09.gray",
-				    "00002535_S_290x444_500_00_03_09.gray"},
-				{"00002550_N_294x522_500_00_03_02.gray",
-				    "00002537_S_256x345_500_00_03_02.gray"},
-				{"00002448_N_256x397_500_00_03_03.gray",
-				    "00002533_S_256x391_500_00_03_03.gray"},
-				{"00002534_S_256x412_500_00_03_08.gray",
-				    "00002478_S_256x435_500_00_03_08.gray"},
-				{"00002502_S_256x377_500_00_03_02.gray",
-				    "00002547_N_256x452_500_00_03_02.gray"},
-				{"00002533_N_319x439_500_00_03_02.gray",
-				    "00002484_S_257x339_500_00_03_02.gray"},
-				{"00002472_S_256x364_500_00_03_04.gray",
-				    "00002546_N_309x489_500_00_03_04.gray"},
-				{"00002505_S_307x442_500_00_03_02.gray",
-				    "00002561_N_319x391_500_00_03_02.gray"},
-				{"00002502_N_256x327_500_00_03_02.gray",
-				    "00002495_N_357x419_500_00_03_02.gray"},
-				{"00002516_S_256x420_500_00_03_04.gray",
-				    "00002560_S_268x396_500_00_03_04.gray"},
-				{"00002515_N_256x412_500_00_03_07.gray",
-				    "00002439_A_512x512_500_41_05_07.gray"},
-				{"00002523_S_256x328_500_00_03_07.gray",
-				    "00002475_N_312x388_500_00_03_07.gray"},
-				{"00002495_S_286x455_500_00_03_09.gray",
-				    "00002500_S_256x378_500_00_03_09.gray"},
-				{"00002484_S_273x386_500_00_03_04.gray",
-				    "00002516_S_256x420_500_00_03_04.gray"},
-				{"00002558_N_298x489_500_00_03_03.gray",
-				    "00002556_N_272x474_500_00_03_03.gray"},
-				{"00002448_N_297x402_500_00_03_07.gray",
-				    "00002483_S_256x397_500_00_03_07.gray"},
-				{"00002561_S_263x377_500_00_03_02.gray",
-				    "00002472_N_311x384_500_00_03_02.gray"},
-				{"00002534_S_256x388_500_00_03_04.gray",
-				    "00002578_S_256x458_500_00_03_04.gray"},
-				{"00002550_N_259x505_500_00_03_09.gray",
-				    "00002515_S_256x425_500_00_03_09.gray"},
-				{"00002433_S_303x480_500_00_03_02.gray",
-				    "00002445_S_269x440_500_00_03_02.gray"},
-				{"00002560_N_331x447_500_00_03_02.gray",
-				    "00002541_N_302x485_500_00_03_02.gray"},
-				{"00002579_N_296x438_500_00_03_07.gray",
-				    "00002434_U_1600x1500_1000_01_03_07.gray"},
-				{"00002483_N_272x445_500_00_03_02.gray",
-				    "00002556_N_266x437_500_00_03_02.gray"},
-				{"00002434_U_1600x1500_1000_01_03_07.gray",
-				    "00002495_S_268x437_500_00_03_07.gray"},
-				{"00002502_S_256x402_500_00_03_08.gray",
-				    "00002542_S_256x426_500_00_03_08.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002497_S_293x414_500_00_03_02.gray"},
-				{"00002466_N_288x468_500_00_03_08.gray",
-				    "00002561_S_257x411_500_00_03_08.gray"},
-				{"00002569_S_267x411_500_00_03_07.gray",
-				    "00002504_N_320x470_500_00_03_07.gray"},
-				{"00002558_N_348x559_500_00_03_04.gray",
-				    "00002488_S_296x461_500_00_03_04.gray"},
-				{"00002484_N_283x358_500_00_03_09.gray",
-				    "00002555_S_256x492_500_00_03_09.gray"},
-				{"00002533_S_256x424_500_00_03_07.gray",
-				    "00002560_N_311x453_500_00_03_07.gray"},
-				{"00002435_N_307x410_500_00_03_03.gray",
-				    "00002495_S_336x493_500_00_03_03.gray"},
-				{"00002571_S_256x504_500_00_03_08.gray",
-				    "00002542_S_256x426_500_00_03_08.gray"},
-				{"00002457_N_294x438_500_00_03_07.gray",
-				    "00002480_S_293x429_500_00_03_07.gray"},
-				{"00002484_S_257x339_500_00_03_02.gray",
-				    "00002534_N_256x390_500_00_03_02.gray"},
-				{"00002516_N_315x469_500_00_03_08.gray",
-				    "00002500_N_256x400_500_00_03_08.gray"},
-				{"00002558_N_272x450_500_00_03_08.gray",
-				    "00002521_S_310x552_500_00_03_08.gray"},
-				{"00002505_S_329x485_500_00_03_08.gray",
-				    "00002560_N_263x432_500_00_03_08.gray"},
-				{"00002569_N_258x467_500_00_03_08.gray",
-				    "00002480_S_280x449_500_00_03_08.gray"},
-				{"00002551_N_268x449_500_00_03_03.gray",
-				    "00002574_N_299x480_500_00_03_03.gray"},
-				{"00002542_S_256x441_500_00_03_04.gray",
-				    "00002495_S_290x513_500_00_03_04.gray"},
-				{"00002558_S_313x420_500_00_03_07.gray",
-				    "00002561_S_260x379_500_00_03_07.gray"},
-				{"00002515_S_256x425_500_00_03_09.gray",
-				    "00002542_S_256x448_500_00_03_09.gray"},
-				{"00002561_N_316x402_500_00_03_03.gray",
-				    "00002556_S_256x373_500_00_03_03.gray"},
-				{"00002480_N_292x424_500_00_03_09.gray",
-				    "00002497_S_301x494_500_00_03_09.gray"},
-				{"00002541_S_257x502_500_00_03_03.gray",
-				    "00002497_S_284x386_500_00_03_03.gray"},
-				{"00002435_S_256x357_500_00_03_04.gray",
-				    "00002551_N_256x420_500_00_03_04.gray"},
-				{"00002561_S_260x379_500_00_03_07.gray",
-				    "00002555_N_256x356_500_00_03_07.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002561_N_319x391_500_00_03_02.gray"},
-				{"00002537_S_256x310_500_00_03_07.gray",
-				    "00002466_N_295x403_500_00_03_07.gray"},
-				{"00002439_N_299x440_500_00_03_07.gray",
-				    "00002456_U_1600x1500_1000_01_03_07.gray"},
-				{"00002500_N_287x420_500_00_03_04.gray",
-				    "00002555_N_302x512_500_00_03_04.gray"},
-				{"00002448_N_297x402_500_00_03_07.gray",
-				    "00002537_N_279x392_500_00_03_07.gray"},
-				{"00002551_S_256x425_500_00_03_09.gray",
-				    "00002448_M_256x360_500_00_09_09.gray"},
-				{"00002504_S_264x482_500_00_03_09.gray",
-				    "00002449_N_325x482_500_00_03_09.gray"},
-				{"00002497_S_301x494_500_00_03_09.gray",
-				    "00002534_N_256x434_500_00_03_09.gray"},
-				{"00002439_A_512x512_500_41_05_07.gray",
-				    "00002434_A_512x512_500_41_05_07.gray"},
-				{"00002546_N_256x450_500_00_03_08.gray",
-				    "00002555_N_256x461_500_00_03_08.gray"},
-				{"00002502_S_256x377_500_00_03_02.gray",
-				    "00002531_N_256x393_500_00_03_02.gray"},
-				{"00002558_S_256x436_500_00_03_09.gray",
-				    "00002495_N_313x457_500_00_03_09.gray"},
-				{"00002439_A_512x512_500_41_05_04.gray",
-				    "00002466_S_256x463_500_00_03_04.gray"},
-				{"00002484_S_257x339_500_00_03_02.gray",
-				    "00002558_N_324x452_500_00_03_02.gray"},
-				{"00002558_S_265x434_500_00_03_08.gray",
-				    "00002505_S_329x485_500_00_03_08.gray"},
-				{"00002504_S_268x441_500_00_03_02.gray",
-				    "00002516_N_266x469_500_00_03_02.gray"},
-				{"00002546_S_283x471_500_00_03_03.gray",
-				    "00002488_S_296x482_500_00_03_03.gray"},
-				{"00002484_N_284x350_500_00_03_03.gray",
-				    "00002569_S_290x485_500_00_03_03.gray"},
-				{"00002551_S_256x383_500_00_03_02.gray",
-				    "00002579_N_315x419_500_00_03_02.gray"},
-				{"00002523_N_262x372_500_00_03_03.gray",
-				    "00002484_S_267x375_500_00_03_03.gray"},
-				{"00002547_S_256x478_500_00_03_09.gray",
-				    "00002445_U_1600x1500_1000_01_03_09.gray"},
-				{"00002541_N_258x492_500_00_03_09.gray",
-				    "00002571_N_317x501_500_00_03_09.gray"},
-				{"00002555_N_256x461_500_00_03_08.gray",
-				    "00002535_S_286x455_500_00_03_08.gray"},
-				{"00002561_N_319x391_500_00_03_02.gray",
-				    "00002555_N_256x427_500_00_03_02.gray"},
-				{"00002535_S_277x464_500_00_03_07.gray",
-				    "00002569_S_267x411_500_00_03_07.gray"},
-				{"00002449_U_1600x1500_1000_01_03_08.gray",
-				    "00002433_M_256x360_500_00_09_08.gray"},
-				{"00002541_S_277x472_500_00_03_02.gray",
-				    "00002550_S_256x484_500_00_03_02.gray"},
-				{"00002547_N_274x485_500_00_03_09.gray",
-				    "00002534_S_256x418_500_00_03_09.gray"},
-				{"00002484_N_284x350_500_00_03_03.gray",
-				    "00002448_A_512x512_500_41_05_03.gray"},
-				{"00002569_S_258x412_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002541_N_302x485_500_00_03_02.gray",
-				    "00002556_S_256x346_500_00_03_02.gray"},
-				{"00002472_N_319x403_500_00_03_04.gray",
-				    "00002547_N_256x431_500_00_03_04.gray"},
-				{"00002495_S_286x455_500_00_03_09.gray",
-				    "00002484_N_283x358_500_00_03_09.gray"},
-				{"00002439_A_512x512_500_41_05_07.gray",
-				    "00002475_S_263x392_500_00_03_07.gray"},
-				{"00002515_N_256x415_500_00_03_02.gray",
-				    "00002578_N_267x446_500_00_03_02.gray"},
-				{"00002480_S_268x468_500_00_03_04.gray",
-				    "00002504_N_282x461_500_00_03_04.gray"},
-				{"00002472_N_310x420_500_00_03_08.gray",
-				    "00002449_N_312x436_500_00_03_08.gray"},
-				{"00002550_N_275x533_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002458_N_292x445_500_00_03_02.gray",
-				    "00002521_N_344x490_500_00_03_02.gray"},
-				{"00002433_A_512x512_500_41_05_09.gray",
-				    "00002478_N_277x463_500_00_03_09.gray"},
-				{"00002435_U_1600x1500_1000_01_03_01.gray",
-				    "00002449_A_512x512_500_41_05_01.gray"},
-				{"00002457_N_276x448_500_00_03_04.gray",
-				    "00002534_S_256x388_500_00_03_04.gray"},
-				{"00002504_S_264x482_500_00_03_09.gray",
-				    "00002551_S_256x425_500_00_03_09.gray"},
-				{"00002531_N_256x363_500_00_03_07.gray",
-				    "00002439_M_256x360_500_00_09_07.gray"},
-				{"00002533_N_272x528_500_00_03_07.gray",
-				    "00002542_N_282x461_500_00_03_07.gray"},
-				{"00002445_A_512x512_500_41_05_01.gray",
-				    "00002449_M_256x360_500_00_09_01.gray"},
-				{"00002516_N_287x433_500_00_03_07.gray",
-				    "00002571_N_329x527_500_00_03_07.gray"},
-				{"00002448_S_256x384_500_00_03_07.gray",
-				    "00002579_S_292x465_500_00_03_07.gray"},
-				{"00002579_N_311x490_500_00_03_09.gray",
-				    "00002547_N_274x485_500_00_03_09.gray"},
-				{"00002533_N_296x433_500_00_03_03.gray",
-				    "00002561_N_316x402_500_00_03_03.gray"},
-				{"00002478_S_256x461_500_00_03_03.gray",
-				    "00002551_N_268x449_500_00_03_03.gray"},
-				{"00002502_N_256x391_500_00_03_09.gray",
-				    "00002434_S_257x411_500_00_03_09.gray"},
-				{"00002445_S_272x442_500_00_03_07.gray",
-				    "00002472_S_256x381_500_00_03_07.gray"},
-				{"00002535_N_325x408_500_00_03_08.gray",
-				    "00002495_S_291x455_500_00_03_08.gray"},
-				{"00002488_N_334x487_500_00_03_08.gray",
-				    "00002502_S_256x402_500_00_03_08.gray"},
-				{"00002533_N_296x433_500_00_03_03.gray",
-				    "00002472_S_256x344_500_00_03_03.gray"},
-				{"00002502_S_256x376_500_00_03_03.gray",
-				    "00002537_S_256x375_500_00_03_03.gray"},
-				{"00002445_U_1600x1500_1000_01_03_04.gray",
-				    "00002560_S_268x396_500_00_03_04.gray"},
-				{"00002457_S_256x377_500_00_03_04.gray",
-				    "00002434_S_268x426_500_00_03_04.gray"},
-				{"00002541_N_283x453_500_00_03_08.gray",
-				    "00002561_S_257x411_500_00_03_08.gray"},
-				{"00002475_N_277x412_500_00_03_03.gray",
-				    "00002434_U_1600x1500_1000_01_03_03.gray"},
-				{"00002504_S_265x415_500_00_03_04.gray",
-				    "00002541_S_256x491_500_00_03_04.gray"},
-				{"00002537_S_256x379_500_00_03_04.gray",
-				    "00002550_N_275x533_500_00_03_04.gray"},
-				{"00002445_M_256x360_500_00_09_07.gray",
-				    "00002541_N_259x447_500_00_03_07.gray"},
-				{"00002500_N_256x373_500_00_03_07.gray",
-				    "00002550_N_269x519_500_00_03_07.gray"},
-				{"00002478_S_256x404_500_00_03_09.gray",
-				    "00002435_S_256x415_500_00_03_09.gray"},
-				{"00002483_S_256x375_500_00_03_08.gray",
-				    "00002560_S_256x418_500_00_03_08.gray"},
-				{"00002541_N_258x492_500_00_03_09.gray",
-				    "00002458_A_512x512_500_41_05_09.gray"},
-				{"00002466_N_325x460_500_00_03_04.gray",
-				    "00002569_N_294x438_500_00_03_04.gray"},
-				{"00002556_S_256x380_500_00_03_08.gray",
-				    "00002472_N_310x420_500_00_03_08.gray"},
-				{"00002560_S_258x408_500_00_03_03.gray",
-				    "00002556_N_272x474_500_00_03_03.gray"},
-				{"00002500_N_256x408_500_00_03_03.gray",
-				    "00002578_S_256x446_500_00_03_03.gray"},
-				{"00002483_S_256x410_500_00_03_04.gray",
-				    "00002472_N_319x403_500_00_03_04.gray"},
-				{"00002466_S_258x445_500_00_03_08.gray",
-				    "00002478_S_256x435_500_00_03_08.gray"},
-				{"00002531_N_271x360_500_00_03_08.gray",
-				    "00002537_N_300x457_500_00_03_08.gray"},
-				{"00002456_M_256x360_500_00_09_09.gray",
-				    "00002574_S_256x470_500_00_03_09.gray"},
-				{"00002561_S_256x382_500_00_03_03.gray",
-				    "00002472_N_311x409_500_00_03_03.gray"},
-				{"00002571_N_329x527_500_00_03_07.gray",
-				    "00002480_N_318x452_500_00_03_07.gray"},
-				{"00002480_N_318x452_500_00_03_07.gray",
-				    "00002500_N_256x373_500_00_03_07.gray"},
-				{"00002466_N_290x427_500_00_03_02.gray",
-				    "00002578_S_256x421_500_00_03_02.gray"},
-				{"00002534_S_256x380_500_00_03_02.gray",
-				    "00002541_N_302x485_500_00_03_02.gray"},
-				{"00002456_M_256x360_500_00_09_02.gray",
-				    "00002445_U_1600x1500_1000_01_03_02.gray"},
-				{"00002516_S_256x431_500_00_03_09.gray",
-				    "00002478_S_256x404_500_00_03_09.gray"},
-				{"00002533_N_296x433_500_00_03_03.gray",
-				    "00002439_S_287x438_500_00_03_03.gray"},
-				{"00002534_S_256x418_500_00_03_09.gray",
-				    "00002435_U_1600x1500_1000_01_03_09.gray"},
-				{"00002488_S_278x455_500_00_03_08.gray",
-				    "00002515_S_256x436_500_00_03_08.gray"},
-				{"00002488_S_296x461_500_00_03_04.gray",
-				    "00002537_N_322x413_500_00_03_04.gray"},
-				{"00002502_S_256x377_500_00_03_02.gray",
-				    "00002534_N_256x390_500_00_03_02.gray"},
-				{"00002574_N_258x455_500_00_03_02.gray",
-				    "00002555_S_256x414_500_00_03_02.gray"},
-				{"00002551_N_256x425_500_00_03_09.gray",
-				    "00002504_S_264x482_500_00_03_09.gray"},
-				{"00002546_N_294x441_500_00_03_02.gray",
-				    "00002533_N_319x439_500_00_03_02.gray"},
-				{"00002558_S_267x490_500_00_03_04.gray",
-				    "00002458_U_1600x1500_1000_01_03_04.gray"},
-				{"00002558_S_313x499_500_00_03_02.gray",
-				    "00002449_N_302x405_500_00_03_02.gray"},
-				{"00002457_M_256x360_500_00_09_09.gray",
-				    "00002495_N_313x457_500_00_03_09.gray"},
-				{"00002505_N_331x443_500_00_03_02.gray",
-				    "00002458_U_1600x1500_1000_01_03_02.gray"},
-				{"00002484_N_283x358_500_00_03_09.gray",
-				    "00002483_N_256x441_500_00_03_09.gray"},
-				{"00002488_N_334x487_500_00_03_08.gray",
-				    "00002433_U_1600x1500_1000_01_03_08.gray"},
-				{"00002571_S_256x458_500_00_03_04.gray",
-				    "00002541_S_256x491_500_00_03_04.gray"},
-				{"00002439_A_512x512_500_41_05_08.gray",
-				    "00002433_N_282x452_500_00_03_08.gray"},
-				{"00002541_S_256x491_500_00_03_04.gray",
-				    "00002504_S_265x415_500_00_03_04.gray"},
-				{"00002531_S_256x390_500_00_03_02.gray",
-				    "00002505_N_331x443_500_00_03_02.gray"},
-				{"00002534_N_256x434_500_00_03_09.gray",
-				    "00002541_S_256x470_500_00_03_09.gray"},
-				{"00002574_S_256x444_500_00_03_08.gray",
-				    "00002571_S_256x504_500_00_03_08.gray"},
-				{"00002547_N_256x452_500_00_03_02.gray",
-				    "00002502_S_256x377_500_00_03_02.gray"},
-				{"00002488_N_316x459_500_00_03_07.gray",
-				    "00002533_N_272x528_500_00_03_07.gray"},
-				{"00002449_M_256x360_500_00_09_07.gray",
-				    "00002502_S_256x379_500_00_03_07.gray"},
-				{"00002457_U_1600x1500_1000_01_03_07.gray",
-				    "00002500_S_256x394_500_00_03_07.gray"},
-				{"00002547_N_256x452_500_00_03_02.gray",
-				    "00002433_M_256x360_500_00_09_02.gray"},
-				{"00002458_N_292x445_500_00_03_02.gray",
-				    "00002433_S_303x480_500_00_03_02.gray"},
-				{"00002537_N_294x439_500_00_03_09.gray",
-				    "00002456_N_256x485_500_00_03_09.gray"},
-				{"00002534_S_256x418_500_00_03_09.gray",
-				    "00002502_S_256x369_500_00_03_09.gray"},
-				{"00002550_S_261x479_500_00_03_03.gray",
-				    "00002555_N_303x433_500_00_03_03.gray"},
-				{"00002521_N_382x516_500_00_03_04.gray",
-				    "00002500_N_287x420_500_00_03_04.gray"},
-				{"00002546_N_309x489_500_00_03_04.gray",
-				    "00002523_N_332x387_500_00_03_04.gray"},
-				{"00002497_S_302x428_500_00_03_04.gray",
-				    "00002435_A_512x512_500_41_05_04.gray"},
-				{"00002561_N_319x391_500_00_03_02.gray",
-				    "00002435_N_296x404_500_00_03_02.gray"},
-				{"00002558_S_313x499_500_00_03_02.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"00002504_N_282x461_500_00_03_04.gray",
-				    "00002531_S_256x420_500_00_03_04.gray"},
-				{"00002516_S_256x420_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002466_N_316x475_500_00_03_03.gray",
-				    "00002516_N_308x471_500_00_03_03.gray"},
-				{"00002541_N_259x447_500_00_03_07.gray",
-				    "00002483_N_256x412_500_00_03_07.gray"},
-				{"00002531_N_269x430_500_00_03_04.gray",
-				    "00002556_N_303x490_500_00_03_04.gray"},
-				{"00002456_S_256x394_500_00_03_02.gray",
-				    "00002579_S_99x99_500_00_03_02.gray"},
-				{"00002551_N_281x405_500_00_03_02.gray",
-				    "00002574_N_258x455_500_00_03_02.gray"},
-				{"00002550_N_275x533_500_00_03_04.gray",
-				    "00002445_M_256x360_500_00_09_04.gray"},
-				{"00002561_N_316x402_500_00_03_03.gray",
-				    "00002555_S_256x413_500_00_03_03.gray"},
-				{"00002516_N_287x433_500_00_03_07.gray",
-				    "00002497_S_293x420_500_00_03_07.gray"},
-				{"00002434_M_256x360_500_00_09_01.gray",
-				    "00002449_U_1600x1500_1000_01_03_01.gray"},
-				{"00002569_N_258x467_500_00_03_08.gray",
-				    "00002483_S_256x375_500_00_03_08.gray"},
-				{"00002458_A_512x512_500_41_05_04.gray",
-				    "00002483_S_256x410_500_00_03_04.gray"},
-				{"00002472_N_310x420_500_00_03_08.gray",
-				    "00002505_S_329x485_500_00_03_08.gray"},
-				{"00002579_N_336x452_500_00_03_03.gray",
-				    "00002433_U_1600x1500_1000_01_03_03.gray"},
-				{"00002439_S_261x411_500_00_03_02.gray",
-				    "00002535_S_286x417_500_00_03_02.gray"},
-				{"00002558_N_303x492_500_00_03_09.gray",
-				    "00002439_N_299x422_500_00_03_09.gray"},
-				{"00002458_S_256x437_500_00_03_09.gray",
-				    "00002556_S_256x388_500_00_03_09.gray"},
-				{"00002434_A_512x512_500_41_05_04.gray",
-				    "00002574_S_256x468_500_00_03_04.gray"},
-				{"00002579_N_296x438_500_00_03_07.gray",
-				    "00002547_S_256x428_500_00_03_07.gray"},
-				{"00002547_S_256x433_500_00_03_04.gray",
-				    "00002550_S_256x419_500_00_03_04.gray"},
-				{"00002480_S_280x449_500_00_03_08.gray",
-				    "00002541_N_283x453_500_00_03_08.gray"},
-				{"00002560_N_311x453_500_00_03_07.gray",
-				    "00002547_S_256x428_500_00_03_07.gray"},
-				{"00002541_N_259x447_500_00_03_07.gray",
-				    "00002449_U_1600x1500_1000_01_03_07.gray"},
-				{"00002497_S_278x409_500_00_03_08.gray",
-				    "00002457_U_1600x1500_1000_01_03_08.gray"},
-				{"00002533_S_256x391_500_00_03_03.gray",
-				    "00002537_N_318x422_500_00_03_03.gray"},
-				{"00002456_N_268x478_500_00_03_03.gray",
-				    "00002534_N_256x378_500_00_03_03.gray"},
-				{"00002521_N_345x544_500_00_03_09.gray",
-				    "00002550_N_259x505_500_00_03_09.gray"},
-				{"00002495_S_336x493_500_00_03_03.gray",
-				    "00002533_S_256x391_500_00_03_03.gray"},
-				{"00002472_N_319x403_500_00_03_04.gray",
-				    "00002516_S_256x420_500_00_03_04.gray"},
-				{"00002531_N_271x360_500_00_03_08.gray",
-				    "00002560_N_263x432_500_00_03_08.gray"},
-				{"00002537_N_318x422_500_00_03_03.gray",
-				    "00002456_U_1600x1500_1000_01_03_03.gray"},
-				{"00002551_S_256x425_500_00_03_09.gray",
-				    "00002472_N_335x454_500_00_03_09.gray"},
-				{"00002516_S_267x435_500_00_03_02.gray",
-				    "00002439_S_261x411_500_00_03_02.gray"},
-				{"00002515_N_256x427_500_00_03_08.gray",
-				    "00002555_N_256x461_500_00_03_08.gray"},
-				{"00002483_N_256x441_500_00_03_09.gray",
-				    "00002475_N_296x433_500_00_03_09.gray"},
-				{"00002488_N_370x505_500_00_03_03.gray",
-				    "00002478_N_324x471_500_00_03_03.gray"},
-				{"00002578_N_267x446_500_00_03_02.gray",
-				    "00002551_S_256x383_500_00_03_02.gray"},
-				{"00002445_S_272x442_500_00_03_07.gray",
-				    "00002456_M_256x360_500_00_09_07.gray"},
-				{"00002541_N_304x508_500_00_03_04.gray",
-				    "00002569_S_258x412_500_00_03_04.gray"},
-				{"00002555_N_256x356_500_00_03_07.gray",
-				    "00002433_A_512x512_500_41_05_07.gray"},
-				{"00002569_S_256x427_500_00_03_02.gray",
-				    "00002478_S_256x438_500_00_03_02.gray"},
-				{"00002574_S_256x444_500_00_03_02.gray",
-				    "00002448_S_256x396_500_00_03_02.gray"},
-				{"00002466_S_258x445_500_00_03_08.gray",
-				    "00002472_S_256x382_500_00_03_08.gray"},
-				{"00002561_S_256x363_500_00_03_04.gray",
-				    "00002574_N_286x468_500_00_03_04.gray"},
-				{"00002483_S_256x361_500_00_03_02.gray",
-				    "00002435_M_256x360_500_00_09_02.gray"},
-				{"00002546_N_256x450_500_00_03_08.gray",
-				    "00002533_S_256x329_500_00_03_08.gray"},
-				{"00002456_A_512x512_500_41_05_05.gray",
-				    "00002435_M_256x360_500_00_09_05.gray"},
-				{"00002480_N_292x424_500_00_03_09.gray",
-				    "00002449_U_1600x1500_1000_01_03_09.gray"},
-				{"00002541_S_256x470_500_00_03_09.gray",
-				    "00002547_N_274x485_500_00_03_09.gray"},
-				{"00002480_N_317x453_500_00_03_03.gray",
-				    "00002550_S_261x479_500_00_03_03.gray"},
-				{"00002574_N_286x468_500_00_03_04.gray",
-				    "00002578_S_256x458_500_00_03_04.gray"},
-				{"00002457_M_256x360_500_00_09_03.gray",
-				    "00002551_N_268x449_500_00_03_03.gray"},
-				{"00002515_N_256x412_500_00_03_07.gray",
-				    "00002448_A_512x512_500_41_05_07.gray"},
-				{"00002569_S_290x443_500_00_03_08.gray",
-				    "00002495_S_291x455_500_00_03_08.gray"},
-				{"00002505_S_302x480_500_00_03_07.gray",
-				    "00002574_S_257x416_500_00_03_07.gray"},
-				{"00002574_S_256x468_500_00_03_04.gray",
-				    "00002448_S_256x374_500_00_03_04.gray"},
-				{"00002495_S_290x513_500_00_03_04.gray",
-				    "00002537_S_256x379_500_00_03_04.gray"},
-				{"00002523_S_275x358_500_00_03_02.gray",
-				    "00002488_S_324x483_500_00_03_02.gray"},
-				{"00002433_M_256x360_500_00_09_04.gray",
-				    "00002551_S_256x420_500_00_03_04.gray"},
-				{"00002516_N_266x469_500_00_03_02.gray",
-				    "00002531_S_256x390_500_00_03_02.gray"},
-				{"00002531_N_256x363_500_00_03_07.gray",
-				    "00002537_S_256x310_500_00_03_07.gray"},
-				{"00002504_N_282x461_500_00_03_04.gray",
-				    "00002523_S_260x372_500_00_03_04.gray"},
-				{"00002535_N_325x408_500_00_03_08.gray",
-				    "00002579_N_294x486_500_00_03_08.gray"},
-				{"00002569_N_281x455_500_00_03_03.gray",
-				    "00002505_N_366x482_500_00_03_03.gray"},
-				{"00002523_S_256x357_500_00_03_08.gray",
-				    "00002456_U_1600x1500_1000_01_03_08.gray"},
-				{"00002579_S_276x433_500_00_03_04.gray",
-				    "00002483_S_256x410_500_00_03_04.gray"},
-				{"00002484_S_257x339_500_00_03_02.gray",
-				    "00002561_S_263x377_500_00_03_02.gray"},
-				{"00002515_S_256x419_500_00_03_02.gray",
-				    "00002483_S_256x361_500_00_03_02.gray"},
-				{"00002574_S_257x416_500_00_03_07.gray",
-				    "00002497_N_256x347_500_00_03_07.gray"},
-				{"00002515_N_256x460_500_00_03_09.gray",
-				    "00002574_N_256x466_500_00_03_09.gray"},
-				{"00002457_U_1600x1500_1000_01_03_09.gray",
-				    "00002547_N_274x485_500_00_03_09.gray"},
-				{"00002497_N_256x347_500_00_03_07.gray",
-				    "00002571_S_290x482_500_00_03_07.gray"},
-				{"00002555_S_256x474_500_00_03_04.gray",
-				    "00002488_N_292x406_500_00_03_04.gray"},
-				{"00002534_S_256x418_500_00_03_09.gray",
-				    "00002497_S_301x494_500_00_03_09.gray"},
-				{"00002521_N_386x515_500_00_03_03.gray",
-				    "00002579_N_336x452_500_00_03_03.gray"},
-				{"00002433_S_291x487_500_00_03_04.gray",
-				    "00002483_S_256x410_500_00_03_04.gray"},
-				{"00002555_N_256x461_500_00_03_08.gray",
-				    "00002488_N_334x487_500_00_03_08.gray"},
-				{"00002556_S_256x373_500_00_03_03.gray",
-				    "00002458_N_303x449_500_00_03_03.gray"},
-				{"00002495_N_325x413_500_00_03_08.gray",
-				    "00002533_N_296x514_500_00_03_08.gray"},
-				{"00002542_S_256x425_500_00_03_07.gray",
-				    "00002521_S_309x503_500_00_03_07.gray"},
-				{"00002535_N_290x426_500_00_03_09.gray",
-				    "00002457_S_256x347_500_00_03_09.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002556_N_266x437_500_00_03_02.gray"},
-				{"00002555_N_256x438_500_00_03_09.gray",
-				    "00002561_S_256x384_500_00_03_09.gray"},
-				{"00002480_S_293x429_500_00_03_07.gray",
-				    "00002569_S_267x411_500_00_03_07.gray"},
-				{"00002516_S_256x420_500_00_03_04.gray",
-				    "00002556_N_303x490_500_00_03_04.gray"},
-				{"00002541_S_257x502_500_00_03_03.gray",
-				    "00002435_U_1600x1500_1000_01_03_03.gray"},
-				{"00002556_S_256x378_500_00_03_07.gray",
-				    "00002521_S_309x503_500_00_03_07.gray"},
-				{"00002560_S_256x418_500_00_03_08.gray",
-				    "00002456_S_256x434_500_00_03_08.gray"},
-				{"00002523_N_346x370_500_00_03_09.gray",
-				    "00002484_S_256x337_500_00_03_09.gray"},
-				{"00002537_N_300x457_500_00_03_08.gray",
-				    "00002500_S_256x415_500_00_03_08.gray"},
-				{"00002484_N_294x383_500_00_03_04.gray",
-				    "00002521_N_382x516_500_00_03_04.gray"},
-				{"00002449_S_302x436_500_00_03_03.gray",
-				    "00002558_N_298x489_500_00_03_03.gray"},
-				{"00002551_N_281x405_500_00_03_02.gray",
-				    "00002483_N_272x445_500_00_03_02.gray"},
-				{"00002458_A_512x512_500_41_05_03.gray",
-				    "00002556_S_256x373_500_00_03_03.gray"},
-				{"00002505_N_331x443_500_00_03_02.gray",
-				    "00002579_N_315x419_500_00_03_02.gray"},
-				{"00002480_N_318x452_500_00_03_07.gray",
-				    "00002515_S_256x419_500_00_03_07.gray"},
-				{"00002495_S_268x437_500_00_03_07.gray",
-				    "00002558_N_306x488_500_00_03_07.gray"},
-				{"00002458_S_292x447_500_00_03_04.gray",
-				    "00002433_U_1600x1500_1000_01_03_04.gray"},
-				{"00002502_N_298x446_500_00_03_07.gray",
-				    "00002480_S_293x429_500_00_03_07.gray"},
-				{"00002497_N_317x520_500_00_03_09.gray",
-				    "00002555_N_256x438_500_00_03_09.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "00002547_N_256x452_500_00_03_02.gray"},
-				{"00002533_N_313x475_500_00_03_04.gray",
-				    "00002435_A_512x512_500_41_05_04.gray"},
-				{"00002466_S_288x420_500_00_03_07.gray",
-				    "00002458_N_279x446_500_00_03_07.gray"},
-				{"00002531_N_256x368_500_00_03_03.gray",
-				    "00002478_S_256x461_500_00_03_03.gray"},
-				{"00002535_S_286x417_500_00_03_02.gray",
-				    "00002439_U_1600x1500_1000_01_03_02.gray"},
-				{"00002515_S_256x425_500_00_03_04.gray",
-				    "00002505_N_385x497_500_00_03_04.gray"},
-				{"00002495_N_336x463_500_00_03_07.gray",
-				    "00002458_U_1600x1500_1000_01_03_07.gray"},
-				{"00002504_S_289x435_500_00_03_03.gray",
-				    "00002558_S_286x509_500_00_03_03.gray"},
-				{"00002472_S_256x364_500_00_03_04.gray",
-				    "00002533_S_256x444_500_00_03_04.gray"},
-				{"00002523_N_256x308_500_00_03_02.gray",
-				    "00002500_S_256x397_500_00_03_02.gray"},
-				{"00002546_N_277x489_500_00_03_09.gray",
-				    "00002571_S_267x515_500_00_03_09.gray"},
-				{"00002515_S_256x419_500_00_03_02.gray",
-				    "00002533_S_256x401_500_00_03_02.gray"},
-				{"00002521_S_298x520_500_00_03_04.gray",
-				    "00002578_S_256x458_500_00_03_04.gray"},
-				{"00002533_N_307x541_500_00_03_09.gray",
-				    "00002475_S_256x431_500_00_03_09.gray"},
-				{"00002483_N_256x412_500_00_03_07.gray",
-				    "00002521_S_309x503_500_00_03_07.gray"},
-				{"00002547_S_258x460_500_00_03_08.gray",
-				    "00002561_S_257x411_500_00_03_08.gray"},
-				{"00002542_S_260x419_500_00_03_02.gray",
-				    "00002523_N_256x308_500_00_03_02.gray"},
-				{"00002472_N_311x384_500_00_03_02.gray",
-				    "00002534_N_256x390_500_00_03_02.gray"},
-				{"00002556_S_256x373_500_00_03_03.gray",
-				    "00002435_A_512x512_500_41_05_03.gray"},
-				{"00002571_N_317x501_500_00_03_09.gray",
-				    "00002516_N_265x453_500_00_03_09.gray"},
-				{"00002521_N_382x516_500_00_03_04.gray",
-				    "00002579_N_329x433_500_00_03_04.gray"},
-				{"00002560_N_263x432_500_00_03_08.gray",
-				    "00002484_S_256x352_500_00_03_08.gray"},
-				{"00002456_S_256x394_500_00_03_02.gray",
-				    "00002571_S_283x446_500_00_03_02.gray"},
-				{"00002475_S_264x421_500_00_03_04.gray",
-				    "00002537_S_256x379_500_00_03_04.gray"},
-				{"00002550_N_259x505_500_00_03_09.gray",
-				    "00002495_N_313x457_500_00_03_09.gray"},
-				{"00002574_S_256x468_500_00_03_04.gray",
-				    "00002435_M_256x360_500_00_09_04.gray"},
-				{"00002521_N_361x490_500_00_03_07.gray",
-				    "00002560_S_256x401_500_00_03_07.gray"},
-				{"00002578_S_256x446_500_00_03_03.gray",
-				    "00002448_M_256x360_500_00_09_03.gray"},
-				{"00002515_N_256x412_500_00_03_07.gray",
-				    "00002551_N_273x411_500_00_03_07.gray"},
-				{"00002550_S_256x419_500_00_03_04.gray",
-				    "00002555_N_302x512_500_00_03_04.gray"},
-				{"00002560_N_263x432_500_00_03_08.gray",
-				    "00002556_N_269x467_500_00_03_08.gray"},
-				{"00002516_N_270x443_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002433_A_512x512_500_41_05_08.gray",
-				    "00002456_N_285x442_500_00_03_08.gray"},
-				{"00002495_S_291x455_500_00_03_08.gray",
-				    "00002571_N_337x513_500_00_03_08.gray"},
-				{"00002535_S_286x455_500_00_03_08.gray",
-				    "00002502_N_280x427_500_00_03_08.gray"},
-				{"00002475_S_256x431_500_00_03_09.gray",
-				    "00002502_N_256x391_500_00_03_09.gray"},
-				{"00002488_S_334x470_500_00_03_07.gray",
-				    "00002533_N_272x528_500_00_03_07.gray"},
-				{"00002535_N_302x417_500_00_03_02.gray",
-				    "00002541_N_302x485_500_00_03_02.gray"},
-				{"00002578_N_293x434_500_00_03_03.gray",
-				    "00002449_N_316x399_500_00_03_03.gray"},
-				{"00002523_S_271x388_500_00_03_03.gray",
-				    "00002537_S_256x375_500_00_03_03.gray"},
-				{"00002516_S_256x431_500_00_03_09.gray",
-				    "00002546_N_277x489_500_00_03_09.gray"},
-				{"00002435_M_256x360_500_00_09_08.gray",
-				    "00002521_N_334x512_500_00_03_08.gray"},
-				{"00002483_S_256x375_500_00_03_08.gray",
-				    "00002556_S_256x380_500_00_03_08.gray"},
-				{"00002497_S_278x409_500_00_03_08.gray",
-				    "00002574_S_256x444_500_00_03_08.gray"},
-				{"00002448_N_256x397_500_00_03_03.gray",
-				    "00002502_S_256x376_500_00_03_03.gray"},
-				{"00002531_N_256x368_500_00_03_03.gray",
-				    "00002484_S_267x375_500_00_03_03.gray"},
-				{"00002497_N_265x276_500_00_03_04.gray",
-				    "00002457_M_256x360_500_00_09_04.gray"},
-				{"00002445_N_291x500_500_00_03_04.gray",
-				    "00002541_N_304x508_500_00_03_04.gray"},
-				{"00002445_N_256x441_500_00_03_09.gray",
-				    "00002531_S_261x420_500_00_03_09.gray"},
-				{"00002502_N_298x446_500_00_03_07.gray",
-				    "00002531_N_256x363_500_00_03_07.gray"},
-				{"00002475_N_296x433_500_00_03_09.gray",
-				    "00002435_U_1600x1500_1000_01_03_09.gray"},
-				{"00002542_N_282x479_500_00_03_04.gray",
-				    "00002555_N_302x512_500_00_03_04.gray"},
-				{"00002458_N_292x445_500_00_03_02.gray",
-				    "00002523_N_256x308_500_00_03_02.gray"},
-				{"00002480_S_280x449_500_00_03_08.gray",
-				    "00002504_S_309x431_500_00_03_08.gray"},
-				{"00002516_S_256x420_500_00_03_04.gray",
-				    "00002472_N_319x403_500_00_03_04.gray"},
-				{"00002515_S_256x425_500_00_03_09.gray",
-				    "00002569_N_269x468_500_00_03_09.gray"},
-				{"00002542_S_256x429_500_00_03_03.gray",
-				    "00002547_N_278x430_500_00_03_03.gray"},
-				{"00002571_N_302x477_500_00_03_04.gray",
-				    "00002579_N_329x433_500_00_03_04.gray"},
-				{"00002504_N_320x470_500_00_03_07.gray",
-				    "00002523_S_256x328_500_00_03_07.gray"},
-				{"00002497_N_265x276_500_00_03_04.gray",
-				    "00002558_S_267x490_500_00_03_04.gray"},
-				{"00002466_S_256x463_500_00_03_04.gray",
-				    "00002433_M_256x360_500_00_09_04.gray"},
-				{"00002484_S_256x337_500_00_03_09.gray",
-				    "00002523_N_346x370_500_00_03_09.gray"},
-				{"00002569_S_290x443_500_00_03_08.gray",
-				    "00002579_N_294x486_500_00_03_08.gray"},
-				{"00002542_N_293x451_500_00_03_09.gray",
-				    "00002541_N_258x492_500_00_03_09.gray"},
-				{"00002435_A_512x512_500_41_05_05.gray",
-				    "00002434_U_1600x1500_1000_01_03_05.gray"},
-				{"00002535_N_302x468_500_00_03_04.gray",
-				    "00002534_S_256x388_500_00_03_04.gray"},
-				{"00002516_S_256x431_500_00_03_09.gray",
-				    "00002541_S_256x470_500_00_03_09.gray"},
-				{"00002448_A_512x512_500_41_05_04.gray",
-				    "00002445_M_256x360_500_00_09_04.gray"},
-				{"00002434_N_320x437_500_00_03_02.gray",
-				    "00002537_N_315x399_500_00_03_02.gray"},
-				{"00002542_S_260x419_500_00_03_02.gray",
-				    "00002472_N_311x384_500_00_03_02.gray"},
-				{"00002546_S_273x471_500_00_03_04.gray",
-				    "00002504_S_265x415_500_00_03_04.gray"},
-				{"00002523_S_267x374_500_00_03_09.gray",
-				    "00002505_S_301x463_500_00_03_09.gray"},
-				{"00002579_S_278x444_500_00_03_09.gray",
-				    "00002483_S_256x442_500_00_03_09.gray"},
-				{"00002561_N_316x402_500_00_03_03.gray",
-				    "00002542_N_256x423_500_00_03_03.gray"},
-				{"00002541_S_257x502_500_00_03_03.gray",
-				    "00002478_N_324x471_500_00_03_03.gray"},
-				{"00002556_S_256x373_500_00_03_03.gray",
-				    "00002516_N_308x471_500_00_03_03.gray"},
-				{"00002578_N_271x466_500_00_03_04.gray",
-				    "00002488_S_296x461_500_00_03_04.gray"},
-				{"00002569_N_258x467_500_00_03_08.gray",
-				    "00002484_S_256x352_500_00_03_08.gray"},
-				{"00002435_M_256x360_500_00_09_03.gray",
-				    "00002523_S_271x388_500_00_03_03.gray"},
-				{"00002541_S_256x496_500_00_03_08.gray",
-				    "00002449_N_312x436_500_00_03_08.gray"},
-				{"00002578_N_267x446_500_00_03_02.gray",
-				    "00002534_S_256x380_500_00_03_02.gray"},
-				{"00002535_S_286x455_500_00_03_08.gray",
-				    "00002434_U_1600x1500_1000_01_03_08.gray"},
-				{"00002561_N_322x405_500_00_03_08.gray",
-				    "00002521_S_310x552_500_00_03_08.gray"},
-				{"00002483_S_256x442_500_00_03_09.gray",
-				    "00002523_N_346x370_500_00_03_09.gray"},
-				{"00002558_N_324x452_500_00_03_02.gray",
-				    "00002556_N_266x437_500_00_03_02.gray"},
-				{"00002448_A_512x512_500_41_05_04.gray",
-				    "00002472_S_256x364_500_00_03_04.gray"},
-				{"00002500_S_256x397_500_00_03_02.gray",
-				    "00002435_A_512x512_500_41_05_02.gray"},
-				{"00002551_N_277x425_500_00_03_08.gray",
-				    "00002535_N_325x408_500_00_03_08.gray"},
-				{"00002546_S_256x469_500_00_03_08.gray",
-				    "00002521_S_310x552_500_00_03_08.gray"},
-				{"00002504_N_321x501_500_00_03_03.gray",
-				    "00002434_A_512x512_500_41_05_03.gray"},
-				{"00002534_S_256x388_500_00_03_04.gray",
-				    "00002535_N_302x468_500_00_03_04.gray"},
-				{"00002579_S_278x444_500_00_03_09.gray",
-				    "00002445_S_256x414_500_00_03_09.gray"},
-				{"00002495_N_313x457_500_00_03_09.gray",
-				    "00002556_N_260x460_500_00_03_09.gray"},
-				{"00002488_S_334x470_500_00_03_07.gray",
-				    "00002433_S_307x471_500_00_03_07.gray"},
-				{"00002531_S_256x420_500_00_03_04.gray",
-				    "00002574_S_256x468_500_00_03_04.gray"},
-				{"00002504_S_309x431_500_00_03_08.gray",
-				    "00002466_N_288x468_500_00_03_08.gray"},
-				{"00002472_N_319x403_500_00_03_04.gray",
-				    "00002560_N_276x420_500_00_03_04.gray"},
-				{"00002523_N_262x372_500_00_03_03.gray",
-				    "00002516_N_308x471_500_00_03_03.gray"},
-				{"00002551_N_273x411_500_00_03_07.gray",
-				    "00002434_M_256x360_500_00_09_07.gray"},
-				{"00002579_N_336x452_500_00_03_03.gray",
-				    "00002466_N_316x475_500_00_03_03.gray"},
-				{"00002497_S_293x420_500_00_03_07.gray",
-				    "00002456_S_256x389_500_00_03_07.gray"},
-				{"00002505_N_259x386_500_00_03_08.gray",
-				    "00002561_N_322x405_500_00_03_08.gray"},
-				{"00002456_S_256x434_500_00_03_08.gray",
-				    "00002495_N_325x413_500_00_03_08.gray"},
-				{"00002480_N_311x449_500_00_03_04.gray",
-				    "00002569_N_294x438_500_00_03_04.gray"},
-				{"00002574_S_256x444_500_00_03_08.gray",
-				    "00002448_N_280x404_500_00_03_08.gray"},
-				{"00002556_S_256x373_500_00_03_03.gray",
-				    "00002478_N_324x471_500_00_03_03.gray"},
-				{"00002466_S_258x445_500_00_03_08.gray",
-				    "00002579_S_279x461_500_00_03_08.gray"},
-				{"00002523_N_346x370_500_00_03_09.gray",
-				    "00002480_N_292x424_500_00_03_09.gray"},
-				{"00002458_N_273x484_500_00_03_09.gray",
-				    "00002535_S_290x444_500_00_03_09.gray"},
-				{"00002521_N_345x544_500_00_03_09.gray",
-				    "00002458_U_1600x1500_1000_01_03_09.gray"},
-				{"00002500_S_256x394_500_00_03_07.gray",
-				    "00002445_U_1600x1500_1000_01_03_07.gray"},
-				{"00002574_S_256x470_500_00_03_09.gray",
-				    "00002537_S_256x375_500_00_03_09.gray"},
-				{"00002484_N_283x358_500_00_03_09.gray",
-				    "00002558_S_256x436_500_00_03_09.gray"},
-				{"00002571_N_302x477_500_00_03_04.gray",
-				    "00002505_N_385x497_500_00_03_04.gray"},
-				{"00002475_N_296x432_500_00_03_08.gray",
-				    "00002555_N_256x461_500_00_03_08.gray"},
-				{"00002542_S_256x448_500_00_03_09.gray",
-				    "00002495_N_313x457_500_00_03_09.gray"},
-				{"00002495_S_336x493_500_00_03_03.gray",
-				    "00002561_S_256x382_500_00_03_03.gray"},
-				{"00002480_S_293x429_500_00_03_07.gray",
-				    "00002497_N_256x347_500_00_03_07.gray"},
-				{"00002574_S_256x444_500_00_03_02.gray",
-				    "00002555_N_256x427_500_00_03_02.gray"},
-				{"00002457_U_1600x1500_1000_01_03_09.gray",
-				    "00002484_S_256x337_500_00_03_09.gray"},
-				{"00002546_S_273x471_500_00_03_04.gray",
-				    "00002505_S_305x454_500_00_03_04.gray"},
-				{"00002578_N_256x435_500_00_03_08.gray",
-				    "00002555_N_256x461_500_00_03_08.gray"},
-				{"00002571_S_270x487_500_00_03_03.gray",
-				    "00002433_N_293x459_500_00_03_03.gray"},
-				{"00002495_N_313x457_500_00_03_09.gray",
-				    "00002483_N_256x441_500_00_03_09.gray"},
-				{"00002502_S_256x379_500_00_03_07.gray",
-				    "00002533_N_272x528_500_00_03_07.gray"},
-				{"00002478_S_256x404_500_00_03_09.gray",
-				    "00002533_S_256x380_500_00_03_09.gray"},
-				{"00002435_A_512x512_500_41_05_08.gray",
-				    "00002458_N_316x386_500_00_03_08.gray"},
-				{"00002434_M_256x360_500_00_09_09.gray",
-				    "00002488_N_310x508_500_00_03_09.gray"},
-				{"00002478_S_256x461_500_00_03_03.gray",
-				    "00002560_N_306x484_500_00_03_03.gray"},
-				{"00002502_S_256x377_500_00_03_02.gray",
-				    "00002497_N_270x359_500_00_03_02.gray"},
-				{"00002475_S_277x454_500_00_03_03.gray",
-				    "00002505_N_366x482_500_00_03_03.gray"},
-				{"00002555_S_256x468_500_00_03_08.gray",
-				    "00002551_S_256x450_500_00_03_08.gray"},
-				{"00002434_A_512x512_500_41_05_08.gray",
-				    "00002480_S_280x449_500_00_03_08.gray"},
-				{"00002505_N_288x440_500_00_03_09.gray",
-				    "00002569_N_269x468_500_00_03_09.gray"},
-				{"00002515_S_256x425_500_00_03_04.gray",
-				    "00002448_A_512x512_500_41_05_04.gray"},
-				{"00002449_S_301x422_500_00_03_07.gray",
-				    "00002571_N_329x527_500_00_03_07.gray"},
-				{"00002537_S_256x367_500_00_03_08.gray",
-				    "00002505_S_329x485_500_00_03_08.gray"},
-				{"00002504_S_284x456_500_00_03_07.gray",
-				    "00002445_A_512x512_500_41_05_07.gray"},
-				{"00002495_S_271x435_500_00_03_02.gray",
-				    "00002551_N_281x405_500_00_03_02.gray"},
-				{"00002558_N_324x452_500_00_03_02.gray",
-				    "00002515_N_256x415_500_00_03_02.gray"},
-				{"00002531_N_271x360_500_00_03_08.gray",
-				    "00002546_N_256x450_500_00_03_08.gray"},
-				{"00002556_S_256x378_500_00_03_07.gray",
-				    "00002561_N_301x413_500_00_03_07.gray"},
-				{"00002546_N_294x441_500_00_03_02.gray",
-				    "00002488_S_324x483_500_00_03_02.gray"},
-				{"00002505_S_329x485_500_00_03_08.gray",
-				    "00002571_S_256x504_500_00_03_08.gray"},
-				{"00002478_N_256x482_500_00_03_08.gray",
-				    "00002558_S_265x434_500_00_03_08.gray"},
-				{"00002531_S_256x374_500_00_03_03.gray",
-				    "00002475_S_277x454_500_00_03_03.gray"},
-				{"00002558_S_313x499_500_00_03_02.gray",
-				    "00002523_S_275x358_500_00_03_02.gray"},
-				{"00002571_N_337x513_500_00_03_08.gray",
-				    "00002502_N_280x427_500_00_03_08.gray"},
-				{"00002521_N_361x490_500_00_03_07.gray",
-				    "00002502_S_256x379_500_00_03_07.gray"},
-				{"00002534_N_256x367_500_00_03_07.gray",
-				    "00002579_S_292x465_500_00_03_07.gray"},
-				{"00002534_N_256x367_500_00_03_07.gray",
-				    "00002480_N_318x452_500_00_03_07.gray"},
-				{"00002449_U_1600x1500_1000_01_03_02.gray",
-				    "00002555_S_256x414_500_00_03_02.gray"},
-				{"00002558_S_286x509_500_00_03_03.gray",
-				    "00002521_S_313x524_500_00_03_03.gray"},
-				{"00002483_N_272x445_500_00_03_02.gray",
-				    "00002569_N_305x420_500_00_03_02.gray"},
-				{"00002480_N_317x453_500_00_03_03.gray",
-				    "00002574_N_299x480_500_00_03_03.gray"},
-				{"00002569_N_258x467_500_00_03_08.gray",
-				    "00002505_N_259x386_500_00_03_08.gray"},
-				{"00002495_S_286x455_500_00_03_09.gray",
-				    "00002535_N_290x426_500_00_03_09.gray"},
-				{"00002571_N_302x477_500_00_03_04.gray",
-				    "00002537_S_256x379_500_00_03_04.gray"},
-				{"00002457_M_256x360_500_00_09_09.gray",
-				    "00002478_N_277x463_500_00_03_09.gray"},
-				{"00002466_N_295x403_500_00_03_07.gray",
-				    "00002551_S_257x402_500_00_03_07.gray"},
-				{"00002502_N_256x391_500_00_03_09.gray",
-				    "00002546_N_277x489_500_00_03_09.gray"},
-				{"00002500_N_287x420_500_00_03_04.gray",
-				    "00002555_S_256x474_500_00_03_04.gray"},
-				{"00002502_N_280x427_500_00_03_08.gray",
-				    "00002457_S_256x386_500_00_03_08.gray"},
-				{"00002547_N_278x430_500_00_03_03.gray",
-				    "00002571_N_324x556_500_00_03_03.gray"},
-				{"00002483_N_300x430_500_00_03_03.gray",
-				    "00002547_S_266x483_500_00_03_03.gray"},
-				{"00002434_N_277x475_500_00_03_08.gray",
-				    "00002550_S_256x465_500_00_03_08.gray"},
-				{"00002537_N_279x392_500_00_03_07.gray",
-				    "00002523_N_307x321_500_00_03_07.gray"},
-				{"00002546_S_280x469_500_00_03_02.gray",
-				    "00002561_S_263x377_500_00_03_02.gray"},
-				{"00002560_S_256x419_500_00_03_09.gray",
-				    "00002533_S_256x380_500_00_03_09.gray"},
-				{"00002558_S_286x509_500_00_03_03.gray",
-				    "00002457_M_256x360_500_00_09_03.gray"},
-				{"00002445_U_1600x1500_1000_01_03_03.gray",
-				    "00002516_N_308x471_500_00_03_03.gray"},
-				{"00002578_S_256x416_500_00_03_09.gray",
-				    "00002558_N_303x492_500_00_03_09.gray"},
-				{"00002495_S_268x437_500_00_03_07.gray",
-				    "00002484_N_280x330_500_00_03_07.gray"},
-				{"00002541_S_256x491_500_00_03_04.gray",
-				    "00002502_S_256x378_500_00_03_04.gray"},
-				{"00002433_N_386x486_500_00_03_07.gray",
-				    "00002571_S_290x482_500_00_03_07.gray"},
-				{"00002569_S_267x411_500_00_03_07.gray",
-				    "00002500_N_256x373_500_00_03_07.gray"},
-				{"00002504_N_310x458_500_00_03_02.gray",
-				    "00002457_S_256x366_500_00_03_02.gray"},
-				{"00002475_S_263x392_500_00_03_07.gray",
-				    "00002448_U_1600x1500_1000_01_03_07.gray"},
-				{"00002502_S_256x376_500_00_03_03.gray",
-				    "00002439_S_287x438_500_00_03_03.gray"},
-				{"00002541_S_256x496_500_00_03_08.gray",
-				    "00002521_N_334x512_500_00_03_08.gray"},
-				{"00002521_S_310x552_500_00_03_08.gray",
-				    "00002579_S_279x461_500_00_03_08.gray"},
-				{"00002561_N_322x405_500_00_03_08.gray",
-				    "00002504_N_286x481_500_00_03_08.gray"},
-				{"00002579_N_296x438_500_00_03_07.gray",
-				    "00002546_S_256x423_500_00_03_07.gray"},
-				{"00002561_S_260x379_500_00_03_07.gray",
-				    "00002445_N_319x415_500_00_03_07.gray"},
-				{"00002533_N_296x433_500_00_03_03.gray",
-				    "00002435_M_256x360_500_00_09_03.gray"},
-				{"00002483_N_256x412_500_00_03_07.gray",
-				    "00002445_N_319x415_500_00_03_07.gray"},
-				{"00002484_N_292x362_500_00_03_02.gray",
-				    "00002472_N_311x384_500_00_03_02.gray"},
-				{"00002478_S_256x461_500_00_03_03.gray",
-				    "00002561_S_256x382_500_00_03_03.gray"},
-				{"00002500_N_276x386_500_00_03_02.gray",
-				    "00002448_A_512x512_500_41_05_02.gray"},
-				{"00002541_N_258x492_500_00_03_09.gray",
-				    "00002488_S_276x476_500_00_03_09.gray"},
-				{"00002531_N_256x375_500_00_03_09.gray",
-				    "00002488_N_310x508_500_00_03_09.gray"},
-				{"00002537_S_256x375_500_00_03_09.gray",
-				    "00002551_N_256x425_500_00_03_09.gray"},
-				{"00002535_N_290x426_500_00_03_09.gray",
-				    "00002546_S_256x385_500_00_03_09.gray"},
-				{"00002475_N_316x374_500_00_03_02.gray",
-				    "00002555_N_256x427_500_00_03_02.gray"},
-				{"00002578_S_279x475_500_00_03_08.gray",
-				    "00002560_N_263x432_500_00_03_08.gray"},
-				{"00002478_N_324x468_500_00_03_02.gray",
-				    "00002537_N_315x399_500_00_03_02.gray"},
-				{"00002531_S_256x390_500_00_03_02.gray",
-				    "00002535_N_302x417_500_00_03_02.gray"},
-				{"00002435_N_296x404_500_00_03_02.gray",
-				    "00002504_N_310x458_500_00_03_02.gray"},
-				{"00002495_N_313x457_500_00_03_09.gray",
-				    "00002435_M_256x360_500_00_09_09.gray"},
-				{"00002466_S_256x442_500_00_03_09.gray",
-				    "00002445_A_512x512_500_41_05_09.gray"},
-				{"00002578_N_293x434_500_00_03_03.gray",
-				    "00002541_N_313x513_500_00_03_03.gray"},
-				{"00002483_N_272x445_500_00_03_02.gray",
-				    "00002458_U_1600x1500_1000_01_03_02.gray"},
-				{"00002456_S_256x416_500_00_03_04.gray",
-				    "00002458_N_322x503_500_00_03_04.gray"},
-				{"00002574_S_256x468_500_00_03_04.gray",
-				    "00002456_N_290x485_500_00_03_04.gray"},
-				{"00002505_S_301x463_500_00_03_09.gray",
-				    "00002466_S_256x442_500_00_03_09.gray"},
-				{"00002556_N_266x437_500_00_03_02.gray",
-				    "00002502_S_256x377_500_00_03_02.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002555_S_256x414_500_00_03_02.gray"},
-				{"00002560_S_256x401_500_00_03_07.gray",
-				    "00002495_N_336x463_500_00_03_07.gray"},
-				{"00002504_S_289x435_500_00_03_03.gray",
-				    "00002551_S_256x414_500_00_03_03.gray"},
-				{"00002558_S_256x436_500_00_03_09.gray",
-				    "00002457_A_512x512_500_41_05_09.gray"},
-				{"00002534_N_256x390_500_00_03_02.gray",
-				    "00002483_N_272x445_500_00_03_02.gray"},
-				{"00002534_N_256x412_500_00_03_08.gray",
-				    "00002448_N_280x404_500_00_03_08.gray"},
-				{"00002445_S_256x436_500_00_03_04.gray",
-				    "00002435_U_1600x1500_1000_01_03_04.gray"},
-				{"00002561_N_300x422_500_00_03_04.gray",
-				    "00002537_S_256x379_500_00_03_04.gray"},
-				{"00002449_N_325x482_500_00_03_09.gray",
-				    "00002433_U_1600x1500_1000_01_03_09.gray"},
-				{"00002445_N_268x453_500_00_03_03.gray",
-				    "00002537_N_318x422_500_00_03_03.gray"},
-				{"00002546_N_256x423_500_00_03_07.gray",
-				    "00002561_S_260x379_500_00_03_07.gray"},
-				{"00002560_S_256x401_500_00_03_07.gray",
-				    "00002488_N_316x459_500_00_03_07.gray"},
-				{"00002502_S_256x376_500_00_03_03.gray",
-				    "00002534_S_256x352_500_00_03_03.gray"},
-				{"00002505_S_305x454_500_00_03_04.gray",
-				    "00002569_N_294x438_500_00_03_04.gray"},
-				{"00002541_S_277x472_500_00_03_02.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"00002550_S_261x479_500_00_03_03.gray",
-				    "00002475_N_277x412_500_00_03_03.gray"},
-				{"00002488_N_365x494_500_00_03_02.gray",
-				    "00002555_S_256x414_500_00_03_02.gray"},
-				{"00002480_S_280x449_500_00_03_08.gray",
-				    "00002488_S_278x455_500_00_03_08.gray"},
-				{"00002534_N_256x434_500_00_03_09.gray",
-				    "00002435_N_264x490_500_00_03_09.gray"},
-				{"00002537_N_315x399_500_00_03_02.gray",
-				    "00002433_A_512x512_500_41_05_02.gray"},
-				{"00002541_S_256x470_500_00_03_09.gray",
-				    "00002502_N_256x391_500_00_03_09.gray"},
-				{"00002500_S_256x415_500_00_03_08.gray",
-				    "00002445_S_256x483_500_00_03_08.gray"},
-				{"00002484_N_292x362_500_00_03_02.gray",
-				    "00002558_N_324x452_500_00_03_02.gray"},
-				{"00002495_N_336x463_500_00_03_07.gray",
-				    "00002561_N_301x413_500_00_03_07.gray"},
-				{"00002433_S_303x480_500_00_03_02.gray",
-				    "00002547_S_257x414_500_00_03_02.gray"},
-				{"00002504_S_284x456_500_00_03_07.gray",
-				    "00002448_U_1600x1500_1000_01_03_07.gray"},
-				{"00002558_N_306x488_500_00_03_07.gray",
-				    "00002521_S_309x503_500_00_03_07.gray"},
-				{"00002574_N_256x395_500_00_03_07.gray",
-				    "00002433_A_512x512_500_41_05_07.gray"},
-				{"00002433_M_256x360_500_00_09_03.gray",
-				    "00002542_N_256x423_500_00_03_03.gray"},
-				{"00002515_S_256x436_500_00_03_08.gray",
-				    "00002504_S_309x431_500_00_03_08.gray"},
-				{"00002433_U_1600x1500_1000_01_03_08.gray",
-				    "00002515_N_256x427_500_00_03_08.gray"},
-				{"00002457_A_512x512_500_41_05_02.gray",
-				    "00002478_S_256x438_500_00_03_02.gray"},
-				{"00002558_N_324x452_500_00_03_02.gray",
-				    "00002480_N_334x463_500_00_03_02.gray"},
-				{"00002555_N_256x356_500_00_03_07.gray",
-				    "00002458_A_512x512_500_41_05_07.gray"},
-				{"00002439_S_279x448_500_00_03_09.gray",
-				    "00002560_S_256x419_500_00_03_09.gray"},
-				{"00002515_N_256x460_500_00_03_09.gray",
-				    "00002569_S_277x412_500_00_03_09.gray"},
-				{"00002488_S_296x482_500_00_03_03.gray",
-				    "00002448_U_1600x1500_1000_01_03_03.gray"},
-				{"00002483_N_300x430_500_00_03_03.gray",
-				    "00002475_S_277x454_500_00_03_03.gray"},
-				{"00002555_S_256x474_500_00_03_04.gray",
-				    "00002456_A_512x512_500_41_05_04.gray"},
-				{"00002569_S_258x412_500_00_03_04.gray",
-				    "00002466_N_325x460_500_00_03_04.gray"},
-				{"00002449_M_256x360_500_00_09_02.gray",
-				    "00002466_S_275x439_500_00_03_02.gray"},
-				{"00002574_N_286x468_500_00_03_04.gray",
-				    "00002555_N_302x512_500_00_03_04.gray"},
-				{"00002542_S_260x419_500_00_03_02.gray",
-				    "00002546_N_294x441_500_00_03_02.gray"},
-				{"00002475_S_263x392_500_00_03_07.gray",
-				    "00002542_N_282x461_500_00_03_07.gray"},
-				{"00002504_S_289x435_500_00_03_03.gray",
-				    "00002533_N_296x433_500_00_03_03.gray"},
-				{"00002448_U_1600x1500_1000_01_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002521_N_386x515_500_00_03_03.gray",
-				    "00002558_S_286x509_500_00_03_03.gray"},
-					{"00002500_N_256x373_500_00_03_07.gray",
-				    "00002556_N_263x414_500_00_03_07.gray"},
-				{"00002550_S_256x401_500_00_03_09.gray",
-				    "00002521_S_259x474_500_00_03_09.gray"},
-				{"00002457_N_256x387_500_00_03_03.gray",
-				    "00002502_S_256x376_500_00_03_03.gray"},
-				{"00002488_S_324x483_500_00_03_02.gray",
-				    "00002569_N_305x420_500_00_03_02.gray"},
-				{"00002502_N_280x427_500_00_03_08.gray",
-				    "00002558_S_265x434_500_00_03_08.gray"},
-				{"00002535_N_308x468_500_00_03_07.gray",
-				    "00002571_S_290x482_500_00_03_07.gray"},
-				{"00002488_S_324x483_500_00_03_02.gray",
-				    "00002546_N_294x441_500_00_03_02.gray"},
-				{"00002515_N_256x427_500_00_03_08.gray",
-				    "00002502_S_256x402_500_00_03_08.gray"},
-				{"00002516_N_265x453_500_00_03_09.gray",
-				    "00002456_M_256x360_500_00_09_09.gray"},
-				{"00002456_U_1600x1500_1000_01_03_08.gray",
-				    "00002448_N_280x404_500_00_03_08.gray"},
-				{"00002456_N_256x485_500_00_03_09.gray",
-				    "00002571_N_317x501_500_00_03_09.gray"},
-				{"00002578_S_279x475_500_00_03_08.gray",
-				    "00002541_S_256x496_500_00_03_08.gray"},
-				{"00002578_S_256x458_500_00_03_04.gray",
-				    "00002537_S_256x379_500_00_03_04.gray"},
-				{"00002531_N_256x375_500_00_03_09.gray",
-				    "00002500_S_256x378_500_00_03_09.gray"},
-				{"00002555_S_256x474_500_00_03_04.gray",
-				    "00002547_S_256x433_500_00_03_04.gray"},
-				{"00002516_N_287x433_500_00_03_07.gray",
-				    "00002448_M_256x360_500_00_09_07.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002502_S_256x377_500_00_03_02.gray"},
-				{"00002523_N_346x370_500_00_03_09.gray",
-				    "00002497_N_317x520_500_00_03_09.gray"},
-				{"00002574_S_256x454_500_00_03_03.gray",
-				    "00002515_N_256x486_500_00_03_03.gray"},
-				{"00002495_S_286x455_500_00_03_09.gray",
-				    "00002555_S_256x492_500_00_03_09.gray"},
-				{"00002541_N_259x447_500_00_03_07.gray",
-				    "00002535_S_277x464_500_00_03_07.gray"},
-				{"00002500_S_256x399_500_00_03_04.gray",
-				    "00002472_S_256x364_500_00_03_04.gray"},
-				{"00002550_N_294x522_500_00_03_02.gray",
-				    "00002456_U_1600x1500_1000_01_03_02.gray"},
-				{"00002571_N_337x513_500_00_03_08.gray",
-				    "00002579_N_294x486_500_00_03_08.gray"},
-				{"00002547_S_256x433_500_00_03_04.gray",
-				    "00002550_N_275x533_500_00_03_04.gray"},
-				{"00002458_A_512x512_500_41_05_09.gray",
-				    "00002497_N_317x520_500_00_03_09.gray"},
-				{"00002533_N_272x528_500_00_03_07.gray",
-				    "00002523_N_307x321_500_00_03_07.gray"},
-				{"00002569_S_267x411_500_00_03_07.gray",
-				    "00002531_N_256x363_500_00_03_07.gray"},
-				{"00002542_N_282x477_500_00_03_02.gray",
-				    "00002500_N_276x386_500_00_03_02.gray"},
-				{"00002523_S_260x372_500_00_03_04.gray",
-				    "00002531_N_269x430_500_00_03_04.gray"},
-				{"00002488_S_276x476_500_00_03_09.gray",
-				    "00002484_N_283x358_500_00_03_09.gray"},
-				{"00002561_S_256x363_500_00_03_04.gray",
-				    "00002515_N_256x420_500_00_03_04.gray"},
-				{"00002546_S_256x469_500_00_03_08.gray",
-				    "00002561_N_322x405_500_00_03_08.gray"},
-				{"00002505_N_366x482_500_00_03_03.gray",
-				    "00002547_S_266x483_500_00_03_03.gray"},
-				{"00002541_N_313x513_500_00_03_03.gray",
-				    "00002478_S_256x461_500_00_03_03.gray"},
-				{"00002531_S_256x374_500_00_03_03.gray",
-				    "00002434_U_1600x1500_1000_01_03_03.gray"},
-				{"00002515_N_256x460_500_00_03_09.gray",
-				    "00002534_N_256x434_500_00_03_09.gray"},
-				{"00002542_S_256x425_500_00_03_07.gray",
-				    "00002434_A_512x512_500_41_05_07.gray"},
-				{"00002578_N_266x408_500_00_03_09.gray",
-				    "00002541_N_258x492_500_00_03_09.gray"},
-				{"00002579_N_336x452_500_00_03_03.gray",
-				    "00002445_A_512x512_500_41_05_03.gray"},
-				{"00002551_N_277x425_500_00_03_08.gray",
-				    "00002521_N_334x512_500_00_03_08.gray"},
-				{"00002535_S_290x444_500_00_03_09.gray",
-				    "00002551_S_256x425_500_00_03_09.gray"},
-				{"00002556_S_256x388_500_00_03_09.gray",
-				    "00002466_S_256x442_500_00_03_09.gray"},
-				{"00002472_S_256x364_500_00_03_04.gray",
-				    "00002516_S_256x420_500_00_03_04.gray"},
-				{"00002534_N_256x378_500_00_03_03.gray",
-				    "00002571_N_324x556_500_00_03_03.gray"},
-				{"00002466_N_325x460_500_00_03_04.gray",
-				    "00002480_N_311x449_500_00_03_04.gray"},
-				{"00002445_S_272x442_500_00_03_07.gray",
-				    "00002521_N_361x490_500_00_03_07.gray"},
-				{"00002515_N_256x412_500_00_03_07.gray",
-				    "00002478_N_311x445_500_00_03_07.gray"},
-				{"00002505_S_329x485_500_00_03_08.gray",
-				    "00002448_U_1600x1500_1000_01_03_08.gray"},
-				{"00002484_N_280x330_500_00_03_07.gray",
-				    "00002445_A_512x512_500_41_05_07.gray"},
-				{"00002556_S_256x380_500_00_03_08.gray",
-				    "00002504_S_309x431_500_00_03_08.gray"},
-				{"00002556_N_303x490_500_00_03_04.gray",
-				    "00002558_S_267x490_500_00_03_04.gray"},
-				{"00002448_U_1600x1500_1000_01_03_05.gray",
-				    "00002435_M_256x360_500_00_09_05.gray"},
-				{"00002541_N_259x447_500_00_03_07.gray",
-				    "00002488_N_316x459_500_00_03_07.gray"},
-				{"00002516_N_270x443_500_00_03_04.gray",
-				    "00002495_S_290x513_500_00_03_04.gray"},
-				{"00002495_N_357x419_500_00_03_02.gray",
-				    "00002574_N_258x455_500_00_03_02.gray"},
-				{"00002497_N_265x276_500_00_03_04.gray",
-				    "00002574_S_256x468_500_00_03_04.gray"},
-				{"00002537_S_256x345_500_00_03_02.gray",
-				    "00002466_S_275x439_500_00_03_02.gray"},
-				{"00002574_S_256x444_500_00_03_08.gray",
-				    "00002497_S_278x409_500_00_03_08.gray"},
-				{"00002504_S_264x482_500_00_03_09.gray",
-				    "00002531_N_256x375_500_00_03_09.gray"},
-				{"00002556_N_269x467_500_00_03_08.gray",
-				    "00002558_N_272x450_500_00_03_08.gray"},
-				{"00002480_S_283x445_500_00_03_09.gray",
-				    "00002550_S_256x401_500_00_03_09.gray"},
-				{"00002546_N_294x441_500_00_03_02.gray",
-				    "00002574_N_258x455_500_00_03_02.gray"},
-				{"00002521_N_382x516_500_00_03_04.gray",
-				    "00002504_N_282x461_500_00_03_04.gray"},
-				{"00002466_N_277x477_500_00_03_09.gray",
-				    "00002533_N_307x541_500_00_03_09.gray"},
-				{"00002497_N_323x455_500_00_03_03.gray",
-				    "00002515_S_256x440_500_00_03_03.gray"},
-				{"00002500_N_287x420_500_00_03_04.gray",
-				    "00002531_S_256x420_500_00_03_04.gray"},
-				{"00002551_S_256x420_500_00_03_04.gray",
-				    "00002449_U_1600x1500_1000_01_03_04.gray"},
-				{"00002535_S_290x444_500_00_03_09.gray",
-				    "00002516_S_256x431_500_00_03_09.gray"},
-				{"00002571_N_324x556_500_00_03_03.gray",
-				    "00002456_N_268x478_500_00_03_03.gray"},
-				{"00002484_N_292x362_500_00_03_02.gray",
-				    "00002556_N_266x437_500_00_03_02.gray"},
-				{"00002480_S_283x445_500_00_03_09.gray",
-				    "00002466_N_277x477_500_00_03_09.gray"},
-				{"00002480_N_317x453_500_00_03_03.gray",
-				    "00002542_N_256x423_500_00_03_03.gray"},
-				{"00002534_N_256x367_500_00_03_07.gray",
-				    "00002516_S_269x429_500_00_03_07.gray"},
-				{"00002484_N_266x361_500_00_03_08.gray",
-				    "00002556_N_269x467_500_00_03_08.gray"},
-				{"00002551_N_268x449_500_00_03_03.gray",
-				    "00002523_N_262x372_500_00_03_03.gray"},
-				{"00002533_S_256x401_500_00_03_02.gray",
-				    "00002531_S_256x390_500_00_03_02.gray"},
-				{"00002502_N_298x446_500_00_03_07.gray",
-				    "00002466_N_295x403_500_00_03_07.gray"},
-				{"00002516_S_267x435_500_00_03_02.gray",
-				    "00002483_S_256x361_500_00_03_02.gray"},
-				{"00002458_S_256x399_500_00_03_03.gray",
-				    "00002475_S_277x454_500_00_03_03.gray"},
-				{"00002515_N_256x486_500_00_03_03.gray",
-				    "00002456_U_1600x1500_1000_01_03_03.gray"},
-				{"00002433_M_256x360_500_00_09_04.gray",
-				    "00002456_M_256x360_500_00_09_04.gray"},
-				{"00002537_S_256x375_500_00_03_09.gray",
-				    "00002546_N_277x489_500_00_03_09.gray"},
-				{"00002502_N_256x391_500_00_03_09.gray",
-				    "00002542_S_256x448_500_00_03_09.gray"},
-				{"00002480_S_280x449_500_00_03_08.gray",
-				    "00002556_N_269x467_500_00_03_08.gray"},
-				{"00002445_A_512x512_500_41_05_09.gray",
-				    "00002435_U_1600x1500_1000_01_03_09.gray"},
-				{"00002551_N_256x420_500_00_03_04.gray",
-				    "00002449_S_286x433_500_00_03_04.gray"},
-				{"00002457_M_256x360_500_00_09_03.gray",
-				    "00002480_S_288x459_500_00_03_03.gray"},
-				{"00002483_S_256x374_500_00_03_03.gray",
-				    "00002458_N_303x449_500_00_03_03.gray"},
-				{"00002521_S_313x524_500_00_03_03.gray",
-				    "00002439_S_287x438_500_00_03_03.gray"},
-				{"00002533_N_296x514_500_00_03_08.gray",
-				    "00002500_N_256x400_500_00_03_08.gray"},
-				{"00002478_S_256x405_500_00_03_04.gray",
-				    "00002569_S_258x412_500_00_03_04.gray"},
-				{"00002504_N_320x470_500_00_03_07.gray",
-				    "00002534_N_256x367_500_00_03_07.gray"},
-				{"00002448_N_297x402_500_00_03_07.gray",
-				    "00002449_A_512x512_500_41_05_07.gray"},
-				{"00002435_M_256x360_500_00_09_05.gray",
-				    "00002434_M_256x360_500_00_09_05.gray"},
-				{"00002535_S_277x464_500_00_03_07.gray",
-				    "00002561_N_301x413_500_00_03_07.gray"},
-				{"00002502_N_256x373_500_00_03_04.gray",
-				    "00002534_S_256x388_500_00_03_04.gray"},
-				{"00002546_S_256x385_500_00_03_09.gray",
-				    "00002448_U_1600x1500_1000_01_03_09.gray"},
-				{"00002505_N_283x363_500_00_03_07.gray",
-				    "00002550_N_269x519_500_00_03_07.gray"},
-				{"00002505_S_302x480_500_00_03_07.gray",
-				    "00002500_N_256x373_500_00_03_07.gray"},
-				{"00002558_N_298x489_500_00_03_03.gray",
-				    "00002500_N_256x408_500_00_03_03.gray"},
-				{"00002579_N_294x486_500_00_03_08.gray",
-				    "00002555_N_256x461_500_00_03_08.gray"},
-				{"00002439_M_256x360_500_00_09_07.gray",
-				    "00002537_N_279x392_500_00_03_07.gray"},
-				{"00002497_S_278x409_500_00_03_08.gray",
-				    "00002445_S_256x483_500_00_03_08.gray"},
-				{"00002439_U_1600x1500_1000_01_03_08.gray",
-				    "00002550_N_256x462_500_00_03_08.gray"},
-				{"00002502_N_256x327_500_00_03_02.gray",
-				    "00002505_N_331x443_500_00_03_02.gray"},
-				{"00002516_N_265x453_500_00_03_09.gray",
-				    "00002488_S_276x476_500_00_03_09.gray"},
-				{"00002500_N_287x420_500_00_03_04.gray",
-				    "00002478_N_308x478_500_00_03_04.gray"},
-				{"00002505_N_385x497_500_00_03_04.gray",
-				    "00002478_S_256x405_500_00_03_04.gray"},
-				{"00002475_S_256x411_500_00_03_08.gray",
-				    "00002542_N_303x442_500_00_03_08.gray"},
-				{"00002523_N_262x372_500_00_03_03.gray",
-				    "00002449_U_1600x1500_1000_01_03_03.gray"},
-				{"00002495_N_336x463_500_00_03_07.gray",
-				    "00002484_N_280x330_500_00_03_07.gray"},
-				{"00002537_N_279x392_500_00_03_07.gray",
-				    "00002488_N_316x459_500_00_03_07.gray"},
-				{"00002569_N_256x424_500_00_03_07.gray",
-				    "00002456_A_512x512_500_41_05_07.gray"},
-				{"00002569_S_290x485_500_00_03_03.gray",
-				    "00002435_M_256x360_500_00_09_03.gray"},
-				{"00002466_N_288x468_500_00_03_08.gray",
-				    "00002546_S_256x469_500_00_03_08.gray"},
-				{"00002574_N_256x422_500_00_03_08.gray",
-				    "00002515_S_256x436_500_00_03_08.gray"},
-				{"00002439_M_256x360_500_00_09_06.gray",
-				    "00002458_A_512x512_500_41_05_06.gray"},
-				{"00002480_N_334x463_500_00_03_02.gray",
-				    "00002434_N_320x437_500_00_03_02.gray"},
-				{"00002478_N_256x482_500_00_03_08.gray",
-				    "00002551_N_277x425_500_00_03_08.gray"},
-				{"00002579_S_278x444_500_00_03_09.gray",
-				    "00002500_N_257x413_500_00_03_09.gray"},
-				{"00002558_S_267x490_500_00_03_04.gray",
-				    "00002505_S_305x454_500_00_03_04.gray"},
-				{"00002456_M_256x360_500_00_09_03.gray",
-				    "00002504_S_289x435_500_00_03_03.gray"},
-				{"00002556_S_256x388_500_00_03_09.gray",
-				    "00002483_S_256x442_500_00_03_09.gray"},
-				{"00002542_S_256x425_500_00_03_07.gray",
-				    "00002483_S_256x397_500_00_03_07.gray"},
-				{"00002502_N_258x332_500_00_03_03.gray",
-				    "00002505_N_366x482_500_00_03_03.gray"},
-				{"00002531_S_269x402_500_00_03_08.gray",
-				    "00002541_S_256x496_500_00_03_08.gray"},
-				{"00002531_N_256x363_500_00_03_07.gray",
-				    "00002523_N_307x321_500_00_03_07.gray"},
-				{"00002472_S_256x344_500_00_03_03.gray",
-				    "00002547_N_278x430_500_00_03_03.gray"},
-				{"00002550_S_256x465_500_00_03_08.gray",
-				    "00002569_N_258x467_500_00_03_08.gray"},
-				{"00002521_S_308x483_500_00_03_02.gray",
-				    "00002560_S_259x388_500_00_03_02.gray"},
-				{"00002579_S_279x461_500_00_03_08.gray",
-				    "00002505_S_329x485_500_00_03_08.gray"},
-				{"00002515_N_256x486_500_00_03_03.gray",
-				    "00002502_N_258x332_500_00_03_03.gray"},
-				{"00002497_N_270x359_500_00_03_02.gray",
-				    "00002533_N_319x439_500_00_03_02.gray"},
-				{"00002439_S_293x482_500_00_03_08.gray",
-				    "00002495_S_291x455_500_00_03_08.gray"},
-				{"00002497_N_323x455_500_00_03_03.gray",
-				    "00002445_N_268x453_500_00_03_03.gray"},
-				{"00002558_N_306x488_500_00_03_07.gray",
-				    "00002478_S_256x411_500_00_03_07.gray"},
-				{"00002488_N_334x487_500_00_03_08.gray",
-				    "00002434_U_1600x1500_1000_01_03_08.gray"},
-				{"00002574_S_256x470_500_00_03_09.gray",
-				    "00002439_N_299x422_500_00_03_09.gray"},
-				{"00002561_N_301x413_500_00_03_07.gray",
-				    "00002541_S_262x486_500_00_03_07.gray"},
-				{"00002542_S_256x425_500_00_03_07.gray",
-				    "00002561_S_260x379_500_00_03_07.gray"},
-				{"00002542_S_256x425_500_00_03_07.gray",
-				    "00002449_N_265x382_500_00_03_07.gray"},
-				{"00002439_M_256x360_500_00_09_07.gray",
-				    "00002495_N_336x463_500_00_03_07.gray"},
-				{"00002561_N_322x405_500_00_03_08.gray",
-				    "00002521_N_334x512_500_00_03_08.gray"},
-				{"00002531_S_269x402_500_00_03_08.gray",
-				    "00002500_S_256x415_500_00_03_08.gray"},
-				{"00002495_N_367x378_500_00_03_03.gray",
-				    "00002551_S_256x414_500_00_03_03.gray"},
-				{"00002466_N_288x468_500_00_03_08.gray",
-				    "00002547_N_299x452_500_00_03_08.gray"},
-				{"00002531_S_265x408_500_00_03_07.gray",
-				    "00002516_S_269x429_500_00_03_07.gray"},
-				{"00002449_U_1600x1500_1000_01_03_01.gray",
-				    "00002458_U_1600x1500_1000_01_03_01.gray"},
-				{"00002571_N_329x527_500_00_03_07.gray",
-				    "00002531_N_256x363_500_00_03_07.gray"},
-				{"00002478_S_256x435_500_00_03_08.gray",
-				    "00002547_N_299x452_500_00_03_08.gray"},
-				{"00002537_S_256x375_500_00_03_09.gray",
-				    "00002571_S_267x515_500_00_03_09.gray"},
-				{"00002515_S_256x425_500_00_03_09.gray",
-				    "00002555_S_256x492_500_00_03_09.gray"},
-				{"00002475_N_316x374_500_00_03_02.gray",
-				    "00002560_N_331x447_500_00_03_02.gray"},
-				{"00002458_U_1600x1500_1000_01_03_04.gray",
-				    "00002560_S_268x396_500_00_03_04.gray"},
-				{"00002555_S_256x414_500_00_03_02.gray",
-				    "00002456_S_256x394_500_00_03_02.gray"},
-				{"00002579_N_315x419_500_00_03_02.gray",
-				    "00002551_N_281x405_500_00_03_02.gray"},
-				{"00002475_S_264x421_500_00_03_04.gray",
-				    "00002439_U_1600x1500_1000_01_03_04.gray"},
-				{"00002542_S_256x448_500_00_03_09.gray",
-				    "00002547_N_274x485_500_00_03_09.gray"},
-				{"00002502_S_256x378_500_00_03_04.gray",
-				    "00002551_N_256x420_500_00_03_04.gray"},
-				{"00002558_S_286x509_500_00_03_03.gray",
-				    "00002488_S_296x482_500_00_03_03.gray"},
-				{"00002533_S_256x329_500_00_03_08.gray",
-				    "00002534_S_256x412_500_00_03_08.gray"},
-				{"00002560_S_259x388_500_00_03_02.gray",
-				    "00002483_N_272x445_500_00_03_02.gray"},
-				{"00002497_N_265x276_500_00_03_04.gray",
-				    "00002560_N_276x420_500_00_03_04.gray"},
-				{"00002495_S_290x513_500_00_03_04.gray",
-				    "00002523_N_332x387_500_00_03_04.gray"},
-				{"00002475_N_296x433_500_00_03_09.gray",
-				    "00002546_N_277x489_500_00_03_09.gray"},
-				{"00002574_N_256x466_500_00_03_09.gray",
-				    "00002578_S_256x416_500_00_03_09.gray"},
-				{"00002516_N_315x469_500_00_03_08.gray",
-				    "00002531_S_269x402_500_00_03_08.gray"},
-				{"00002483_S_256x374_500_00_03_03.gray",
-				    "00002466_N_316x475_500_00_03_03.gray"},
-				{"00002472_S_256x344_500_00_03_03.gray",
-				    "00002439_A_512x512_500_41_05_03.gray"},
-				{"00002483_S_256x374_500_00_03_03.gray",
-				    "00002556_N_272x474_500_00_03_03.gray"},
-				{"00002497_S_293x420_500_00_03_07.gray",
-				    "00002458_S_256x454_500_00_03_07.gray"},
-				{"00002480_N_292x424_500_00_03_09.gray",
-				    "00002571_N_317x501_500_00_03_09.gray"},
-				{"00002561_S_257x411_500_00_03_08.gray",
-				    "00002560_S_256x418_500_00_03_08.gray"},
-				{"00002534_S_256x412_500_00_03_08.gray",
-				    "00002515_N_256x427_500_00_03_08.gray"},
-				{"00002475_N_327x452_500_00_03_04.gray",
-				    "00002478_S_256x405_500_00_03_04.gray"},
-				{"00002521_S_313x524_500_00_03_03.gray",
-				    "00002505_N_366x482_500_00_03_03.gray"},
-				{"00002478_S_256x405_500_00_03_04.gray",
-				    "00002546_S_273x471_500_00_03_04.gray"},
-				{"00002546_N_256x450_500_00_03_08.gray",
-				    "00002439_U_1600x1500_1000_01_03_08.gray"},
-				{"00002500_N_276x386_500_00_03_02.gray",
-				    "00002448_M_256x360_500_00_09_02.gray"},
-				{"00002466_S_256x463_500_00_03_04.gray",
-				    "00002480_S_268x468_500_00_03_04.gray"},
-				{"00002550_S_256x503_500_00_03_07.gray",
-				    "00002578_S_256x432_500_00_03_07.gray"},
-				{"00002483_S_256x410_500_00_03_04.gray",
-				    "00002515_N_256x420_500_00_03_04.gray"},
-				{"00002550_S_256x503_500_00_03_07.gray",
-				    "00002483_N_256x412_500_00_03_07.gray"},
-				{"00002483_N_256x412_500_00_03_07.gray",
-				    "00002488_N_316x459_500_00_03_07.gray"},
-				{"00002497_S_278x409_500_00_03_08.gray",
-				    "00002558_S_265x434_500_00_03_08.gray"},
-				{"00002504_N_286x481_500_00_03_08.gray",
-				    "00002569_N_258x467_500_00_03_08.gray"},
-				{"00002521_S_313x524_500_00_03_03.gray",
-				    "00002445_S_265x477_500_00_03_03.gray"},
-				{"00002542_S_260x419_500_00_03_02.gray",
-				    "00002504_N_310x458_500_00_03_02.gray"},
-				{"00002555_N_303x433_500_00_03_03.gray",
-				    "00002534_N_256x378_500_00_03_03.gray"},
-				{"00002547_N_278x430_500_00_03_03.gray",
-				    "00002515_N_256x486_500_00_03_03.gray"},
-				{"00002497_N_256x347_500_00_03_07.gray",
-				    "00002495_N_336x463_500_00_03_07.gray"},
-				{"00002475_S_263x392_500_00_03_07.gray",
-				    "00002448_S_256x384_500_00_03_07.gray"},
-				{"00002547_N_278x430_500_00_03_03.gray",
-				    "00002535_S_279x428_500_00_03_03.gray"},
-				{"00002547_S_256x478_500_00_03_09.gray",
-				    "00002456_N_256x485_500_00_03_09.gray"},
-				{"00002534_N_256x378_500_00_03_03.gray",
-				    "00002504_S_289x435_500_00_03_03.gray"},
-				{"00002542_N_282x461_500_00_03_07.gray",
-				    "00002521_S_309x503_500_00_03_07.gray"},
-				{"00002466_S_288x420_500_00_03_07.gray",
-				    "00002531_S_265x408_500_00_03_07.gray"},
-				{"00002480_N_311x449_500_00_03_04.gray",
-				    "00002556_N_303x490_500_00_03_04.gray"},
-				{"00002445_M_256x360_500_00_09_02.gray",
-				    "00002458_M_256x360_500_00_09_02.gray"},
-				{"00002556_S_256x388_500_00_03_09.gray",
-				    "00002551_S_256x425_500_00_03_09.gray"},
-				{"00002558_S_313x420_500_00_03_07.gray",
-				    "00002541_S_262x486_500_00_03_07.gray"},
-				{"00002497_S_302x428_500_00_03_04.gray",
-				    "00002523_S_260x372_500_00_03_04.gray"},
-				{"00002574_S_256x444_500_00_03_08.gray",
-				    "00002542_S_256x426_500_00_03_08.gray"},
-				{"00002480_S_283x445_500_00_03_09.gray",
-				    "00002578_S_256x416_500_00_03_09.gray"},
-				{"00002516_S_256x431_500_00_03_09.gray",
-				    "00002569_S_277x412_500_00_03_09.gray"},
-				{"00002561_N_319x391_500_00_03_02.gray",
-				    "00002531_N_256x393_500_00_03_02.gray"},
-				{"00002555_S_256x422_500_00_03_07.gray",
-				    "00002515_S_256x419_500_00_03_07.gray"},
-				{"00002457_M_256x360_500_00_09_03.gray",
-				    "00002541_S_257x502_500_00_03_03.gray"},
-				{"00002505_S_301x463_500_00_03_09.gray",
-				    "00002561_N_303x427_500_00_03_09.gray"},
-				{"00002537_S_256x310_500_00_03_07.gray",
-				    "00002578_S_256x432_500_00_03_07.gray"},
-				{"00002531_S_269x402_500_00_03_08.gray",
-				    "00002495_S_291x455_500_00_03_08.gray"},
-				{"00002500_S_256x399_500_00_03_04.gray",
-				    "00002495_N_321x394_500_00_03_04.gray"},
-				{"00002434_S_268x426_500_00_03_04.gray",
-				    "00002456_M_256x360_500_00_09_04.gray"},
-				{"00002534_N_256x367_500_00_03_07.gray",
-				    "00002504_S_284x456_500_00_03_07.gray"},
-				{"00002516_S_267x435_500_00_03_02.gray",
-				    "00002558_S_313x499_500_00_03_02.gray"},
-				{"00002560_N_263x432_500_00_03_08.gray",
-				    "00002457_A_512x512_500_41_05_08.gray"},
-				{"00002551_S_256x450_500_00_03_08.gray",
-				    "00002472_S_256x382_500_00_03_08.gray"},
-				{"00002579_N_311x490_500_00_03_09.gray",
-				    "00002439_N_299x422_500_00_03_09.gray"},
-				{"00002569_N_281x455_500_00_03_03.gray",
-				    "00002560_S_258x408_500_00_03_03.gray"},
-				{"00002484_S_273x386_500_00_03_04.gray",
-				    "00002439_A_512x512_500_41_05_04.gray"},
-				{"00002472_S_256x381_500_00_03_07.gray",
-				    "00002505_S_302x480_500_00_03_07.gray"},
-				{"00002495_N_336x463_500_00_03_07.gray",
-				    "00002439_N_299x440_500_00_03_07.gray"},
-				{"00002457_M_256x360_500_00_09_06.gray",
-				    "00002456_U_1600x1500_1000_01_03_06.gray"},
-				{"00002541_S_256x470_500_00_03_09.gray",
-				    "00002480_N_292x424_500_00_03_09.gray"},
-				{"00002550_N_259x505_500_00_03_09.gray",
-				    "00002578_N_266x408_500_00_03_09.gray"},
-				{"00002533_S_256x424_500_00_03_07.gray",
-				    "00002448_N_297x402_500_00_03_07.gray"},
-				{"00002483_S_256x361_500_00_03_02.gray",
-				    "00002560_S_259x388_500_00_03_02.gray"},
-				{"00002456_N_274x409_500_00_03_07.gray",
-				    "00002546_S_256x423_500_00_03_07.gray"},
-				{"00002574_S_256x468_500_00_03_04.gray",
-				    "00002458_N_322x503_500_00_03_04.gray"},
-				{"00002500_S_256x399_500_00_03_04.gray",
-				    "00002478_S_256x405_500_00_03_04.gray"},
-				{"00002475_S_277x454_500_00_03_03.gray",
-				    "00002516_S_261x436_500_00_03_03.gray"},
-				{"00002472_S_256x364_500_00_03_04.gray",
-				    "00002515_S_256x425_500_00_03_04.gray"},
-				{"00002439_U_1600x1500_1000_01_03_02.gray",
-				    "00002523_N_256x308_500_00_03_02.gray"},
-				{"00002500_S_256x378_500_00_03_09.gray",
-				    "00002521_N_345x544_500_00_03_09.gray"},
-				{"00002500_N_276x386_500_00_03_02.gray",
-				    "00002531_N_256x393_500_00_03_02.gray"},
-				{"00002475_S_277x454_500_00_03_03.gray",
-				    "00002500_S_256x409_500_00_03_03.gray"},
-				{"00002521_N_345x544_500_00_03_09.gray",
-				    "00002541_S_256x470_500_00_03_09.gray"},
-				{"00002541_N_313x513_500_00_03_03.gray",
-				    "00002495_S_336x493_500_00_03_03.gray"},
-				{"00002551_N_268x449_500_00_03_03.gray",
-				    "00002502_N_258x332_500_00_03_03.gray"},
-				{"00002504_S_284x456_500_00_03_07.gray",
-				    "00002488_N_316x459_500_00_03_07.gray"},
-				{"00002483_S_256x397_500_00_03_07.gray",
-				    "00002561_S_260x379_500_00_03_07.gray"},
-				{"00002533_N_296x433_500_00_03_03.gray",
-				    "00002551_N_268x449_500_00_03_03.gray"},
-				{"00002550_N_256x462_500_00_03_08.gray",
-				    "00002534_N_256x412_500_00_03_08.gray"},
-				{"00002574_N_299x480_500_00_03_03.gray",
-				    "00002555_N_303x433_500_00_03_03.gray"},
-				{"00002433_S_303x480_500_00_03_02.gray",
-				    "00002515_S_256x419_500_00_03_02.gray"},
-				{"00002571_N_302x477_500_00_03_04.gray",
-				    "00002445_A_512x512_500_41_05_04.gray"},
-				{"00002535_S_277x464_500_00_03_07.gray",
-				    "00002542_S_256x425_500_00_03_07.gray"},
-				{"00002504_N_282x461_500_00_03_04.gray",
-				    "00002435_S_256x357_500_00_03_04.gray"},
-				{"00002495_S_291x455_500_00_03_08.gray",
-				    "00002555_S_256x468_500_00_03_08.gray"},
-				{"00002541_S_277x472_500_00_03_02.gray",
-				    "00002556_S_256x346_500_00_03_02.gray"},
-				{"00002475_N_296x432_500_00_03_08.gray",
-				    "00002521_S_310x552_500_00_03_08.gray"},
-				{"00002458_M_256x360_500_00_09_02.gray",
-				    "00002483_N_272x445_500_00_03_02.gray"},
-				{"00002448_A_512x512_500_41_05_09.gray",
-				    "00002523_N_346x370_500_00_03_09.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "00002475_N_316x374_500_00_03_02.gray"},
-				{"00002504_N_282x461_500_00_03_04.gray",
-				    "00002497_N_265x276_500_00_03_04.gray"},
-				{"00002579_N_336x452_500_00_03_03.gray",
-				    "00002561_N_316x402_500_00_03_03.gray"},
-				{"00002483_S_256x374_500_00_03_03.gray",
-				    "00002480_S_288x459_500_00_03_03.gray"},
-				{"00002480_N_295x429_500_00_03_08.gray",
-				    "00002500_N_256x400_500_00_03_08.gray"},
-				{"00002500_S_256x394_500_00_03_07.gray",
-				    "00002541_N_259x447_500_00_03_07.gray"},
-				{"00002502_S_256x379_500_00_03_07.gray",
-				    "00002475_N_312x388_500_00_03_07.gray"},
-				{"00002457_A_512x512_500_41_05_08.gray",
-				    "00002502_S_256x402_500_00_03_08.gray"},
-				{"00002546_S_256x385_500_00_03_09.gray",
-				    "00002534_S_256x418_500_00_03_09.gray"},
-				{"00002547_N_299x452_500_00_03_08.gray",
-				    "00002515_N_256x427_500_00_03_08.gray"},
-				{"00002578_S_256x446_500_00_03_03.gray",
-				    "00002560_S_258x408_500_00_03_03.gray"},
-				{"00002537_N_279x392_500_00_03_07.gray",
-				    "00002561_S_260x379_500_00_03_07.gray"},
-				{"00002574_S_256x470_500_00_03_09.gray",
-				    "00002578_N_266x408_500_00_03_09.gray"},
-				{"00002488_N_365x494_500_00_03_02.gray",
-				    "00002515_S_256x419_500_00_03_02.gray"},
-				{"00002551_N_268x449_500_00_03_03.gray",
-				    "00002515_N_256x486_500_00_03_03.gray"},
-				{"00002497_S_284x386_500_00_03_03.gray",
-				    "00002533_N_296x433_500_00_03_03.gray"},
-				{"00002571_N_317x501_500_00_03_09.gray",
-				    "00002458_N_273x484_500_00_03_09.gray"},
-				{"00002531_S_256x374_500_00_03_03.gray",
-				    "00002502_N_258x332_500_00_03_03.gray"},
-				{"00002521_N_382x516_500_00_03_04.gray",
-				    "00002558_N_348x559_500_00_03_04.gray"},
-				{"00002531_S_261x420_500_00_03_09.gray",
-				    "00002535_S_290x444_500_00_03_09.gray"},
-				{"00002551_N_277x425_500_00_03_08.gray",
-				    "00002433_A_512x512_500_41_05_08.gray"},
-				{"00002541_N_304x508_500_00_03_04.gray",
-				    "00002478_N_308x478_500_00_03_04.gray"},
-				{"00002574_S_256x444_500_00_03_02.gray",
-				    "00002515_S_256x419_500_00_03_02.gray"},
-				{"00002521_S_309x503_500_00_03_07.gray",
-				    "00002551_S_257x402_500_00_03_07.gray"},
-				{"00002497_S_293x420_500_00_03_07.gray",
-				    "00002547_N_256x474_500_00_03_07.gray"},
-				{"00002542_N_303x442_500_00_03_08.gray",
-				    "00002478_N_256x482_500_00_03_08.gray"},
-				{"00002521_S_309x503_500_00_03_07.gray",
-				    "00002551_N_273x411_500_00_03_07.gray"},
-				{"00002434_S_264x407_500_00_03_03.gray",
-				    "00002445_S_265x477_500_00_03_03.gray"},
-				{"00002574_N_256x466_500_00_03_09.gray",
-				    "00002478_N_277x463_500_00_03_09.gray"},
-				{"00002502_N_258x332_500_00_03_03.gray",
-				    "00002456_U_1600x1500_1000_01_03_03.gray"},
-				{"00002546_N_309x489_500_00_03_04.gray",
-				    "00002500_N_287x420_500_00_03_04.gray"},
-				{"00002505_N_366x482_500_00_03_03.gray",
-				    "00002439_N_330x381_500_00_03_03.gray"},
-				{"00002531_S_256x374_500_00_03_03.gray",
-				    "00002472_S_256x344_500_00_03_03.gray"},
-				{"00002533_S_256x329_500_00_03_08.gray",
-				    "00002484_S_256x352_500_00_03_08.gray"},
-				{"00002433_A_512x512_500_41_05_08.gray",
-				    "00002531_S_269x402_500_00_03_08.gray"},
-				{"00002484_S_256x337_500_00_03_09.gray",
-				    "00002449_M_256x360_500_00_09_09.gray"},
-				{"00002504_N_282x461_500_00_03_04.gray",
-				    "00002502_S_256x378_500_00_03_04.gray"},
-				{"00002579_N_329x433_500_00_03_04.gray",
-				    "00002558_S_267x490_500_00_03_04.gray"},
-				{"00002546_N_294x441_500_00_03_02.gray",
-				    "00002579_N_315x419_500_00_03_02.gray"},
-				{"00002516_N_266x469_500_00_03_02.gray",
-				    "00002497_S_293x414_500_00_03_02.gray"},
-				{"00002550_N_294x522_500_00_03_02.gray",
-				    "00002555_S_256x414_500_00_03_02.gray"},
-				{"00002547_S_256x478_500_00_03_09.gray",
-				    "00002505_S_301x463_500_00_03_09.gray"},
-				{"00002484_S_273x386_500_00_03_04.gray",
-				    "00002433_A_512x512_500_41_05_04.gray"},
-				{"00002516_N_266x469_500_00_03_02.gray",
-				    "00002556_S_256x346_500_00_03_02.gray"},
-				{"00002555_S_256x413_500_00_03_03.gray",
-				    "00002458_A_512x512_500_41_05_03.gray"},
-				{"00002579_N_296x438_500_00_03_07.gray",
-				    "00002435_M_256x360_500_00_09_07.gray"},
-				{"00002547_S_256x428_500_00_03_07.gray",
-				    "00002497_S_293x420_500_00_03_07.gray"},
-				{"00002551_N_281x405_500_00_03_02.gray",
-				    "00002458_M_256x360_500_00_09_02.gray"},
-				{"00002535_S_286x455_500_00_03_08.gray",
-				    "00002551_N_277x425_500_00_03_08.gray"},
-				{"00002558_N_298x489_500_00_03_03.gray",
-				    "00002547_N_278x430_500_00_03_03.gray"},
-				{"00002551_S_256x425_500_00_03_09.gray",
-				    "00002555_N_256x438_500_00_03_09.gray"},
-				{"00002439_A_512x512_500_41_05_04.gray",
-				    "00002555_S_256x474_500_00_03_04.gray"},
-				{"00002541_N_258x492_500_00_03_09.gray",
-				    "00002547_S_256x478_500_00_03_09.gray"},
-				{"00002578_N_256x435_500_00_03_08.gray",
-				    "00002561_S_257x411_500_00_03_08.gray"},
-				{"00002484_N_266x361_500_00_03_08.gray",
-				    "00002541_N_283x453_500_00_03_08.gray"},
-				{"00002484_N_284x350_500_00_03_03.gray",
-				    "00002533_N_296x433_500_00_03_03.gray"},
-				{"00002533_N_319x439_500_00_03_02.gray",
-				    "00002579_S_99x99_500_00_03_02.gray"},
-				{"00002521_S_313x524_500_00_03_03.gray",
-				    "00002542_S_256x429_500_00_03_03.gray"},
-				{"00002478_S_256x405_500_00_03_04.gray",
-				    "00002531_N_269x430_500_00_03_04.gray"},
-				{"00002484_N_266x361_500_00_03_08.gray",
-				    "00002547_S_258x460_500_00_03_08.gray"},
-				{"00002466_N_290x427_500_00_03_02.gray",
-				    "00002516_S_267x435_500_00_03_02.gray"},
-				{"00002560_N_306x484_500_00_03_03.gray",
-				    "00002531_N_256x368_500_00_03_03.gray"},
-				{"00002574_S_257x416_500_00_03_07.gray",
-				    "00002569_S_267x411_500_00_03_07.gray"},
-				{"00002475_N_296x432_500_00_03_08.gray",
-				    "00002433_A_512x512_500_41_05_08.gray"},
-				{"00002541_N_302x485_500_00_03_02.gray",
-				    "00002445_A_512x512_500_41_05_02.gray"},
-				{"00002523_N_262x372_500_00_03_03.gray",
-				    "00002556_S_256x373_500_00_03_03.gray"},
-				{"00002458_S_256x437_500_00_03_09.gray",
-				    "00002531_S_261x420_500_00_03_09.gray"},
-				{"00002448_N_256x397_500_00_03_03.gray",
-				    "00002433_M_256x360_500_00_09_03.gray"},
-				{"00002445_U_1600x1500_1000_01_03_07.gray",
-				    "00002500_N_256x373_500_00_03_07.gray"},
-				{"00002475_S_281x408_500_00_03_02.gray",
-				    "00002556_S_256x346_500_00_03_02.gray"},
-				{"00002472_S_256x322_500_00_03_02.gray",
-				    "00002488_N_365x494_500_00_03_02.gray"},
-				{"00002439_U_1600x1500_1000_01_03_07.gray",
-				    "00002504_N_320x470_500_00_03_07.gray"},
-				{"00002556_N_260x460_500_00_03_09.gray",
-				    "00002505_N_288x440_500_00_03_09.gray"},
-				{"00002497_N_280x412_500_00_03_08.gray",
-				    "00002537_S_256x367_500_00_03_08.gray"},
-				{"00002561_N_319x391_500_00_03_02.gray",
-				    "00002556_N_266x437_500_00_03_02.gray"},
-				{"00002495_S_271x435_500_00_03_02.gray",
-				    "00002579_S_99x99_500_00_03_02.gray"},
-				{"00002555_N_256x427_500_00_03_02.gray",
-				    "00002537_N_315x399_500_00_03_02.gray"},
-				{"00002546_N_256x423_500_00_03_07.gray",
-				    "00002504_N_320x470_500_00_03_07.gray"},
-				{"00002433_A_512x512_500_41_05_01.gray",
-				    "00002458_U_1600x1500_1000_01_03_01.gray"},
-				{"00002561_S_256x384_500_00_03_09.gray",
-				    "00002550_S_256x401_500_00_03_09.gray"},
-				{"00002466_N_277x477_500_00_03_09.gray",
-				    "00002541_N_258x492_500_00_03_09.gray"},
-				{"00002434_M_256x360_500_00_09_04.gray",
-				    "00002533_S_256x444_500_00_03_04.gray"},
-				{"00002547_N_299x452_500_00_03_08.gray",
-				    "00002475_S_256x411_500_00_03_08.gray"},
-				{"00002500_S_256x409_500_00_03_03.gray",
-				    "00002504_S_289x435_500_00_03_03.gray"},
-				{"00002556_S_256x380_500_00_03_08.gray",
-				    "00002550_N_256x462_500_00_03_08.gray"},
-				{"00002547_S_266x483_500_00_03_03.gray",
-				    "00002534_S_256x352_500_00_03_03.gray"},
-				{"00002531_N_256x368_500_00_03_03.gray",
-				    "00002478_N_324x471_500_00_03_03.gray"},
-				{"00002448_U_1600x1500_1000_01_03_08.gray",
-				    "00002560_N_263x432_500_00_03_08.gray"},
-				{"00002551_S_256x450_500_00_03_08.gray",
-				    "00002439_A_512x512_500_41_05_08.gray"},
-				{"00002466_S_258x445_500_00_03_08.gray",
-				    "00002439_A_512x512_500_41_05_08.gray"},
-				{"00002488_S_296x461_500_00_03_04.gray",
-				    "00002449_A_512x512_500_41_05_04.gray"},
-				{"00002556_N_263x414_500_00_03_07.gray",
-				    "00002435_M_256x360_500_00_09_07.gray"},
-				{"00002483_N_256x441_500_00_03_09.gray",
-				    "00002488_S_276x476_500_00_03_09.gray"},
-				{"00002456_M_256x360_500_00_09_07.gray",
-				    "00002448_N_297x402_500_00_03_07.gray"},
-				{"00002521_S_313x524_500_00_03_03.gray",
-				    "00002502_S_256x376_500_00_03_03.gray"},
-				{"00002434_A_512x512_500_41_05_08.gray",
-				    "00002435_A_512x512_500_41_05_08.gray"},
-				{"00002546_N_256x450_500_00_03_08.gray",
-				    "00002531_N_271x360_500_00_03_08.gray"},
-				{"00002488_N_365x494_500_00_03_02.gray",
-				    "00002457_N_287x423_500_00_03_02.gray"},
-				{"00002535_N_302x468_500_00_03_04.gray",
-				    "00002556_S_256x432_500_00_03_04.gray"},
-				{"00002480_N_334x463_500_00_03_02.gray",
-				    "00002466_N_290x427_500_00_03_02.gray"},
-
+				{7, 6},
+				{343, 755},
+				{509, 582},
+				{211, 217},
+				{707, 308},
+				{331, 384},
+				{453, 857},
+				{665, 341},
+				{873, 365},
+				{720, 309},
+				{445, 818},
+				{539, 892},
+				{894, 673},
+				{48, 366},
+				{588, 251},
+				{323, 875},
+				{833, 67},
+				{390, 454},
+				{643, 164},
+				{28, 353},
+				{669, 439},
+				{183, 46},
+				{595, 514},
+				{632, 773},
+				{735, 880},
+				{56, 606},
+				{726, 317},
+				{189, 487},
+				{532, 320},
+				{23, 248},
+				{218, 597},
+				{131, 61},
+				{854, 515},
+				{11, 607},
+				{553, 437},
+				{890, 743},
+				{93, 332},
+				{69, 863},
+				{340, 732},
+				{84, 727},
+				{840, 12},
+				/* Same image */
+				{5, 5},
+				{201, 201},
+				{676, 676},
+				{497, 497},
+				{791, 791},
+				{224, 224},
+				{258, 258},
+				{575, 575},
+				{159, 159},
+				{365, 365},
+				{720, 720},
+				{121, 121},
+				{668, 668},
+				{58, 58},
+				{380, 380},
+				{734, 734},
+				{323, 323},
+				{868, 868},
+				{783, 783},
+				{736, 736},
+				{136, 136},
+				{653, 653},
+				{122, 122},
+				{46, 46},
+				{807, 807},
+				{368, 368},
+				{34, 34},
+				{880, 880},
+				{552, 552},
+				{179, 179},
+				{88, 88},
+				{385, 385},
+				{320, 320},
+				{345, 345},
+				{832, 832},
+				{197, 197},
+				{131, 131},
+				{395, 395},
+				{854, 854},
+				{280, 280},
+				{805, 805},
+				{625, 625},
+				{170, 170},
+				{701, 701},
+				{785, 785},
+				{74, 74},
+				{98, 98},
+				{571, 571},
+				{840, 840},
+				{585, 585},
+				/* Nonmated */
+				{5, 779},
+				{779, 888},
+				{391, 194},
+				{853, 724},
+				{677, 883},
+				{722, 751},
+				{888, 651},
+				{783, 519},
+				{303, 15},
+				{665, 573},
+				{837, 662},
+				{435, 323},
+				{833, 327},
+				{514, 330},
+				{246, 435},
+				{249, 222},
+				{468, 553},
+				{721, 712},
+				{485, 632},
+				{181, 448},
+				{807, 634},
+				{471, 732},
+				{548, 756},
+				{433, 247},
+				{698, 212},
+				{363, 733},
+				{431, 877},
+				{355, 677},
+				{615, 387},
+				{876, 205},
+				{783, 115},
+				{626, 688},
+				{751, 9},
+				{541, 96},
+				{571, 275},
+				{169, 575},
+				{295, 558},
+				{232, 190},
+				{625, 320},
+				{710, 344},
+				{195, 295},
+				{642, 459},
+				{287, 775},
+				{349, 838},
+				{614, 718},
+				{251, 355},
+				{753, 449},
+				{61, 785},
+				{133, 900},
+				{679, 162},
+				{900, 853},
+				{74, 93},
+				{701, 733},
+				{519, 35},
+				{887, 881},
+				{895, 585},
+				{578, 171},
+				{321, 370},
+				{680, 704},
+				{83, 93},
+				{867, 218},
+				{9, 523},
+				{893, 145},
+				{754, 15},
+				{142, 849},
+				{851, 213},
+				{185, 809},
+				{683, 118},
+				{667, 477},
+				{355, 798},
+				{39, 78},
+				{597, 665},
+				{711, 837},
+				{536, 257},
+				{477, 489},
+				{701, 275},
+				{833, 801},
+				{256, 322},
+				{43, 130},
+				{287, 561},
+				{565, 201},
+				{478, 49},
+				{665, 471},
+				{190, 453},
+				{303, 329},
+				{626, 513},
+				{132, 797},
+				{385, 898},
+				{9, 333},
+				{51, 142},
+				{386, 147},
+				{407, 81},
+				{143, 709},
+				{79, 533},
+				{408, 806},
+				{206, 239},
+				{29, 845},
+				{329, 574},
+				{275, 892},
+				{824, 887},
+				{749, 652},
+				{722, 588},
+				{193, 367},
+				{143, 233},
+				{55, 159},
+				{785, 854},
+				{306, 835},
+				{710, 578},
+				{190, 526},
+				{821, 673},
+				{31, 871},
+				{246, 784},
+				{442, 159},
+				{715, 682},
+				{312, 661},
+				{627, 441},
+				{552, 614},
+				{478, 565},
+				{108, 529},
+				{780, 33},
+				{562, 230},
+				{551, 249},
+				{299, 431},
+				{380, 193},
+				{456, 39},
+				{34, 185},
+				{119, 38},
+				{373, 866},
+				{736, 501},
+				{268, 74},
+				{456, 211},
+				{811, 167},
+				{361, 558},
+				{647, 856},
+				{841, 35},
+				{369, 425},
+				{827, 382},
+				{212, 442},
+				{624, 863},
+				{502, 219},
+				{120, 728},
+				{693, 131},
+				{29, 88},
+				{882, 419},
+				{752, 246},
+				{786, 459},
+				{648, 894},
+				{23, 306},
+				{225, 115},
+				{658, 605},
+				{589, 637},
+				{197, 324},
+				{249, 432},
+				{432, 502},
+				{224, 815},
+				{834, 785},
+				{681, 842},
+				{192, 120},
+				{456, 335},
+				{367, 586},
+				{157, 757},
+				{585, 67},
+				{626, 523},
+				{121, 668},
+				{875, 478},
+				{607, 751},
+				{716, 872},
+				{13, 302},
+				{611, 797},
+				{158, 172},
+				{578, 248},
+				{268, 21},
+				{848, 382},
+				{641, 494},
+				{382, 827},
+				{223, 158},
+				{471, 293},
+				{729, 83},
+				{688, 626},
+				{146, 780},
+				{486, 687},
+				{32, 300},
+				{688, 479},
+				{715, 753},
+				{155, 179},
+				{367, 45},
+				{372, 790},
+				{899, 43},
+				{96, 758},
+				{394, 429},
+				{275, 461},
+				{13, 616},
+				{871, 468},
+				{295, 159},
+				{384, 795},
+				{863, 414},
+				{879, 698},
+				{360, 316},
+				{36, 121},
+				{442, 348},
+				{39, 204},
+				{551, 613},
+				{109, 452},
+				{851, 693},
+				{25, 23},
+				{246, 142},
+				{310, 358},
+				{135, 476},
+				{506, 620},
+				{822, 301},
+				{739, 830},
+				{133, 421},
+				{684, 734},
+				{213, 841},
+				{370, 421},
+				{863, 464},
+				{522, 748},
+				{205, 282},
+				{377, 178},
+				{691, 251},
+				{704, 205},
+				{306, 295},
+				{658, 849},
+				{282, 70},
+				{565, 217},
+				{398, 135},
+				{136, 329},
+				{248, 694},
+				{602, 773},
+				{673, 79},
+				{373, 714},
+				{719, 55},
+				{489, 549},
+				{890, 184},
+				{808, 364},
+				{225, 902},
+				{243, 319},
+				{345, 245},
+				{303, 354},
+				{829, 288},
+				{597, 113},
+				{293, 193},
+				{823, 372},
+				{319, 718},
+				{517, 185},
+				{232, 343},
+				{24, 501},
+				{165, 445},
+				{830, 781},
+				{118, 212},
+				{458, 671},
+				{759, 292},
+				{147, 223},
+				{108, 833},
+				{871, 553},
+				{736, 469},
+				{743, 504},
+				{47, 126},
+				{555, 23},
+				{9, 349},
+				{643, 345},
+				{445, 315},
+				{164, 600},
+				{473, 193},
+				{315, 194},
+				{539, 545},
+				{367, 665},
+				{548, 310},
+				{794, 23},
+				{329, 268},
+				{78, 62},
+				{460, 389},
+				{90, 388},
+				{454, 271},
+				{701, 162},
+				{804, 674},
+				{218, 887},
+				{295, 698},
+				{711, 612},
+				{645, 388},
+				{131, 265},
+				{437, 395},
+				{605, 98},
+				{101, 899},
+				{676, 642},
+				{36, 679},
+				{767, 78},
+				{158, 533},
+				{432, 150},
+				{853, 309},
+				{350, 675},
+				{371, 218},
+				{559, 804},
+				{616, 688},
+				{831, 429},
+				{103, 291},
+				{788, 34},
+				{476, 771},
+				{244, 325},
+				{864, 448},
+				{840, 720},
+				{541, 807},
+				{550, 340},
+				{42, 481},
+				{643, 175},
+				{816, 718},
+				{180, 229},
+				{414, 388},
+				{235, 35},
+				{628, 550},
+				{838, 523},
+				{78, 656},
+				{845, 738},
+				{899, 366},
+				{849, 846},
+				{360, 699},
+				{357, 212},
+				{251, 797},
+				{830, 102},
+				{280, 877},
+				{894, 742},
+				{232, 238},
+				{734, 130},
+				{849, 515},
+				{353, 159},
+				{520, 209},
+				{501, 483},
+				{574, 651},
+				{229, 119},
+				{392, 780},
+				{111, 785},
+				{401, 430},
+				{631, 167},
+				{192, 42},
+				{556, 646},
+				{693, 752},
+				{522, 729},
+				{876, 811},
+				{788, 806},
+				{159, 606},
+				{177, 719},
+				{138, 122},
+				{371, 108},
+				{694, 586},
+				{678, 130},
+				{715, 550},
+				{213, 525},
+				{295, 306},
+				{355, 263},
+				{266, 46},
+				{670, 366},
+				{881, 625},
+				{159, 716},
+				{898, 759},
+				{395, 437},
+				{24, 469},
+				{332, 29},
+				{92, 581},
+				{379, 614},
+				{192, 293},
+				{338, 348},
+				{740, 860},
+				{628, 838},
+				{774, 827},
+				{544, 763},
+				{48, 484},
+				{39, 196},
+				{711, 773},
+				{78, 795},
+				{58, 585},
+				{851, 846},
+				{274, 631},
+				{69, 784},
+				{673, 834},
+				{574, 420},
+				{234, 15},
+				{484, 437},
+				{333, 162},
+				{338, 541},
+				{340, 844},
+				{657, 736},
+				{435, 15},
+				{776, 862},
+				{614, 379},
+				{48, 100},
+				{797, 462},
+				{392, 273},
+				{468, 830},
+				{525, 519},
+				{306, 690},
+				{408, 795},
+				{238, 745},
+				{310, 384},
+				{613, 222},
+				{708, 234},
+				{265, 460},
+				{247, 419},
+				{729, 444},
+				{78, 773},
+				{225, 888},
+				{437, 597},
+				{278, 677},
+				{691, 66},
+				{300, 308},
+				{637, 868},
+				{578, 132},
+				{670, 325},
+				{127, 329},
+				{798, 797},
+				{704, 197},
+				{218, 315},
+				{808, 892},
+				{473, 395},
+				{774, 18},
+				{227, 329},
+				{873, 50},
+				{797, 248},
+				{687, 780},
+				{120, 852},
+				{584, 284},
+				{405, 865},
+				{34, 44},
+				{626, 289},
+				{532, 504},
+				{891, 323},
+				{570, 213},
+				{727, 263},
+				{244, 338},
+				{41, 249},
+				{564, 142},
+				{141, 95},
+				{543, 36},
+				{333, 821},
+				{658, 303},
+				{645, 391},
+				{607, 671},
+				{142, 83},
+				{339, 51},
+				{261, 532},
+				{13, 458},
+				{483, 651},
+				{280, 687},
+				{240, 431},
+				{240, 432},
+				{518, 668},
+				{720, 511},
+				{679, 170},
+				{823, 809},
+				{851, 708},
+				{710, 454},
+				{670, 212},
+				{611, 661},
+				{801, 296},
+				{119, 42},
+				{43, 539},
+				{651, 591},
+				{46, 858},
+				{760, 839},
+				{258, 76},
+				{561, 746},
+				{800, 349},
+				{510, 852},
+				{720, 517},
+				{572, 795},
+				{351, 506},
+				{853, 713},
+				{382, 568},
+				{730, 194},
+				{887, 502},
+				{129, 298},
+				{526, 855},
+				{811, 335},
+				{69, 646},
+				{15, 888},
+				{234, 12},
+				{133, 426},
+				{477, 216},
+				{456, 274},
+				{414, 216},
+				{765, 838},
+				{34, 197},
+				{82, 334},
+				{29, 402},
+				{439, 865},
+				{868, 875},
+				{454, 11},
+				{547, 892},
+				{639, 849},
+				{434, 860},
+				{223, 111},
+				{461, 129},
+				{797, 125},
+				{331, 828},
+				{401, 778},
+				{679, 172},
+				{766, 594},
+				{830, 57},
+				{763, 331},
+				{162, 626},
+				{701, 668},
+				{877, 864},
+				{840, 26},
+				{132, 836},
+				{523, 679},
+				{281, 444},
+				{649, 493},
+				{664, 212},
+				{49, 52},
+				{466, 282},
+				{805, 477},
+				{877, 146},
+				{811, 422},
+				{18, 419},
+				{722, 616},
+				{372, 369},
+				{68, 668},
+				{213, 157},
+				{471, 850},
+				{860, 629},
+				{293, 119},
+				{98, 884},
+				{765, 333},
+				{864, 391},
+				{753, 183},
+				{141, 855},
+				{309, 388},
+				{692, 549},
+				{260, 196},
+				{757, 525},
+				{21, 136},
+				{789, 184},
+				{333, 832},
+				{489, 153},
+				{140, 510},
+				{164, 725},
+				{81, 53},
+				{760, 532},
+				{539, 472},
+				{55, 882},
+				{516, 399},
+				{319, 130},
+				{628, 607},
+				{526, 33},
+				{840, 456},
+				{104, 159},
+				{548, 720},
+				{502, 250},
+				{883, 336},
+				{903, 811},
+				{671, 170},
+				{651, 51},
+				{706, 194},
+				{671, 607},
+				{136, 74},
+				{738, 589},
+				{126, 444},
+				{179, 845},
+				{639, 69},
+				{718, 212},
+				{439, 344},
+				{539, 684},
+				{551, 417},
+				{701, 626},
+				{437, 559},
+				{689, 64},
+				{710, 171},
+				{863, 824},
+				{424, 541},
+				{615, 528},
+				{483, 469},
+				{684, 442},
+				{88, 559},
+				{780, 746},
+				{887, 108},
+				{701, 82},
+				{553, 879},
+				{402, 578},
+				{243, 393},
+				{435, 234},
+				{504, 839},
+				{778, 34},
+				{261, 425},
+				{164, 471},
+				{90, 453},
+				{191, 29},
+				{310, 707},
+				{657, 646},
+				{677, 565},
+				{301, 331},
+				{541, 295},
+				{178, 858},
+				{882, 247},
+				{373, 280},
+				{232, 262},
+				{142, 566},
+				{713, 95},
+				{752, 525},
+				{698, 716},
+				{16, 288},
+				{863, 146},
+				{353, 118},
+				{575, 121},
+				{159, 830},
+				{387, 399},
+				{729, 522},
+				{478, 439},
+				{515, 754},
+				{847, 883},
+				{607, 121},
+				{899, 871},
+				{813, 180},
+				{341, 512},
+				{43, 468},
+				{292, 255},
+				{677, 192},
+				{858, 377},
+				{765, 162},
+				{847, 813},
+				{823, 196},
+				{240, 28},
+				{285, 515},
+				{185, 408},
+				{175, 223},
+				{371, 801},
+				{398, 345},
+				{490, 532},
+				{64, 70},
+				{759, 750},
+				{868, 42},
+				{119, 798},
+				{213, 515},
+				{828, 586},
+				{257, 54},
+				{517, 731},
+				{662, 62},
+				{511, 335},
+				{389, 145},
+				{632, 55},
+				{881, 240},
+				{287, 272},
+				{288, 654},
+				{824, 391},
+				{314, 614},
+				{11, 799},
+				{297, 219},
+				{165, 502},
+				{642, 648},
+				{469, 329},
+				{529, 561},
+				{522, 884},
+				{826, 761},
+				{169, 158},
+				{738, 402},
+				{43, 151},
+				{325, 632},
+				{307, 187},
+				{408, 554},
+				{864, 713},
+				{561, 146},
+				{638, 825},
+				{709, 274},
+				{519, 435},
+				{818, 757},
+				{207, 154},
+				{832, 740},
+				{339, 657},
+				{48, 732},
+				{716, 18},
+				{210, 840},
+				{301, 484},
+				{90, 775},
+				{482, 504},
+				{669, 69},
+				{108, 746},
+				{211, 46},
+				{76, 851},
+				{650, 702},
+				{888, 142},
+				{64, 482},
+				{289, 751},
+				{19, 501},
+				{341, 466},
+				{309, 270},
+				{268, 420},
+				{637, 620},
+				{391, 110},
+				{90, 477},
+				{90, 498},
+				{529, 864},
+				{234, 646},
+				{669, 98},
+				{537, 26},
+				{519, 779},
+				{403, 28},
+				{452, 630},
+				{249, 108},
+				{115, 779},
+				{868, 481},
+				{355, 171},
+				{547, 61},
+				{872, 558},
+				{668, 360},
+				{533, 36},
+				{357, 764},
+				{798, 193},
+				{568, 257},
+				{720, 81},
+				{354, 783},
+				{702, 679},
+				{159, 690},
+				{118, 758},
+				{694, 42},
+				{600, 351},
+				{893, 669},
+				{662, 384},
+				{211, 375},
+				{662, 459},
+				{613, 792},
+				{597, 845},
+				{35, 131},
+				{783, 136},
+				{604, 632},
+				{511, 504},
+				{632, 774},
+				{303, 826},
+				{82, 10},
+				{898, 31},
+				{741, 492},
+				{23, 393},
+				{741, 414},
+				{414, 146},
+				{522, 51},
+				{12, 851},
+				{511, 304},
+				{628, 129},
+				{790, 178},
+				{46, 64},
+				{315, 864},
+				{526, 299},
+				{46, 390},
+				{206, 179},
+				{178, 840},
+				{33, 388},
+				{103, 403},
+				{247, 698},
+				{897, 415},
+				{301, 565},
+				{667, 110},
+				{394, 553},
+				{729, 93},
+				{847, 351},
+				{192, 725},
+				{275, 513},
+				{181, 150},
+				{517, 711},
+				{763, 573},
+				{833, 492},
+				{669, 501},
+				{424, 485},
+				{856, 750},
+				{240, 141},
+				{398, 13},
+				{849, 655},
+				{323, 902},
+				{380, 620},
+				{743, 786},
+				{195, 385},
+				{866, 165},
+				{864, 256},
+				{507, 286},
+				{293, 597},
+				{251, 191},
+				{321, 287},
+				{345, 702},
+				{820, 426},
+				{830, 594},
+				{424, 632},
+				{532, 139},
+				{541, 244},
+				{771, 550},
+				{344, 691},
+				{82, 513},
+				{532, 318},
+				{691, 293},
+				{778, 704},
+				{185, 482},
+				{141, 146},
+				{775, 477},
+				{456, 185},
+				{761, 281},
+				{809, 790},
+				{753, 643},
+				{670, 540},
+				{824, 90},
+				{871, 536},
+				{501, 891},
+				{722, 854},
+				{127, 15},
+				{415, 679},
+				{356, 437},
+				{616, 547},
+				{871, 159},
+				{310, 39},
+				{662, 731},
+				{362, 145},
+				{300, 863},
+				{687, 320},
+				{655, 74},
+				{11, 367},
+				{779, 136},
+				{894, 786},
+				{561, 477},
+				{637, 191},
+				{68, 643},
+				{185, 64},
+				{837, 456},
+				{845, 278},
+				{261, 482},
+				{899, 895},
+				{122, 677},
+				{657, 520},
+				{719, 151},
+				{808, 643},
+				{388, 296},
+				{613, 724},
+				{187, 339},
+				{388, 238},
+				{590, 304},
+				{600, 661},
+				{482, 70},
+				{96, 43},
+				{504, 885},
+				{261, 211},
+				{354, 846},
+				{520, 669},
+				{395, 413},
+				{871, 568},
+				{366, 716},
+				{607, 533},
+				{147, 733},
+				{615, 668},
+				{206, 763},
+				{195, 735},
+				{147, 854},
+				{204, 767},
+				{133, 368},
+				{421, 613},
+				{36, 415},
+				{574, 657},
+				{642, 46},
+				{565, 804},
+				{385, 539},
+				{29, 206},
+				{227, 35},
+				{285, 841},
+				{143, 456},
+				{751, 316},
+				{511, 266},
+				{632, 879},
+				{285, 235},
+				{224, 398},
+				{44, 788},
+				{445, 887},
+				{127, 520},
+				{785, 200},
+				{408, 78},
+				{822, 122},
+				{876, 260},
+				{308, 502},
+				{37, 854},
+				{427, 68},
+				{583, 881},
+				{462, 727},
+				{861, 564},
+				{275, 162},
+				{543, 316},
+				{892, 860},
+				{805, 881},
+				{436, 630},
+				{674, 883},
+				{813, 29},
+				{787, 807},
+				{779, 307},
+				{318, 840},
+				{752, 761},
+				{839, 422},
+				{788, 773},
+				{566, 849},
+				{323, 641},
+				{225, 641},
+				{585, 91},
+				{250, 368},
+				{248, 402},
+				{714, 287},
+				{511, 811},
+				{570, 584},
+				{303, 658},
+				{68, 17},
+				{379, 433},
+				{832, 224},
 				/* Variable resolution */
-				{"00002458_U_400x375_250_01_03_10.gray",
-				    "00002458_U_160x150_100_01_03_10.gray"},
-				{"00002458_U_480x450_300_01_03_10.gray",
-				    "00002458_U_160x150_100_01_03_10.gray"},
-				{"00002458_U_533x500_333_01_03_10.gray",
-				    "00002458_U_160x150_100_01_03_10.gray"},
-				{"00002458_U_960x900_600_01_03_10.gray",
-				    "00002458_U_160x150_100_01_03_10.gray"},
-				{"00002458_U_1600x1500_1000_01_03_10.gray",
-				    "00002458_U_160x150_100_01_03_10.gray"},
-
-				{"00002458_U_160x150_100_01_03_10.gray",
-				    "00002458_U_1600x1500_1000_01_03_10.gray"},
-				{"00002458_U_400x375_250_01_03_10.gray",
-				    "00002458_U_1600x1500_1000_01_03_10.gray"},
-				{"00002458_U_480x450_300_01_03_10.gray",
-				    "00002458_U_1600x1500_1000_01_03_10.gray"},
-				{"00002458_U_533x500_333_01_03_10.gray",
-				    "00002458_U_1600x1500_1000_01_03_10.gray"},
-				{"00002458_U_960x900_600_01_03_10.gray",
-				    "00002458_U_1600x1500_1000_01_03_10.gray"},
-
-				{"00002458_U_160x150_100_01_03_10.gray",
-				    "00002458_U_400x375_250_01_03_10.gray"},
-				{"00002458_U_1600x1500_1000_01_03_10.gray",
-				    "00002458_U_400x375_250_01_03_10.gray"},
-				{"00002458_U_480x450_300_01_03_10.gray",
-				    "00002458_U_400x375_250_01_03_10.gray"},
-				{"00002458_U_533x500_333_01_03_10.gray",
-				    "00002458_U_400x375_250_01_03_10.gray"},
-				{"00002458_U_960x900_600_01_03_10.gray",
-				    "00002458_U_400x375_250_01_03_10.gray"},
-
-				{"00002458_U_160x150_100_01_03_10.gray",
-				    "00002458_U_480x450_300_01_03_10.gray"},
-				{"00002458_U_400x375_250_01_03_10.gray",
-				    "00002458_U_480x450_300_01_03_10.gray"},
-				{"00002458_U_480x450_300_01_03_10.gray",
-				    "00002458_U_480x450_300_01_03_10.gray"},
-				{"00002458_U_960x900_600_01_03_10.gray",
-				    "00002458_U_480x450_300_01_03_10.gray"},
-				{"00002458_U_1600x1500_1000_01_03_10.gray",
-				    "00002458_U_480x450_300_01_03_10.gray"},
-
-				{"00002458_U_160x150_100_01_03_10.gray",
-				    "00002458_U_533x500_333_01_03_10.gray"},
-				{"00002458_U_400x375_250_01_03_10.gray",
-				    "00002458_U_533x500_333_01_03_10.gray"},
-				{"00002458_U_480x450_300_01_03_10.gray",
-				    "00002458_U_533x500_333_01_03_10.gray"},
-				{"00002458_U_1600x1500_1000_01_03_10.gray",
-				    "00002458_U_533x500_333_01_03_10.gray"},
-				{"00002458_U_960x900_600_01_03_10.gray",
-				    "00002458_U_533x500_333_01_03_10.gray"},
-
-				{"00002458_U_160x150_100_01_03_10.gray",
-				    "00002458_U_960x900_600_01_03_10.gray"},
-				{"00002458_U_400x375_250_01_03_10.gray",
-				    "00002458_U_960x900_600_01_03_10.gray"},
-				{"00002458_U_480x450_300_01_03_10.gray",
-				    "00002458_U_960x900_600_01_03_10.gray"},
-				{"00002458_U_533x500_333_01_03_10.gray",
-				    "00002458_U_960x900_600_01_03_10.gray"},
-				{"00002458_U_1600x1500_1000_01_03_10.gray",
-				    "00002458_U_960x900_600_01_03_10.gray"},
-
+				{905, 904},
+				{906, 904},
+				{907, 904},
+				{908, 904},
+				{134, 904},
+				{904, 134},
+				{905, 134},
+				{906, 134},
+				{907, 134},
+				{908, 134},
+				{904, 905},
+				{134, 905},
+				{906, 905},
+				{907, 905},
+				{908, 905},
+				{904, 906},
+				{905, 906},
+				{906, 906},
+				{908, 906},
+				{134, 906},
+				{904, 907},
+				{905, 907},
+				{906, 907},
+				{134, 907},
+				{908, 907},
+				{904, 908},
+				{905, 908},
+				{906, 908},
+				{907, 908},
+				{134, 908},
 				/* Other */
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "black_500x500_500_29_00_00.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "canary_500x500_500_29_00_00.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "gradient_500x500_500_29_00_00.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "rects_500x500_500_29_00_00.gray"},
-				{"00002480_S_283x419_500_00_03_02.gray",
-				    "white_500x500_500_29_00_00.gray"},
-				{"black_500x500_500_29_00_00.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"black_500x500_500_29_00_00.gray",
-				    "canary_500x500_500_29_00_00.gray"},
-				{"black_500x500_500_29_00_00.gray",
-				    "gradient_500x500_500_29_00_00.gray"},
-				{"black_500x500_500_29_00_00.gray",
-				    "rects_500x500_500_29_00_00.gray"},
-				{"black_500x500_500_29_00_00.gray",
-				    "white_500x500_500_29_00_00.gray"},
-				{"canary_500x500_500_29_00_00.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"canary_500x500_500_29_00_00.gray",
-				    "black_500x500_500_29_00_00.gray"},
-				{"canary_500x500_500_29_00_00.gray",
-				    "gradient_500x500_500_29_00_00.gray"},
-				{"canary_500x500_500_29_00_00.gray",
-				    "rects_500x500_500_29_00_00.gray"},
-				{"canary_500x500_500_29_00_00.gray",
-				    "white_500x500_500_29_00_00.gray"},
-				{"gradient_500x500_500_29_00_00.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"gradient_500x500_500_29_00_00.gray",
-				    "black_500x500_500_29_00_00.gray"},
-				{"gradient_500x500_500_29_00_00.gray",
-				    "canary_500x500_500_29_00_00.gray"},
-				{"gradient_500x500_500_29_00_00.gray",
-				    "rects_500x500_500_29_00_00.gray"},
-				{"gradient_500x500_500_29_00_00.gray",
-				    "white_500x500_500_29_00_00.gray"},
-				{"rects_500x500_500_29_00_00.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"rects_500x500_500_29_00_00.gray",
-				    "black_500x500_500_29_00_00.gray"},
-				{"rects_500x500_500_29_00_00.gray",
-				    "canary_500x500_500_29_00_00.gray"},
-				{"rects_500x500_500_29_00_00.gray",
-				    "gradient_500x500_500_29_00_00.gray"},
-				{"rects_500x500_500_29_00_00.gray",
-				    "white_500x500_500_29_00_00.gray"},
-				{"white_500x500_500_29_00_00.gray",
-				    "00002480_S_283x419_500_00_03_02.gray"},
-				{"white_500x500_500_29_00_00.gray",
-				    "black_500x500_500_29_00_00.gray"},
-				{"white_500x500_500_29_00_00.gray",
-				    "canary_500x500_500_29_00_00.gray"},
-				{"white_500x500_500_29_00_00.gray",
-				    "gradient_500x500_500_29_00_00.gray"},
-				{"white_500x500_500_29_00_00.gray",
-				    "rects_500x500_500_29_00_00.gray"}
-			};
+				{616, 231},
+				{616, 814},
+				{616, 381},
+				{616, 769},
+				{616, 30},
+				{231, 616},
+				{231, 814},
+				{231, 381},
+				{231, 769},
+				{231, 30},
+				{814, 616},
+				{814, 231},
+				{814, 381},
+				{814, 769},
+				{814, 30},
+				{381, 616},
+				{381, 231},
+				{381, 814},
+				{381, 769},
+				{381, 30},
+				{769, 616},
+				{769, 231},
+				{769, 814},
+				{769, 381},
+				{769, 30},
+				{30, 616},
+				{30, 231},
+				{30, 814},
+				{30, 381},
+				{30, 769}
+			});
+			static_assert(std::ranges::all_of(Pairs, [](const Pair &pair) {
+				return ((pair.probe < Images.size()) &&
+				    (pair.reference < Images.size()));
+			}), "Pairs refer to an image not in Images");
 		}
 	}
 }
@@ -0,0 +1,441 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <pftiii_validation_dataset.h>
+#include <pftiii_validation_file.h>
+#include <pftiii_validation_utils.h>
+
+namespace
+{
+	using namespace PFTIII;
+	using namespace PFTIII::Validation;
+
+	/** Data::Images and Data::Pairs, used in place. */
+	class BuiltinDataset : public Dataset
+	{
+	public:
+		uint64_t
+		getImageCount()
+		    const
+		    override
+		{
+			return (Data::Images.size());
+		}
+
+		std::string_view
+		getImageName(
+		    const uint64_t image)
+		    const
+		    override
+		{
+			return (Data::Images.at(image).name);
+		}
+
+		ImageMetadata
+		getImageMetadata(
+		    const uint64_t image)
+		    const
+		    override
+		{
+			return (Data::Images.at(image).metadata);
+		}
+
+		uint64_t
+		getPairCount()
+		    const
+		    override
+		{
+			return (Data::Pairs.size());
+		}
+
+		std::tuple<uint64_t, uint64_t>
+		getPair(
+		    const uint64_t pair)
+		    const
+		    override
+		{
+			const auto &[probe, reference] = Data::Pairs.at(pair);
+			return {probe, reference};
+		}
+	};
+
+	/** A binary or CSV manifest. */
+	class ManifestDataset : public Dataset
+	{
+	public:
+		/**
+		 * @param pathName
+		 * Path to the manifest.
+		 *
+		 * @throw runtime_error
+		 * Error reading the manifest, or the manifest is
+		 * malformed.
+		 */
+		explicit ManifestDataset(
+		    const std::string &pathName) :
+		    pathName{pathName},
+		    file{std::make_unique<MappedFile>(pathName)}
+		{
+			const auto data = this->file->getData();
+			ManifestHeader header{};
+			if (data.size() >= sizeof(header))
+				std::copy_n(data.data(), sizeof(header),
+				    reinterpret_cast<std::byte*>(&header));
+			if ((data.size() < sizeof(header)) ||
+			    (header.magic != ManifestMagic)) {
+				this->file.reset();
+				this->parse();
+				return;
+			}
+
+			if (header.version != ManifestVersion)
+				throw std::runtime_error(pathName + " is "
+				    "version " + ts(header.version) + " of the "
+				    "manifest format, expected " +
+				    ts(ManifestVersion));
+			uint64_t remaining{data.size() - sizeof(header)};
+			if ((header.imageCount > (remaining /
+			    sizeof(ManifestImage))) ||
+			    (header.pairCount > ((remaining -= (header.
+			    imageCount * sizeof(ManifestImage))) /
+			    sizeof(ManifestPair))) ||
+			    (header.namesLength > (remaining - (header.
+			    pairCount * sizeof(ManifestPair)))))
+				throw std::runtime_error(pathName + " is "
+				    "truncated");
+
+			/* Records are aligned, since the mapping is */
+			uint64_t offset{sizeof(header)};
+			this->images = {reinterpret_cast<const ManifestImage*>(
+			    data.data() + offset), header.imageCount};
+			offset += header.imageCount * sizeof(ManifestImage);
+			this->pairs = {reinterpret_cast<const ManifestPair*>(
+			    data.data() + offset), header.pairCount};
+			offset += header.pairCount * sizeof(ManifestPair);
+			this->names = {reinterpret_cast<const char*>(
+			    data.data() + offset), header.namesLength};
+		}
+
+		uint64_t
+		getImageCount()
+		    const
+		    override
+		{
+			return (this->images.size());
+		}
+
+		std::string_view
+		getImageName(
+		    const uint64_t image)
+		    const
+		    override
+		{
+			const auto &entry = this->getImage(image);
+			if ((entry.nameOffset > this->names.size()) ||
+			    (entry.nameLength > (this->names.size() -
+			    entry.nameOffset)))
+				throw std::runtime_error(this->pathName +
+				    " refers to a name of image " + ts(image) +
+				    " beyond its end");
+			return (this->names.substr(entry.nameOffset,
+			    entry.nameLength));
+		}
+
+		ImageMetadata
+		getImageMetadata(
+		    const uint64_t image)
+		    const
+		    override
+		{
+			const auto &entry = this->getImage(image);
+			return {entry.width, entry.height, entry.ppi,
+			    static_cast<Impression>(entry.imp),
+			    static_cast<FrictionRidgeCaptureTechnology>(
+			    entry.frct),
+			    static_cast<FrictionRidgeGeneralizedPosition>(
+			    entry.frgp)};
+		}
+
+		uint64_t
+		getPairCount()
+		    const
+		    override
+		{
+			return (this->pairs.size());
+		}
+
+		std::tuple<uint64_t, uint64_t>
+		getPair(
+		    const uint64_t pair)
+		    const
+		    override
+		{
+			if (pair >= this->pairs.size())
+				throw std::out_of_range("Pair " + ts(pair) +
+				    " is not in " + this->pathName);
+			const auto &entry = this->pairs[pair];
+			if ((entry.probe >= this->images.size()) ||
+			    (entry.reference >= this->images.size()))
+				throw std::runtime_error(this->pathName +
+				    " refers to an image of pair " + ts(pair) +
+				    " that does not exist");
+			return {entry.probe, entry.reference};
+		}
+
+	private:
+		/**
+		 * @return
+		 * Entry for the image at `image`.
+		 *
+		 * @throw out_of_range
+		 * `image` is not in the manifest.
+		 */
+		const ManifestImage&
+		getImage(
+		    const uint64_t image)
+		    const
+		{
+			if (image >= this->images.size())
+				throw std::out_of_range("Image " + ts(image) +
+				    " is not in " + this->pathName);
+			return (this->images[image]);
+		}
+
+		/**
+		 * @brief
+		 * Read a CSV manifest into memory.
+		 *
+		 * @throw runtime_error
+		 * Error reading the manifest, or the manifest is
+		 * malformed.
+		 */
+		void
+		parse()
+		{
+			std::ifstream file{this->pathName};
+			if (!file)
+				throw std::runtime_error("Could not open " +
+				    this->pathName);
+
+			uint64_t number{0};
+			std::string line{};
+			while (std::getline(file, line)) {
+				++number;
+				if (line.empty() || line.starts_with('#'))
+					continue;
+
+				std::vector<std::string_view> fields{};
+				std::string_view rest{line};
+				for (auto comma = rest.find(','); comma !=
+				    std::string_view::npos; comma =
+				    rest.find(',')) {
+					fields.push_back(rest.substr(0, comma));
+					rest.remove_prefix(comma + 1);
+				}
+				fields.push_back(rest);
+
+				try {
+					if ((fields[0] == "image") &&
+					    (fields.size() == 8))
+						this->parseImage(fields);
+					else if ((fields[0] == "pair") &&
+					    (fields.size() == 3))
+						this->parsedPairs.push_back({
+						    toInteger<uint32_t>(
+						    fields[1]), toInteger<
+						    uint32_t>(fields[2])});
+					else
+						throw std::runtime_error(
+						    "expected image or pair");
+				} catch (const std::exception &e) {
+					throw std::runtime_error("Line " +
+					    ts(number) + " of " +
+					    this->pathName + ": " + e.what());
+				}
+			}
+			if (file.bad())
+				throw std::runtime_error("Could not read " +
+				    this->pathName);
+
+			for (uint64_t i{0}; i < this->parsedPairs.size(); ++i)
+				if ((this->parsedPairs[i].probe >=
+				    this->parsedImages.size()) ||
+				    (this->parsedPairs[i].reference >=
+				    this->parsedImages.size()))
+					throw std::runtime_error("Pair " +
+					    ts(i) + " of " + this->pathName +
+					    " refers to an image that does "
+					    "not exist");
+
+			this->images = this->parsedImages;
+			this->pairs = this->parsedPairs;
+			this->names = this->parsedNames;
+		}
+
+		/**
+		 * @brief
+		 * Add the image described by the fields of a line of a
+		 * CSV manifest.
+		 *
+		 * @throw runtime_error
+		 * A field is malformed.
+		 */
+		void
+		parseImage(
+		    const std::vector<std::string_view> &fields)
+		{
+			/* Names are quoted in logs and name template files */
+			const auto name = fields[1];
+			if (name.empty() || (name.size() >
+			    std::numeric_limits<uint16_t>::max()) ||
+			    (name.find_first_of("\"/") !=
+			    std::string_view::npos))
+				throw std::runtime_error("invalid name \"" +
+				    std::string(name) + "\"");
+
+			ManifestImage image{};
+			image.nameOffset = this->parsedNames.size();
+			image.nameLength = static_cast<uint16_t>(name.size());
+			image.width = toInteger<uint16_t>(fields[2]);
+			image.height = toInteger<uint16_t>(fields[3]);
+			image.ppi = toInteger<uint16_t>(fields[4]);
+			image.imp = toInteger<uint8_t>(fields[5]);
+			image.frct = toInteger<uint8_t>(fields[6]);
+			image.frgp = toInteger<uint8_t>(fields[7]);
+			this->parsedImages.push_back(image);
+			this->parsedNames += name;
+		}
+
+		/**
+		 * @return
+		 * Integer in `field`.
+		 *
+		 * @throw runtime_error
+		 * `field` is not an integer that fits in T.
+		 */
+		template<typename T>
+		static T
+		toInteger(
+		    const std::string_view field)
+		{
+			T value{};
+			const auto [end, error] = std::from_chars(field.data(),
+			    field.data() + field.size(), value);
+			if ((error != std::errc{}) ||
+			    (end != (field.data() + field.size())))
+				throw std::runtime_error("invalid number \"" +
+				    std::string(field) + "\"");
+			return (value);
+		}
+
+		/** Path to the manifest. */
+		const std::string pathName;
+		/** A binary manifest, or nullptr for CSV. */
+		std::unique_ptr<MappedFile> file{};
+
+		/** Images read from a CSV manifest. */
+		std::vector<ManifestImage> parsedImages{};
+		/** Pairs read from a CSV manifest. */
+		std::vector<ManifestPair> parsedPairs{};
+		/** Names read from a CSV manifest. */
+		std::string parsedNames{};
+
+		/** Images, in `file` or parsedImages. */
+		std::span<const ManifestImage> images{};
+		/** Pairs, in `file` or parsedPairs. */
+		std::span<const ManifestPair> pairs{};
+		/** Names, in `file` or parsedNames. */
+		std::string_view names{};
+	};
+}
+
+std::unique_ptr<PFTIII::Validation::Dataset>
+PFTIII::Validation::Dataset::open(
+    const std::string &manifest)
+{
+	if (manifest.empty())
+		return (std::make_unique<BuiltinDataset>());
+	return (std::make_unique<ManifestDataset>(manifest));
+}
+
+std::tuple<std::string_view, std::string_view>
+PFTIII::Validation::Dataset::getPairNames(
+    const uint64_t pair)
+    const
+{
+	const auto [probe, reference] = this->getPair(pair);
+	return {this->getImageName(probe), this->getImageName(reference)};
+}
+
+void
+PFTIII::Validation::writeManifest(
+    const std::string &pathName,
+    const Dataset &dataset)
+{
+	if (dataset.getImageCount() > std::numeric_limits<uint32_t>::max())
+		throw std::runtime_error("Too many images for a manifest (" +
+		    ts(dataset.getImageCount()) + ")");
+
+	std::ofstream file{pathName, std::ios::binary | std::ios::trunc};
+	const auto write = [&](const void *data, const std::size_t size) {
+		file.write(static_cast<const char*>(data),
+		    static_cast<std::streamsize>(size));
+	};
+
+	ManifestHeader header{};
+	header.imageCount = dataset.getImageCount();
+	header.pairCount = dataset.getPairCount();
+	for (uint64_t i{0}; i < header.imageCount; ++i)
+		header.namesLength += dataset.getImageName(i).size();
+	write(&header, sizeof(header));
+
+	uint64_t nameOffset{0};
+	for (uint64_t i{0}; i < header.imageCount; ++i) {
+		const auto name = dataset.getImageName(i);
+		if (name.size() > std::numeric_limits<uint16_t>::max())
+			throw std::runtime_error("Image name too long: " +
+			    std::string(name));
+		const auto md = dataset.getImageMetadata(i);
+
+		ManifestImage image{};
+		image.nameOffset = nameOffset;
+		image.width = md.width;
+		image.height = md.height;
+		image.ppi = md.ppi;
+		image.nameLength = static_cast<uint16_t>(name.size());
+		image.imp = static_cast<uint8_t>(md.imp);
+		image.frct = static_cast<uint8_t>(md.frct);
+		image.frgp = static_cast<uint8_t>(md.frgp);
+		write(&image, sizeof(image));
+		nameOffset += name.size();
+	}
+	for (uint64_t i{0}; i < header.pairCount; ++i) {
+		const auto [probe, reference] = dataset.getPair(i);
+		const ManifestPair pair{static_cast<uint32_t>(probe),
+		    static_cast<uint32_t>(reference)};
+		write(&pair, sizeof(pair));
+	}
+	for (uint64_t i{0}; i < header.imageCount; ++i) {
+		const auto name = dataset.getImageName(i);
+		write(name.data(), name.size());
+	}
+
+	file.flush();
+	if (!file)
+		throw std::runtime_error("Could not write to " + pathName);
+}
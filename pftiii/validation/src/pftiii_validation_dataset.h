@@ -0,0 +1,237 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_DATASET_H_
+#define PFTIII_VALIDATION_DATASET_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include <pftiii_validation_data.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/*
+		 * A manifest is a ManifestHeader, followed by
+		 * ManifestHeader::imageCount ManifestImages, then
+		 * ManifestHeader::pairCount ManifestPairs, then the names of
+		 * all images, concatenated. Pairs refer to images by their
+		 * position among the ManifestImages. All integers are in
+		 * host byte order.
+		 *
+		 * A manifest may instead be CSV, one image or pair per line:
+		 *
+		 *     image,name,width,height,ppi,imp,frct,frgp
+		 *     pair,probe,reference
+		 *
+		 * where imp, frct, and frgp are integer values of Impression,
+		 * FrictionRidgeCaptureTechnology, and
+		 * FrictionRidgeGeneralizedPosition, and probe and reference
+		 * count image lines from 0. Empty lines and lines starting
+		 * with '#' are ignored.
+		 */
+
+		/** Identifies a binary manifest. */
+		constexpr uint32_t ManifestMagic{0x4d544650}; /* "PFTM" */
+		/** Version of the manifest format described here. */
+		constexpr uint32_t ManifestVersion{1};
+
+		/** Start of a binary manifest. */
+		struct ManifestHeader
+		{
+			/** ManifestMagic. */
+			uint32_t magic{ManifestMagic};
+			/** ManifestVersion. */
+			uint32_t version{ManifestVersion};
+			/** Number of images. */
+			uint64_t imageCount{};
+			/** Number of pairs. */
+			uint64_t pairCount{};
+			/** Number of bytes of names. */
+			uint64_t namesLength{};
+		};
+		static_assert(sizeof(ManifestHeader) == 32);
+
+		/** Describes one image in a binary manifest. */
+		struct ManifestImage
+		{
+			/** Offset of the image's name within the names. */
+			uint64_t nameOffset{};
+			/** Width of image. */
+			uint16_t width{};
+			/** Height of image. */
+			uint16_t height{};
+			/** Resolution of image in pixels per inch. */
+			uint16_t ppi{};
+			/** Number of bytes in the image's name. */
+			uint16_t nameLength{};
+			/** Impression type of the finger. */
+			uint8_t imp{};
+			/** Technology used to capture the image. */
+			uint8_t frct{};
+			/** Position of the finger. */
+			uint8_t frgp{};
+			/** Zero. */
+			uint8_t reserved[5]{};
+		};
+		static_assert(sizeof(ManifestImage) == 24);
+
+		/** Describes one pair in a binary manifest. */
+		struct ManifestPair
+		{
+			/** Index of the probe image. */
+			uint32_t probe{};
+			/** Index of the reference image. */
+			uint32_t reference{};
+		};
+		static_assert(sizeof(ManifestPair) == 8);
+
+		/**
+		 * @brief
+		 * Images, and pairs of them to compare.
+		 *
+		 * @details
+		 * Pairs refer to images by index, so each name is held
+		 * once. A Dataset may be shared between threads and between
+		 * processes fork()ed after its construction.
+		 */
+		class Dataset
+		{
+		public:
+			/**
+			 * @brief
+			 * Open a dataset.
+			 *
+			 * @param manifest
+			 * Path to a binary or CSV manifest, or empty for the
+			 * built-in validation set (Data::Images and
+			 * Data::Pairs).
+			 *
+			 * @return
+			 * The dataset.
+			 *
+			 * @throw runtime_error
+			 * Error reading the manifest, or the manifest is
+			 * malformed.
+			 *
+			 * @note
+			 * Binary manifests are mapped into memory and
+			 * checked as they are used, so opening one takes the
+			 * same time regardless of its size.
+			 */
+			static std::unique_ptr<Dataset>
+			open(
+			    const std::string &manifest);
+
+			virtual ~Dataset() = default;
+
+			/** @return Number of images. */
+			virtual uint64_t
+			getImageCount()
+			    const = 0;
+
+			/**
+			 * @param image
+			 * Index of an image.
+			 *
+			 * @return
+			 * Name of the image, valid for the lifetime of this
+			 * object.
+			 *
+			 * @throw out_of_range
+			 * `image` is not less than getImageCount().
+			 * @throw runtime_error
+			 * The manifest is malformed.
+			 */
+			virtual std::string_view
+			getImageName(
+			    const uint64_t image)
+			    const = 0;
+
+			/**
+			 * @param image
+			 * Index of an image.
+			 *
+			 * @return
+			 * Metadata of the image.
+			 *
+			 * @throw out_of_range
+			 * `image` is not less than getImageCount().
+			 */
+			virtual ImageMetadata
+			getImageMetadata(
+			    const uint64_t image)
+			    const = 0;
+
+			/** @return Number of pairs. */
+			virtual uint64_t
+			getPairCount()
+			    const = 0;
+
+			/**
+			 * @param pair
+			 * Index of a pair.
+			 *
+			 * @return
+			 * Indices of the probe and reference images.
+			 *
+			 * @throw out_of_range
+			 * `pair` is not less than getPairCount().
+			 * @throw runtime_error
+			 * The manifest is malformed.
+			 */
+			virtual std::tuple<uint64_t, uint64_t>
+			getPair(
+			    const uint64_t pair)
+			    const = 0;
+
+			/**
+			 * @param pair
+			 * Index of a pair.
+			 *
+			 * @return
+			 * Names of the probe and reference images.
+			 *
+			 * @throw out_of_range
+			 * `pair` is not less than getPairCount().
+			 * @throw runtime_error
+			 * The manifest is malformed.
+			 */
+			std::tuple<std::string_view, std::string_view>
+			getPairNames(
+			    const uint64_t pair)
+			    const;
+		};
+
+		/**
+		 * @brief
+		 * Write a dataset as a binary manifest.
+		 *
+		 * @param pathName
+		 * Path to the manifest, replaced if it exists.
+		 * @param dataset
+		 * Images and pairs to describe.
+		 *
+		 * @throw runtime_error
+		 * Too many images, a name too long, or error writing.
+		 */
+		void
+		writeManifest(
+		    const std::string &pathName,
+		    const Dataset &dataset);
+	}
+}
+
+#endif /* PFTIII_VALIDATION_DATASET_H_ */
@@ -0,0 +1,119 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <pftiii_validation_file.h>
+
+namespace
+{
+	/** @return Description of the current errno. */
+	std::string
+	errnoMessage()
+	{
+		return (std::system_error(errno, std::system_category()).
+		    code().message());
+	}
+
+	/** @return madvise() equivalent of `advice`. */
+	int
+	toMadvise(
+	    const PFTIII::Validation::Advice advice)
+	{
+		switch (advice) {
+		case PFTIII::Validation::Advice::Sequential:
+			return (MADV_SEQUENTIAL);
+		case PFTIII::Validation::Advice::Random:
+			return (MADV_RANDOM);
+		case PFTIII::Validation::Advice::WillNeed:
+			return (MADV_WILLNEED);
+		case PFTIII::Validation::Advice::Normal:
+			break;
+		}
+		return (MADV_NORMAL);
+	}
+}
+
+PFTIII::Validation::MappedFile::MappedFile(
+    const std::string &pathName,
+    const Advice advice)
+{
+	const int fd{::open(pathName.c_str(), O_RDONLY | O_CLOEXEC)};
+	if (fd == -1)
+		throw std::runtime_error("Could not open " + pathName + " (" +
+		    errnoMessage() + ")");
+
+	struct stat sb{};
+	if (::fstat(fd, &sb) != 0) {
+		const auto message = errnoMessage();
+		::close(fd);
+		throw std::runtime_error("Could not stat " + pathName + " (" +
+		    message + ")");
+	}
+	this->size = static_cast<uint64_t>(sb.st_size);
+
+	/* mmap() rejects a length of 0 */
+	if (this->size == 0) {
+		::close(fd);
+		return;
+	}
+
+	void *address{::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd,
+	    0)};
+	/* The mapping holds its own reference to the file */
+	::close(fd);
+	if (address == MAP_FAILED)
+		throw std::runtime_error("Could not map " + pathName + " (" +
+		    errnoMessage() + ")");
+	this->address = static_cast<std::byte*>(address);
+
+	if (advice != Advice::Normal)
+		this->advise(0, this->size, advice);
+}
+
+std::span<const std::byte>
+PFTIII::Validation::MappedFile::getData()
+    const
+{
+	return {this->address, this->size};
+}
+
+void
+PFTIII::Validation::MappedFile::advise(
+    const uint64_t offset,
+    const uint64_t length,
+    const Advice advice)
+    const
+{
+	if ((this->address == nullptr) || (offset >= this->size))
+		return;
+
+	/* madvise() requires a page-aligned start */
+	static const auto pageSize = static_cast<uint64_t>(
+	    ::sysconf(_SC_PAGESIZE));
+	const uint64_t start{offset - (offset % pageSize)};
+	const uint64_t end{std::min(offset + length, this->size)};
+	::madvise(this->address + start, end - start, toMadvise(advice));
+}
+
+PFTIII::Validation::MappedFile::~MappedFile()
+{
+	if (this->address != nullptr)
+		::munmap(this->address, this->size);
+}
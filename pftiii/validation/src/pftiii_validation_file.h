@@ -0,0 +1,109 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_FILE_H_
+#define PFTIII_VALIDATION_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/** Expected pattern of access to a MappedFile. */
+		enum class Advice
+		{
+			/** No particular pattern. */
+			Normal,
+			/** From start to end, once. Read ahead aggressively. */
+			Sequential,
+			/** In no particular order. Do not read ahead. */
+			Random,
+			/** Soon. Start reading now. */
+			WillNeed
+		};
+
+		/**
+		 * @brief
+		 * A file mapped read-only into memory.
+		 *
+		 * @details
+		 * Views returned by getData() remain valid for the lifetime of
+		 * the MappedFile, including in processes fork()ed after its
+		 * construction.
+		 */
+		class MappedFile
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param pathName
+			 * Path to file to map.
+			 * @param advice
+			 * Expected pattern of access to the whole file.
+			 *
+			 * @throw runtime_error
+			 * Error opening or mapping the file.
+			 */
+			explicit MappedFile(
+			    const std::string &pathName,
+			    const Advice advice = Advice::Normal);
+
+			/** @return Contents of the file. Empty for 0 bytes. */
+			std::span<const std::byte>
+			getData()
+			    const;
+
+			/**
+			 * @brief
+			 * Describe the expected pattern of access to part of
+			 * the file.
+			 *
+			 * @param offset
+			 * Offset of the first byte of the range.
+			 * @param length
+			 * Number of bytes in the range.
+			 * @param advice
+			 * Expected pattern of access to the range.
+			 *
+			 * @note
+			 * Advice is a hint. Failures are ignored.
+			 */
+			void
+			advise(
+			    const uint64_t offset,
+			    const uint64_t length,
+			    const Advice advice)
+			    const;
+
+			~MappedFile();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			MappedFile(
+			    const MappedFile&) = delete;
+			MappedFile& operator=(
+			    const MappedFile&) = delete;
+			/** @endcond */
+
+		private:
+			/** Start of the mapping, or nullptr if empty. */
+			std::byte *address{nullptr};
+			/** Size of the file, in bytes. */
+			uint64_t size{};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_FILE_H_ */
@@ -0,0 +1,89 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <bit>
+#include <utility>
+
+#include <pftiii_validation_permutation.h>
+
+namespace
+{
+	/** @return SplitMix64 finalizer applied to `value`. */
+	uint64_t
+	mix(
+	    uint64_t value)
+	{
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+		return (value ^ (value >> 31));
+	}
+}
+
+PFTIII::Validation::Permutation::Permutation(
+    const uint64_t size,
+    const uint64_t seed) :
+    count{size}
+{
+	/* Smallest even number of bits that can hold size - 1, at least 2 */
+	const unsigned int bits{(size <= 1) ? 1u :
+	    static_cast<unsigned int>(std::bit_width(size - 1))};
+	this->halfBits = (bits + 1) / 2;
+
+	uint64_t state{seed};
+	for (auto &key : this->keys) {
+		state += 0x9E3779B97F4A7C15;
+		key = mix(state);
+	}
+}
+
+PFTIII::Validation::Permutation::Permutation(
+    std::vector<uint64_t> order) :
+    count{order.size()},
+    order{std::move(order)}
+{
+
+}
+
+uint64_t
+PFTIII::Validation::Permutation::encrypt(
+    uint64_t value)
+    const
+{
+	const uint64_t mask{(uint64_t{1} << this->halfBits) - 1};
+	uint64_t left{value >> this->halfBits};
+	uint64_t right{value & mask};
+	for (const auto &key : this->keys) {
+		left ^= mix(right ^ key) & mask;
+		std::swap(left, right);
+	}
+	return ((left << this->halfBits) | right);
+}
+
+uint64_t
+PFTIII::Validation::Permutation::operator[](
+    const uint64_t position)
+    const
+{
+	if (!this->order.empty())
+		return (this->order[position]);
+
+	/* The domain is under 4 * count, so few walks are expected */
+	uint64_t value{this->encrypt(position)};
+	while (value >= this->count)
+		value = this->encrypt(value);
+	return (value);
+}
+
+uint64_t
+PFTIII::Validation::Permutation::size()
+    const
+{
+	return (this->count);
+}
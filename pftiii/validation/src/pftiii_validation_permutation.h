@@ -0,0 +1,101 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_PERMUTATION_H_
+#define PFTIII_VALIDATION_PERMUTATION_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * An ordering of [0, size), computed on demand.
+		 *
+		 * @details
+		 * A seeded Permutation is a keyed Feistel network over the
+		 * smallest power of 4 not less than `size`. Outputs that fall
+		 * outside [0, size) are fed back in ("cycle walking") until
+		 * one falls inside. This makes a bijection on [0, size) in
+		 * O(1) memory, so billions of positions can be permuted
+		 * without storing them.
+		 */
+		class Permutation
+		{
+		public:
+			/**
+			 * @brief
+			 * Pseudorandom permutation.
+			 *
+			 * @param size
+			 * Number of positions to permute.
+			 * @param seed
+			 * Selects the permutation. The same size and seed
+			 * always produce the same permutation.
+			 */
+			Permutation(
+			    const uint64_t size,
+			    const uint64_t seed);
+
+			/**
+			 * @brief
+			 * Explicit permutation.
+			 *
+			 * @param order
+			 * Value at each position. Should hold every value in
+			 * [0, order.size()) once.
+			 */
+			explicit Permutation(
+			    std::vector<uint64_t> order);
+
+			/**
+			 * @param position
+			 * Position in [0, size()).
+			 *
+			 * @return
+			 * Value at `position`.
+			 */
+			uint64_t
+			operator[](
+			    const uint64_t position)
+			    const;
+
+			/** @return Number of positions permuted. */
+			uint64_t
+			size()
+			    const;
+
+		private:
+			/** Number of Feistel rounds. */
+			static constexpr std::size_t Rounds{6};
+
+			/** @return One Feistel encryption of `value`. */
+			uint64_t
+			encrypt(
+			    uint64_t value)
+			    const;
+
+			/** Number of positions. */
+			uint64_t count{};
+			/** Bits in each half of a Feistel block. */
+			unsigned int halfBits{};
+			/** Key for each round. */
+			std::array<uint64_t, Rounds> keys{};
+			/** Explicit order, or empty when computed. */
+			std::vector<uint64_t> order{};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_PERMUTATION_H_ */
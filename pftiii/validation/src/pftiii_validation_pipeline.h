@@ -0,0 +1,252 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_PIPELINE_H_
+#define PFTIII_VALIDATION_PIPELINE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include <pftiii_validation_scheduler.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * First-in, first-out queue of limited capacity, for passing
+		 * items between threads.
+		 *
+		 * @details
+		 * Producers block while the queue is full and consumers block
+		 * while it is empty. Closing the queue releases both: items
+		 * already queued may still be popped, but no more may be
+		 * pushed.
+		 */
+		template<typename T>
+		class BoundedQueue
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param capacity
+			 * Maximum number of items queued at once.
+			 *
+			 * @throw invalid_argument
+			 * capacity is 0.
+			 */
+			explicit BoundedQueue(
+			    const std::size_t capacity) :
+			    capacity{capacity}
+			{
+				if (capacity == 0)
+					throw std::invalid_argument("Queue "
+					    "capacity must be positive");
+			}
+
+			/**
+			 * @brief
+			 * Add an item, waiting for space if necessary.
+			 *
+			 * @param item
+			 * Item to add.
+			 *
+			 * @return
+			 * true if the item was queued, false if the queue was
+			 * closed and `item` was discarded.
+			 */
+			bool
+			push(
+			    T item)
+			{
+				std::unique_lock lock{this->mutex};
+				this->notFull.wait(lock, [this]() {
+					return (this->closed ||
+					    (this->items.size() <
+					    this->capacity));
+				});
+				if (this->closed)
+					return (false);
+
+				this->items.push_back(std::move(item));
+				lock.unlock();
+				this->notEmpty.notify_one();
+				return (true);
+			}
+
+			/**
+			 * @brief
+			 * Remove the oldest item, waiting for one if
+			 * necessary.
+			 *
+			 * @return
+			 * The oldest item, or std::nullopt once the queue is
+			 * closed and empty.
+			 */
+			std::optional<T>
+			pop()
+			{
+				std::unique_lock lock{this->mutex};
+				this->notEmpty.wait(lock, [this]() {
+					return (this->closed ||
+					    !this->items.empty());
+				});
+				if (this->items.empty())
+					return (std::nullopt);
+
+				std::optional<T> item{std::move(
+				    this->items.front())};
+				this->items.pop_front();
+				lock.unlock();
+				this->notFull.notify_one();
+				return (item);
+			}
+
+			/** @brief Refuse further pushes and wake all waiters. */
+			void
+			close()
+			{
+				{
+					std::lock_guard lock{this->mutex};
+					this->closed = true;
+				}
+				this->notFull.notify_all();
+				this->notEmpty.notify_all();
+			}
+
+		private:
+			/** Maximum number of queued items. */
+			const std::size_t capacity;
+			/** Queued items, oldest first. */
+			std::deque<T> items{};
+			/** Whether close() has been called. */
+			bool closed{false};
+			/** Protects all members. */
+			std::mutex mutex{};
+			/** Signaled when an item is removed or on close. */
+			std::condition_variable notFull{};
+			/** Signaled when an item is added or on close. */
+			std::condition_variable notEmpty{};
+		};
+
+		/**
+		 * @brief
+		 * Process claimed positions in three stages: load, compute,
+		 * and store.
+		 *
+		 * @param queue
+		 * Source of positions to process.
+		 * @param depth
+		 * Number of items that may wait between stages. 0 runs
+		 * every stage of each position in turn on the calling
+		 * thread. Otherwise, `load` and `store` each run on their
+		 * own thread, overlapping I/O with `compute`.
+		 * @param load
+		 * Reads the input for a position.
+		 * @param compute
+		 * Turns an input into an output. Always runs on the calling
+		 * thread, in the order positions were loaded.
+		 * @param store
+		 * Writes an output. Outputs are stored in the order
+		 * positions were loaded.
+		 *
+		 * @throw
+		 * Exception thrown by a stage, rethrown once every stage has
+		 * stopped. If several stages throw, the exception from the
+		 * stage nearest `load` is rethrown.
+		 */
+		template<typename Input, typename Output>
+		void
+		runPipeline(
+		    WorkQueue &queue,
+		    const std::size_t depth,
+		    const std::function<Input(const uint64_t position)> &load,
+		    const std::function<Output(Input &input)> &compute,
+		    const std::function<void(Output &output)> &store)
+		{
+			if (depth == 0) {
+				while (const auto range = queue.claim()) {
+					for (auto i = std::get<0>(*range);
+					    i < std::get<1>(*range); ++i) {
+						Input input{load(i)};
+						Output output{compute(input)};
+						store(output);
+					}
+				}
+				return;
+			}
+
+			BoundedQueue<Input> inputs{depth};
+			BoundedQueue<Output> outputs{depth};
+			std::exception_ptr loadError{}, computeError{},
+			    storeError{};
+
+			/* Closing a queue stops the stages on either side */
+			std::thread loader{[&]() {
+				try {
+					while (const auto range =
+					    queue.claim()) {
+						for (auto i = std::get<0>(
+						    *range); i < std::get<1>(
+						    *range); ++i)
+							if (!inputs.push(
+							    load(i)))
+								return;
+					}
+				} catch (...) {
+					loadError = std::current_exception();
+				}
+				inputs.close();
+			}};
+			std::thread storer{[&]() {
+				try {
+					while (auto output = outputs.pop())
+						store(*output);
+				} catch (...) {
+					storeError = std::current_exception();
+					outputs.close();
+				}
+			}};
+
+			try {
+				while (auto input = inputs.pop())
+					if (!outputs.push(compute(*input)))
+						break;
+			} catch (...) {
+				computeError = std::current_exception();
+			}
+			inputs.close();
+			outputs.close();
+
+			loader.join();
+			storer.join();
+
+			for (const auto &error : {loadError, computeError,
+			    storeError})
+				if (error)
+					std::rethrow_exception(error);
+		}
+	}
+}
+
+#endif /* PFTIII_VALIDATION_PIPELINE_H_ */
@@ -0,0 +1,230 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
+
+#include <pftiii_validation_placement.h>
+#include <pftiii_validation_utils.h>
+
+namespace
+{
+	/** Topology of the kernel's CPUs. */
+	const std::string CPUDir{"/sys/devices/system/cpu"};
+	/** Topology of the kernel's NUMA nodes. */
+	const std::string NodeDir{"/sys/devices/system/node"};
+
+	/** @return Description of the current errno. */
+	std::string
+	errnoMessage()
+	{
+		return (std::system_error(errno, std::system_category()).
+		    code().message());
+	}
+
+	/**
+	 * @return
+	 * Number in the sysfs file at `pathName`, or std::nullopt if
+	 * the kernel does not provide it.
+	 */
+	std::optional<uint32_t>
+	readNumber(
+	    const std::string &pathName)
+	{
+		std::ifstream file{pathName};
+		uint32_t number{};
+		if (!(file >> number))
+			return (std::nullopt);
+		return (number);
+	}
+
+	/**
+	 * @return
+	 * CPUs in a sysfs list of ranges, e.g., "0-3,8-11".
+	 *
+	 * @throw runtime_error
+	 * `list` is malformed.
+	 */
+	std::vector<uint32_t>
+	parseCPUList(
+	    const std::string &list)
+	{
+		std::vector<uint32_t> cpus{};
+		std::string::size_type start{0};
+		while (start < list.size()) {
+			auto end = list.find(',', start);
+			if (end == std::string::npos)
+				end = list.size();
+			const std::string range{list.substr(start,
+			    end - start)};
+			start = end + 1;
+
+			try {
+				const auto dash = range.find('-');
+				const auto first = std::stoul(range.substr(0,
+				    dash));
+				const auto last = (dash == std::string::npos) ?
+				    first : std::stoul(range.substr(dash + 1));
+				for (auto cpu = first; cpu <= last; ++cpu)
+					cpus.push_back(static_cast<uint32_t>(
+					    cpu));
+			} catch (const std::exception&) {
+				throw std::runtime_error("Could not parse "
+				    "CPU list \"" + list + "\"");
+			}
+		}
+		return (cpus);
+	}
+
+	/**
+	 * @return
+	 * NUMA node of each CPU, empty if the kernel does not report
+	 * NUMA nodes.
+	 */
+	std::vector<std::optional<uint32_t>>
+	readNodes()
+	{
+		std::vector<std::optional<uint32_t>> nodes{};
+		std::error_code ignored{};
+		for (const auto &entry : std::filesystem::directory_iterator(
+		    NodeDir, ignored)) {
+			const auto name = entry.path().filename().string();
+			if (!name.starts_with("node") || (name.find_first_not_of(
+			    "0123456789", 4) != std::string::npos))
+				continue;
+			const auto node = static_cast<uint32_t>(std::stoul(
+			    name.substr(4)));
+
+			std::ifstream file{entry.path() / "cpulist"};
+			std::string list{};
+			std::getline(file, list);
+			for (const auto &cpu : parseCPUList(list)) {
+				if (cpu >= nodes.size())
+					nodes.resize(cpu + 1);
+				nodes[cpu] = node;
+			}
+		}
+		return (nodes);
+	}
+}
+
+std::vector<PFTIII::Validation::Placement>
+PFTIII::Validation::getPlacements(
+    const Pinning pinning,
+    const uint8_t count,
+    const bool bindMemory)
+{
+	if (pinning == Pinning::None)
+		throw std::invalid_argument("No pinning sent to "
+		    "getPlacements()");
+
+	/* Restrictions on this process (e.g., cgroups) are respected */
+	cpu_set_t allowed{};
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+		throw std::runtime_error("Could not read CPU affinity (" +
+		    errnoMessage() + ")");
+
+	const auto nodes = readNodes();
+	std::vector<Placement> cpus{};
+	for (uint32_t cpu{0}; cpu < CPU_SETSIZE; ++cpu) {
+		if (!CPU_ISSET(cpu, &allowed))
+			continue;
+
+		/* Without topology, each CPU is its own core */
+		const std::string topology{CPUDir + "/cpu" + ts(cpu) +
+		    "/topology/"};
+		cpus.push_back({cpu,
+		    readNumber(topology + "core_id").value_or(cpu),
+		    readNumber(topology + "physical_package_id").value_or(0),
+		    ((cpu < nodes.size()) && nodes[cpu]) ? *nodes[cpu] : 0,
+		    bindMemory});
+	}
+	std::sort(cpus.begin(), cpus.end(), [](const Placement &lhs,
+	    const Placement &rhs) {
+		return (std::tie(lhs.node, lhs.package, lhs.core, lhs.cpu) <
+		    std::tie(rhs.node, rhs.package, rhs.core, rhs.cpu));
+	});
+
+	/* The first hardware thread of each core stands for the core */
+	if (pinning == Pinning::Core) {
+		std::set<std::tuple<uint32_t, uint32_t>> seen{};
+		std::erase_if(cpus, [&seen](const Placement &placement) {
+			return (!seen.emplace(placement.package,
+			    placement.core).second);
+		});
+	}
+
+	if (cpus.size() < count)
+		throw std::runtime_error("Cannot pin " + ts(count) +
+		    " workers to " + ts(cpus.size()) + " available " +
+		    ((pinning == Pinning::Core) ? "cores" :
+		    "hardware threads"));
+	cpus.resize(count);
+	return (cpus);
+}
+
+void
+PFTIII::Validation::applyPlacement(
+    const Placement &placement)
+{
+	cpu_set_t cpus{};
+	CPU_ZERO(&cpus);
+	CPU_SET(placement.cpu, &cpus);
+	if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0)
+		throw std::runtime_error("Could not pin to CPU " +
+		    ts(placement.cpu) + " (" + errnoMessage() + ")");
+
+	if (!placement.bindMemory)
+		return;
+
+	/* The kernel reads one bit fewer than the count it is sent */
+	constexpr auto Bits = std::numeric_limits<unsigned long>::digits;
+	std::vector<unsigned long> mask((placement.node / Bits) + 1);
+	mask[placement.node / Bits] |= 1UL << (placement.node % Bits);
+	if (syscall(SYS_set_mempolicy, MPOL_BIND, mask.data(),
+	    (mask.size() * Bits) + 1) != 0)
+		throw std::runtime_error("Could not bind memory to NUMA "
+		    "node " + ts(placement.node) + " (" + errnoMessage() +
+		    ")");
+}
+
+void
+PFTIII::Validation::writePlacements(
+    const std::string &pathName,
+    const Pinning pinning,
+    const std::vector<Placement> &placements)
+{
+	std::ofstream log{pathName};
+	log << "worker,pinning,cpu,core,package,node,memory\n";
+	for (std::size_t worker{0}; worker < placements.size(); ++worker) {
+		const auto &placement = placements[worker];
+		log << ts(worker) << ',' << ((pinning == Pinning::Core) ?
+		    "core" : "thread") << ',' << ts(placement.cpu) << ',' <<
+		    ts(placement.core) << ',' << ts(placement.package) <<
+		    ',' << ts(placement.node) << ',' <<
+		    (placement.bindMemory ? "bound" : "any") << '\n';
+	}
+	log.flush();
+	if (!log)
+		throw std::runtime_error("Could not write to " + pathName);
+}
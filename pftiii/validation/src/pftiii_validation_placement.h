@@ -0,0 +1,122 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_PLACEMENT_H_
+#define PFTIII_VALIDATION_PLACEMENT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/** Ways to pin workers to hardware threads. */
+		enum class Pinning
+		{
+			/** Workers run wherever the kernel schedules them. */
+			None,
+			/** One worker per core, leaving SMT siblings idle. */
+			Core,
+			/** One worker per hardware thread, SMT siblings too. */
+			Thread
+		};
+
+		/** Where a worker runs. */
+		struct Placement
+		{
+			/** Hardware thread the worker is pinned to. */
+			uint32_t cpu{};
+			/** Core of `cpu`, numbered within its package. */
+			uint32_t core{};
+			/** Package (socket) of `cpu`. */
+			uint32_t package{};
+			/** NUMA node of `cpu`. */
+			uint32_t node{};
+			/** Whether memory is allocated only from `node`. */
+			bool bindMemory{false};
+		};
+
+		/**
+		 * @brief
+		 * Choose where workers run.
+		 *
+		 * @param pinning
+		 * How to pin workers, other than Pinning::None.
+		 * @param count
+		 * Number of workers.
+		 * @param bindMemory
+		 * Whether each worker's memory is allocated only from the
+		 * NUMA node of its hardware thread.
+		 *
+		 * @return
+		 * Placement of each worker.
+		 *
+		 * @throw runtime_error
+		 * There are fewer cores or hardware threads than workers.
+		 *
+		 * @note
+		 * Only hardware threads this process may run on are used.
+		 * They are filled in order of NUMA node, package, core, and
+		 * hardware thread, so workers share as few nodes as they
+		 * can, and Pinning::Thread fills both SMT siblings of a core
+		 * before the next. The same topology always gives the same
+		 * placements.
+		 */
+		std::vector<Placement>
+		getPlacements(
+		    const Pinning pinning,
+		    const uint8_t count,
+		    const bool bindMemory);
+
+		/**
+		 * @brief
+		 * Pin the calling thread as placed.
+		 *
+		 * @param placement
+		 * Where to run. Threads the caller starts afterward
+		 * inherit the placement.
+		 *
+		 * @throw runtime_error
+		 * Error pinning the thread or binding its memory.
+		 *
+		 * @note
+		 * Binding memory affects only memory allocated afterward,
+		 * not pages already touched, such as those shared
+		 * copy-on-write with a parent process.
+		 */
+		void
+		applyPlacement(
+		    const Placement &placement);
+
+		/**
+		 * @brief
+		 * Record placements, so that timings can be reproduced.
+		 *
+		 * @param pathName
+		 * Path to a CSV file to write.
+		 * @param pinning
+		 * How the placements were chosen.
+		 * @param placements
+		 * Placement of each worker, by worker number.
+		 *
+		 * @throw runtime_error
+		 * Error writing to `pathName`.
+		 */
+		void
+		writePlacements(
+		    const std::string &pathName,
+		    const Pinning pinning,
+		    const std::vector<Placement> &placements);
+	}
+}
+
+#endif /* PFTIII_VALIDATION_PLACEMENT_H_ */
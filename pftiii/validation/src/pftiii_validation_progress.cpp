@@ -0,0 +1,214 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <iomanip>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <stop_token>
+#include <tuple>
+
+#include <pftiii_validation_progress.h>
+#include <pftiii_validation_utils.h>
+
+namespace
+{
+	/** Fraction of the median rate below which a worker is slow. */
+	constexpr double SlowFraction{0.5};
+
+	/** @return `latency`, briefly, in a sensible unit. */
+	std::string
+	formatLatency(
+	    const std::chrono::microseconds latency)
+	{
+		const auto us = static_cast<double>(latency.count());
+		std::ostringstream ss{};
+		ss << std::fixed << std::setprecision(1);
+		if (latency.count() < 1000)
+			ss << latency.count() << "us";
+		else if (latency.count() < 1000000)
+			ss << (us / 1e3) << "ms";
+		else
+			ss << (us / 1e6) << 's';
+		return (ss.str());
+	}
+}
+
+PFTIII::Validation::ProgressReporter::ProgressReporter(
+    WorkerStatusTable &statuses,
+    const uint64_t total,
+    const std::chrono::seconds interval,
+    std::ostream &stream) :
+    statuses{statuses},
+    total{total},
+    interval{interval},
+    stream{stream},
+    start{std::chrono::steady_clock::now()},
+    last{start},
+    lastCompleted(statuses.size())
+{
+	for (uint8_t i{0}; i < statuses.size(); ++i)
+		this->lastCompleted[i] = statuses[i].completed.load(
+		    std::memory_order_relaxed);
+}
+
+void
+PFTIII::Validation::ProgressReporter::update()
+{
+	const auto now = std::chrono::steady_clock::now();
+	if ((now - this->last) < this->interval)
+		return;
+	const double window{std::chrono::duration<double>(now -
+	    this->last).count()};
+	const double elapsed{std::chrono::duration<double>(now -
+	    this->start).count()};
+	this->last = now;
+
+	/* Rates over the window, of the workers still busy */
+	uint64_t completed{0};
+	uint64_t recent{0};
+	std::vector<std::tuple<uint8_t, double>> busy{};
+	for (uint8_t i{0}; i < this->statuses.size(); ++i) {
+		const auto &status = this->statuses[i];
+		const uint64_t count{status.completed.load(
+		    std::memory_order_relaxed)};
+		const uint64_t delta{count - this->lastCompleted[i]};
+		this->lastCompleted[i] = count;
+		completed += count;
+		recent += delta;
+		if (status.item.load(std::memory_order_relaxed) !=
+		    WorkerStatus::Idle)
+			busy.emplace_back(i, static_cast<double>(delta) /
+			    window);
+	}
+
+	std::ostringstream ss{};
+	ss << std::fixed << std::setprecision(1) << "Progress: " <<
+	    completed << '/' << this->total << " (" << ((this->total == 0) ?
+	    100.0 : (100.0 * static_cast<double>(completed) /
+	    static_cast<double>(this->total))) << "%), " <<
+	    (static_cast<double>(recent) / window) << "/s, ETA ";
+	const double rate{static_cast<double>(completed) / elapsed};
+	if (completed >= this->total)
+		ss << "0s";
+	else if (rate > 0)
+		ss << formatDuration(std::chrono::seconds{static_cast<
+		    int64_t>(static_cast<double>(this->total - completed) /
+		    rate)});
+	else
+		ss << "unknown";
+	ss << this->getLatencies() << '\n';
+
+	/* A single worker has nothing to be compared with */
+	if (busy.size() > 1) {
+		std::vector<double> rates{};
+		for (const auto &[worker, workerRate] : busy)
+			rates.push_back(workerRate);
+		const auto middle = std::next(rates.begin(),
+		    static_cast<std::ptrdiff_t>(rates.size() / 2));
+		std::nth_element(rates.begin(), middle, rates.end());
+		const double median{*middle};
+
+		for (const auto &[worker, workerRate] : busy)
+			if (workerRate < (SlowFraction * median))
+				ss << "Progress: worker " << ts(worker) <<
+				    " is slow (" << workerRate << "/s, median "
+				    << median << "/s)\n";
+	}
+
+	this->stream << ss.str() << std::flush;
+}
+
+void
+PFTIII::Validation::ProgressReporter::finish()
+{
+	const double elapsed{std::chrono::duration<double>(
+	    std::chrono::steady_clock::now() - this->start).count()};
+	uint64_t completed{0};
+	for (uint8_t i{0}; i < this->statuses.size(); ++i)
+		completed += this->statuses[i].completed.load(
+		    std::memory_order_relaxed);
+
+	std::ostringstream ss{};
+	ss << std::fixed << std::setprecision(1) << "Progress: finished " <<
+	    completed << '/' << this->total << " in " << formatDuration(
+	    std::chrono::seconds{static_cast<int64_t>(elapsed)}) << " (" <<
+	    ((elapsed > 0) ? (static_cast<double>(completed) / elapsed) :
+	    0.0) << "/s)" <<
+	    this->getLatencies() << '\n';
+	this->stream << ss.str() << std::flush;
+}
+
+std::string
+PFTIII::Validation::ProgressReporter::formatDuration(
+    const std::chrono::seconds duration)
+{
+	const auto hours = std::chrono::duration_cast<std::chrono::hours>(
+	    duration);
+	const auto minutes = std::chrono::duration_cast<
+	    std::chrono::minutes>(duration - hours);
+	const auto seconds = duration - hours - minutes;
+
+	std::ostringstream ss{};
+	ss << std::setfill('0');
+	if (hours.count() > 0)
+		ss << hours.count() << 'h' << std::setw(2);
+	if ((hours.count() > 0) || (minutes.count() > 0))
+		ss << minutes.count() << 'm' << std::setw(2);
+	ss << seconds.count() << 's';
+	return (ss.str());
+}
+
+std::string
+PFTIII::Validation::ProgressReporter::getLatencies()
+{
+	std::array<uint64_t, LatencyHistogram::Buckets> counts{};
+	uint64_t calls{0};
+	for (uint8_t i{0}; i < this->statuses.size(); ++i) {
+		for (std::size_t b{0}; b < LatencyHistogram::Buckets; ++b) {
+			const uint64_t count{this->statuses[i].latencies.
+			    counts[b].load(std::memory_order_relaxed)};
+			counts[b] += count;
+			calls += count;
+		}
+	}
+	if (calls == 0)
+		return ("");
+
+	/* Each percentile is the upper bound of the bucket reaching it */
+	std::string latencies{"; calls"};
+	for (const uint64_t percentile : {50u, 90u, 99u}) {
+		const uint64_t rank{((calls * percentile) + 99) / 100};
+		uint64_t seen{0};
+		std::size_t bucket{0};
+		while ((seen += counts[bucket]) < rank)
+			++bucket;
+		latencies += " p" + ts(percentile) + ' ' + formatLatency(
+		    LatencyHistogram::getUpperBound(bucket));
+	}
+	return (latencies);
+}
+
+std::jthread
+PFTIII::Validation::startTicking(
+    const TickHandler &onTick)
+{
+	return (std::jthread{[&onTick](const std::stop_token stop) {
+		std::mutex mutex{};
+		std::condition_variable_any wakeup{};
+		std::unique_lock lock{mutex};
+		while (!wakeup.wait_for(lock, stop, std::chrono::seconds{1},
+		    []() { return (false); }) && !stop.stop_requested())
+			onTick();
+	}});
+}
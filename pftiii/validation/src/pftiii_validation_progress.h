@@ -0,0 +1,136 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_PROGRESS_H_
+#define PFTIII_VALIDATION_PROGRESS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pftiii_validation_supervisor.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * Periodically summarize the work reported in a
+		 * WorkerStatusTable.
+		 *
+		 * @details
+		 * Each report gives the items finished, the rate over the
+		 * last interval, the estimated time remaining at the rate
+		 * since the start, and percentiles of the time taken by
+		 * each call to the implementation. Workers busy on an item
+		 * whose rate over the interval falls below half the median
+		 * rate are reported as slow.
+		 */
+		class ProgressReporter
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param statuses
+			 * Statuses of the workers, which must outlive this
+			 * object.
+			 * @param total
+			 * Number of items the workers will finish.
+			 * @param interval
+			 * Minimum time between reports.
+			 * @param stream
+			 * Where to write reports.
+			 */
+			ProgressReporter(
+			    WorkerStatusTable &statuses,
+			    const uint64_t total,
+			    const std::chrono::seconds interval,
+			    std::ostream &stream = std::cerr);
+
+			/**
+			 * @brief
+			 * Report, if the interval has elapsed since the
+			 * last report.
+			 */
+			void
+			update();
+
+			/**
+			 * @brief
+			 * Report the items finished, overall rate, and call
+			 * percentiles since construction.
+			 */
+			void
+			finish();
+
+			/**
+			 * @brief
+			 * Describe a duration briefly, e.g., "1h02m03s".
+			 *
+			 * @param duration
+			 * Duration to describe.
+			 *
+			 * @return
+			 * Hours, minutes, and seconds, omitting leading
+			 * zero units.
+			 */
+			static std::string
+			formatDuration(
+			    const std::chrono::seconds duration);
+
+		private:
+			/** Statuses of the workers. */
+			WorkerStatusTable &statuses;
+			/** Number of items the workers will finish. */
+			const uint64_t total;
+			/** Minimum time between reports. */
+			const std::chrono::seconds interval;
+			/** Where to write reports. */
+			std::ostream &stream;
+
+			/** Time of construction. */
+			const std::chrono::steady_clock::time_point start;
+			/** Time of the last report. */
+			std::chrono::steady_clock::time_point last;
+			/** Items finished by each worker at the last report. */
+			std::vector<uint64_t> lastCompleted;
+
+			/**
+			 * @return
+			 * Percentiles of the call durations of all workers.
+			 */
+			std::string
+			getLatencies();
+		};
+
+		/**
+		 * @brief
+		 * Call a function about once a second from another thread,
+		 * for work that leaves no thread of its own free to do so.
+		 *
+		 * @param onTick
+		 * Function to call, which must outlive the thread.
+		 *
+		 * @return
+		 * The thread, which stops when destroyed or assigned to.
+		 */
+		std::jthread
+		startTicking(
+		    const TickHandler &onTick);
+	}
+}
+
+#endif /* PFTIII_VALIDATION_PROGRESS_H_ */
@@ -0,0 +1,163 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <pftiii_validation_scheduler.h>
+
+namespace
+{
+	/** Queue drained by the installed SignalDrain, if any. */
+	std::atomic<PFTIII::Validation::WorkQueue*> drainedQueue{nullptr};
+
+	/** Signal handler installed by SignalDrain. */
+	void
+	drainOnSignal(
+	    int)
+	{
+		if (auto queue = drainedQueue.load())
+			queue->drain();
+	}
+}
+
+PFTIII::Validation::WorkQueue::WorkQueue(
+    const uint64_t first,
+    const uint64_t last,
+    const uint64_t chunkSize) :
+    last{last},
+    count{last - first},
+    chunkSize{chunkSize}
+{
+	if (chunkSize == 0)
+		throw std::invalid_argument("Chunk size cannot be 0");
+	if (last < first)
+		throw std::invalid_argument("Work queue range is reversed");
+
+	void *shared = mmap(nullptr, sizeof(*this->shared),
+	    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (shared == MAP_FAILED)
+		throw std::runtime_error("Could not map shared memory for "
+		    "work queue (" + std::system_error(errno,
+		    std::system_category()).code().message() + ")");
+	this->shared = new (shared) Shared{{first}, {false}};
+}
+
+std::optional<std::tuple<uint64_t, uint64_t>>
+PFTIII::Validation::WorkQueue::claim()
+{
+	if (this->isDraining())
+		return (std::nullopt);
+
+	/* Only uniqueness matters, so no ordering is required */
+	const uint64_t first{this->shared->cursor.fetch_add(this->chunkSize,
+	    std::memory_order_relaxed)};
+	if (first >= this->last)
+		return (std::nullopt);
+
+	return (std::make_tuple(first, std::min(first + this->chunkSize,
+	    this->last)));
+}
+
+void
+PFTIII::Validation::WorkQueue::drain()
+{
+	this->shared->draining.store(true, std::memory_order_relaxed);
+}
+
+bool
+PFTIII::Validation::WorkQueue::isDraining()
+    const
+{
+	return (this->shared->draining.load(std::memory_order_relaxed));
+}
+
+bool
+PFTIII::Validation::WorkQueue::isExhausted()
+    const
+{
+	return (this->shared->cursor.load(std::memory_order_relaxed) >=
+	    this->last);
+}
+
+uint64_t
+PFTIII::Validation::WorkQueue::size()
+    const
+{
+	return (this->count);
+}
+
+PFTIII::Validation::WorkQueue::~WorkQueue()
+{
+	munmap(this->shared, sizeof(*this->shared));
+}
+
+PFTIII::Validation::SignalDrain::SignalDrain(
+    WorkQueue &queue,
+    const int signalNumber) :
+    signalNumber{signalNumber}
+{
+	drainedQueue = &queue;
+
+	struct sigaction action{};
+	action.sa_handler = drainOnSignal;
+	sigemptyset(&action.sa_mask);
+	action.sa_flags = SA_RESTART;
+	if (::sigaction(signalNumber, &action, &this->previous) != 0) {
+		drainedQueue = nullptr;
+		throw std::runtime_error("Could not install signal handler (" +
+		    std::system_error(errno, std::system_category()).code().
+		    message() + ")");
+	}
+}
+
+PFTIII::Validation::SignalDrain::~SignalDrain()
+{
+	::sigaction(this->signalNumber, &this->previous, nullptr);
+	drainedQueue = nullptr;
+}
+
+uint64_t
+PFTIII::Validation::getChunkSize(
+    const uint64_t size,
+    const uint64_t numWorkers)
+{
+	/* Aim for many claims per worker, so stragglers hold little work */
+	static constexpr uint64_t ClaimsPerWorker{32};
+
+	return (std::max<uint64_t>(1, size / (std::max<uint64_t>(1,
+	    numWorkers) * ClaimsPerWorker)));
+}
+
+std::tuple<uint64_t, uint64_t>
+PFTIII::Validation::getShard(
+    const uint64_t size,
+    const uint64_t index,
+    const uint64_t count)
+{
+	if (count == 0)
+		throw std::invalid_argument("Number of shards cannot be 0");
+	if (index >= count)
+		throw std::invalid_argument("Shard " + std::to_string(index) +
+		    " does not exist when there are " + std::to_string(count) +
+		    " shards");
+
+	/* The first size % count shards take one extra position */
+	const uint64_t base{size / count};
+	const uint64_t extra{size % count};
+	const uint64_t first{(base * index) + std::min(index, extra)};
+	return {first, first + base + ((index < extra) ? 1 : 0)};
+}
@@ -0,0 +1,223 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_SCHEDULER_H_
+#define PFTIII_VALIDATION_SCHEDULER_H_
+
+#include <csignal>
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * Hands out consecutive chunks of positions to workers on
+		 * demand.
+		 *
+		 * @details
+		 * The cursor lives in anonymous shared memory, so a single
+		 * WorkQueue may be shared between threads and between
+		 * processes fork()ed after its construction. Workers that
+		 * finish early claim more work, so a run finishes when the
+		 * total work is done rather than when the slowest static
+		 * partition is done.
+		 */
+		class WorkQueue
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param first
+			 * First position to hand out.
+			 * @param last
+			 * One past the last position to hand out.
+			 * @param chunkSize
+			 * Number of positions handed out per claim.
+			 *
+			 * @throw runtime_error
+			 * Could not map shared memory.
+			 * @throw invalid_argument
+			 * chunkSize is 0, or `last` precedes `first`.
+			 */
+			WorkQueue(
+			    const uint64_t first,
+			    const uint64_t last,
+			    const uint64_t chunkSize = 1);
+
+			/**
+			 * @brief
+			 * Claim the next chunk of positions.
+			 *
+			 * @return
+			 * Half-open range [first, last) of positions that no
+			 * other worker will receive, or std::nullopt when all
+			 * positions have been claimed or the queue is
+			 * draining.
+			 */
+			std::optional<std::tuple<uint64_t, uint64_t>>
+			claim();
+
+			/**
+			 * @brief
+			 * Stop handing out positions to every worker sharing
+			 * this queue. Chunks already claimed are unaffected.
+			 *
+			 * @note
+			 * Async-signal-safe.
+			 */
+			void
+			drain();
+
+			/** @return Whether drain() has been called. */
+			bool
+			isDraining()
+			    const;
+
+			/** @return Whether every position has been claimed. */
+			bool
+			isExhausted()
+			    const;
+
+			/** @return Number of positions handed out in total. */
+			uint64_t
+			size()
+			    const;
+
+			~WorkQueue();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			WorkQueue(const WorkQueue&) = delete;
+			WorkQueue& operator=(const WorkQueue&) = delete;
+			/** @endcond */
+
+		private:
+			/* Cross-process atomics must not fall back to locks */
+			static_assert(std::atomic<uint64_t>::is_always_lock_free);
+			static_assert(std::atomic<bool>::is_always_lock_free);
+
+			/** State shared by every worker. */
+			struct Shared
+			{
+				/** Next unclaimed position. */
+				std::atomic<uint64_t> cursor;
+				/** Whether to stop handing out positions. */
+				std::atomic<bool> draining;
+			};
+
+			/** Shared state, in shared memory. */
+			Shared *shared{};
+			/** One past the last position. */
+			const uint64_t last;
+			/** Number of positions. */
+			const uint64_t count;
+			/** Positions handed out per claim. */
+			const uint64_t chunkSize;
+		};
+
+		/**
+		 * @brief
+		 * Drains a WorkQueue when the process receives a signal,
+		 * for the lifetime of this object.
+		 *
+		 * @details
+		 * Workers finish the chunks they have claimed and return,
+		 * rather than dying mid-item, so a preempted run can save
+		 * its progress. The handler is inherited by processes
+		 * fork()ed while it is installed, and all of them drain the
+		 * same shared queue. Only one may exist at a time.
+		 */
+		class SignalDrain
+		{
+		public:
+			/**
+			 * @brief
+			 * Install the signal handler.
+			 *
+			 * @param queue
+			 * Queue to drain, which must outlive this object.
+			 * @param signalNumber
+			 * Signal that drains `queue`.
+			 *
+			 * @throw runtime_error
+			 * Could not install the handler.
+			 */
+			SignalDrain(
+			    WorkQueue &queue,
+			    const int signalNumber = SIGTERM);
+
+			/** Restore the previous signal handler. */
+			~SignalDrain();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			SignalDrain(const SignalDrain&) = delete;
+			SignalDrain& operator=(const SignalDrain&) = delete;
+			/** @endcond */
+
+		private:
+			/** Signal handled. */
+			const int signalNumber;
+			/** Handler in place before construction. */
+			struct sigaction previous{};
+		};
+
+		/**
+		 * @brief
+		 * Choose a claim size for a number of positions and workers.
+		 *
+		 * @param size
+		 * Number of positions.
+		 * @param numWorkers
+		 * Number of workers sharing the WorkQueue.
+		 *
+		 * @return
+		 * Chunk size small enough that workers finish at nearly the
+		 * same time, but large enough to amortize claiming.
+		 */
+		uint64_t
+		getChunkSize(
+		    const uint64_t size,
+		    const uint64_t numWorkers);
+
+		/**
+		 * @brief
+		 * Divide positions between independent runs.
+		 *
+		 * @param size
+		 * Number of positions, [0, size), to divide.
+		 * @param index
+		 * Shard to return, in [0, `count`).
+		 * @param count
+		 * Number of shards.
+		 *
+		 * @return
+		 * Half-open range [first, last) of positions in shard
+		 * `index`. Shards are contiguous, disjoint, cover every
+		 * position, and differ in size by at most one.
+		 *
+		 * @throw invalid_argument
+		 * `count` is 0 or `index` is not less than `count`.
+		 */
+		std::tuple<uint64_t, uint64_t>
+		getShard(
+		    const uint64_t size,
+		    const uint64_t index,
+		    const uint64_t count);
+	}
+}
+
+#endif /* PFTIII_VALIDATION_SCHEDULER_H_ */
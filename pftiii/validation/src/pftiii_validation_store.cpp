@@ -0,0 +1,126 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <sys/mman.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <pftiii_validation_store.h>
+
+namespace
+{
+	/** @return Description of the current errno. */
+	std::string
+	errnoMessage()
+	{
+		return (std::system_error(errno, std::system_category()).
+		    code().message());
+	}
+}
+
+PFTIII::Validation::SharedTemplateStore::SharedTemplateStore(
+    const std::vector<std::string> &names,
+    const TemplateCache::Loader &loader)
+{
+	const int fd{::memfd_create("pftiii_templates", MFD_CLOEXEC |
+	    MFD_ALLOW_SEALING)};
+	if (fd == -1)
+		throw std::runtime_error("Could not create shared template "
+		    "store (" + errnoMessage() + ")");
+
+	try {
+		/* Load one template at a time, so only the store is resident */
+		for (const auto &name : names) {
+			if (this->index.contains(name))
+				continue;
+
+			const auto data = loader(name);
+			uint64_t done{0};
+			while (done < data.size()) {
+				const ssize_t count{::pwrite(fd,
+				    data.data() + done, data.size() - done,
+				    static_cast<off_t>(this->length + done))};
+				if (count == -1) {
+					if (errno == EINTR)
+						continue;
+					throw std::runtime_error("Could not "
+					    "write to shared template store (" +
+					    errnoMessage() + ")");
+				}
+				done += static_cast<uint64_t>(count);
+			}
+
+			this->index[name] = {this->length, data.size()};
+			this->length += data.size();
+		}
+
+		/* No process may change the templates from here on */
+		if (::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW |
+		    F_SEAL_WRITE | F_SEAL_SEAL) != 0)
+			throw std::runtime_error("Could not seal shared "
+			    "template store (" + errnoMessage() + ")");
+
+		if (this->length != 0) {
+			void *address{::mmap(nullptr, this->length, PROT_READ,
+			    MAP_SHARED, fd, 0)};
+			if (address == MAP_FAILED)
+				throw std::runtime_error("Could not map shared "
+				    "template store (" + errnoMessage() + ")");
+			this->address = static_cast<std::byte*>(address);
+		}
+	} catch (...) {
+		::close(fd);
+		throw;
+	}
+
+	/* The mapping holds its own reference to the memfd */
+	::close(fd);
+}
+
+std::span<const std::byte>
+PFTIII::Validation::SharedTemplateStore::view(
+    const std::string &name)
+    const
+{
+	const auto it = this->index.find(name);
+	if (it == this->index.end())
+		throw std::runtime_error("No template named " + name + " in "
+		    "shared template store");
+
+	const auto [offset, length] = it->second;
+	return {this->address + offset, length};
+}
+
+std::vector<std::byte>
+PFTIII::Validation::SharedTemplateStore::read(
+    const std::string &name)
+    const
+{
+	const auto data = this->view(name);
+	return {data.begin(), data.end()};
+}
+
+uint64_t
+PFTIII::Validation::SharedTemplateStore::size()
+    const
+{
+	return (this->length);
+}
+
+PFTIII::Validation::SharedTemplateStore::~SharedTemplateStore()
+{
+	if (this->address != nullptr)
+		::munmap(this->address, this->length);
+}
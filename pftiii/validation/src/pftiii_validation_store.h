@@ -0,0 +1,122 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_STORE_H_
+#define PFTIII_VALIDATION_STORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <pftiii_validation_cache.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * Templates loaded once into sealed, read-only shared memory.
+		 *
+		 * @details
+		 * Templates are copied into a memfd that is then sealed
+		 * against modification and mapped read-only. Processes
+		 * fork()ed after construction share the same physical
+		 * pages, so a gallery occupies memory once per machine
+		 * rather than once per process.
+		 */
+		class SharedTemplateStore
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param names
+			 * Names of templates to load.
+			 * @param loader
+			 * Function that reads a template from storage.
+			 *
+			 * @throw runtime_error
+			 * Error loading a template, or creating, sealing, or
+			 * mapping shared memory.
+			 */
+			SharedTemplateStore(
+			    const std::vector<std::string> &names,
+			    const TemplateCache::Loader &loader);
+
+			/**
+			 * @brief
+			 * Obtain a template without copying.
+			 *
+			 * @param name
+			 * Name of the template.
+			 *
+			 * @return
+			 * View of the template, valid for the lifetime of this
+			 * object.
+			 *
+			 * @throw runtime_error
+			 * `name` was not loaded.
+			 */
+			std::span<const std::byte>
+			view(
+			    const std::string &name)
+			    const;
+
+			/**
+			 * @brief
+			 * Read a template.
+			 *
+			 * @param name
+			 * Name of the template.
+			 *
+			 * @return
+			 * Copy of the template.
+			 *
+			 * @throw runtime_error
+			 * `name` was not loaded.
+			 */
+			std::vector<std::byte>
+			read(
+			    const std::string &name)
+			    const;
+
+			/** @return Total bytes of templates in the store. */
+			uint64_t
+			size()
+			    const;
+
+			~SharedTemplateStore();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			SharedTemplateStore(
+			    const SharedTemplateStore&) = delete;
+			SharedTemplateStore& operator=(
+			    const SharedTemplateStore&) = delete;
+			/** @endcond */
+
+		private:
+			/** Start of the mapping, or nullptr if empty. */
+			std::byte *address{nullptr};
+			/** Size of the mapping, in bytes. */
+			uint64_t length{};
+			/** Offset and length of each template, by name. */
+			std::unordered_map<std::string,
+			    std::tuple<uint64_t, uint64_t>> index{};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_STORE_H_ */
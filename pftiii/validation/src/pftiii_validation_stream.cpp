@@ -0,0 +1,135 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include <pftiii_validation_stream.h>
+
+namespace
+{
+	/**
+	 * @return
+	 * Distinct images of a pair, since a template compared with
+	 * itself is needed only once.
+	 */
+	std::vector<uint64_t>
+	getDistinctImages(
+	    const std::tuple<uint64_t, uint64_t> &pair)
+	{
+		const auto &[probe, reference] = pair;
+		if (probe == reference)
+			return {probe};
+		return {probe, reference};
+	}
+}
+
+PFTIII::Validation::StreamScheduler::StreamScheduler(
+    const std::vector<uint64_t> &createOrder,
+    const std::vector<std::tuple<uint64_t, uint64_t>> &pairImages) :
+    createOrder{createOrder},
+    pairImages{pairImages},
+    missing(pairImages.size())
+{
+	const std::unordered_set<uint64_t> images(createOrder.cbegin(),
+	    createOrder.cend());
+	for (uint64_t pair{0}; pair < pairImages.size(); ++pair) {
+		for (const auto &image : getDistinctImages(
+		    pairImages[pair])) {
+			if (!images.contains(image))
+				throw std::invalid_argument("Image " +
+				    std::to_string(image) + " of pair " +
+				    std::to_string(pair) + " is never "
+				    "created");
+			this->dependents[image].push_back(pair);
+			++this->pending[image];
+			++this->missing[pair];
+		}
+	}
+}
+
+std::optional<PFTIII::Validation::StreamScheduler::Task>
+PFTIII::Validation::StreamScheduler::next()
+{
+	std::unique_lock lock{this->mutex};
+	this->changed.wait(lock, [this]() {
+		return (this->aborted || !this->ready.empty() ||
+		    (this->nextCreate < this->createOrder.size()) ||
+		    (this->creating == 0));
+	});
+	if (this->aborted)
+		return (std::nullopt);
+
+	/* Comparing first releases templates soonest */
+	if (!this->ready.empty()) {
+		const uint64_t pair{this->ready.front()};
+		this->ready.pop_front();
+		const auto &[probe, reference] = this->pairImages[pair];
+		return (Task{Task::Kind::Compare, pair,
+		    this->templates.at(probe), this->templates.at(reference)});
+	}
+	if (this->nextCreate < this->createOrder.size()) {
+		++this->creating;
+		return (Task{Task::Kind::Create,
+		    this->createOrder[this->nextCreate++], {}, {}});
+	}
+
+	/* Nothing ready, nothing to create, and nothing being created */
+	return (std::nullopt);
+}
+
+void
+PFTIII::Validation::StreamScheduler::created(
+    const uint64_t image,
+    TemplateCache::Template proprietaryTemplate)
+{
+	{
+		std::lock_guard lock{this->mutex};
+		--this->creating;
+
+		const auto it = this->dependents.find(image);
+		if (it != this->dependents.end()) {
+			this->templates[image] = std::move(
+			    proprietaryTemplate);
+			for (const auto &pair : it->second)
+				if (--this->missing[pair] == 0)
+					this->ready.push_back(pair);
+			this->dependents.erase(it);
+		}
+	}
+
+	/* Pairs became ready, or the last image was created */
+	this->changed.notify_all();
+}
+
+void
+PFTIII::Validation::StreamScheduler::compared(
+    const uint64_t pair)
+{
+	std::lock_guard lock{this->mutex};
+	for (const auto &image : getDistinctImages(
+	    this->pairImages[pair])) {
+		if (--this->pending.at(image) == 0) {
+			this->pending.erase(image);
+			this->templates.erase(image);
+		}
+	}
+}
+
+void
+PFTIII::Validation::StreamScheduler::abort()
+{
+	{
+		std::lock_guard lock{this->mutex};
+		this->aborted = true;
+	}
+	this->changed.notify_all();
+}
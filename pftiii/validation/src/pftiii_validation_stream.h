@@ -0,0 +1,169 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_STREAM_H_
+#define PFTIII_VALIDATION_STREAM_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <pftiii_validation_cache.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * Interleave creating templates with comparing them.
+		 *
+		 * @details
+		 * Images are handed out for creation in a fixed order, and
+		 * each pair is handed out for comparison as soon as both of
+		 * its templates exist. Comparisons are preferred over
+		 * creation, and a template is released once every pair
+		 * using it has been compared, so templates stay in memory
+		 * only while they are needed. A StreamScheduler may be
+		 * shared between threads.
+		 */
+		class StreamScheduler
+		{
+		public:
+			/** Work handed to a worker. */
+			struct Task
+			{
+				/** Kinds of work. */
+				enum class Kind
+				{
+					/** Create a template from an image. */
+					Create,
+					/** Compare the templates of a pair. */
+					Compare
+				};
+
+				/** Kind of work. */
+				Kind kind{};
+				/**
+				 * Index of an image (Kind::Create) or pair
+				 * (Kind::Compare) of the dataset.
+				 */
+				uint64_t index{};
+				/** Probe template, for Kind::Compare. */
+				TemplateCache::Template probe{};
+				/** Reference template, for Kind::Compare. */
+				TemplateCache::Template reference{};
+			};
+
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param createOrder
+			 * Images to create, in the order to create them.
+			 * @param pairImages
+			 * Images of the probe and reference of each pair
+			 * to compare, indexed as in `createOrder`.
+			 *
+			 * @throw invalid_argument
+			 * An image of a pair is not in `createOrder`, so
+			 * the pair could never be compared.
+			 */
+			StreamScheduler(
+			    const std::vector<uint64_t> &createOrder,
+			    const std::vector<std::tuple<uint64_t, uint64_t>>
+			        &pairImages);
+
+			/**
+			 * @brief
+			 * Obtain the next task, waiting while none is ready
+			 * but some may become ready.
+			 *
+			 * @return
+			 * The next task, or std::nullopt once every task has
+			 * been handed out or abort() was called.
+			 */
+			std::optional<Task>
+			next();
+
+			/**
+			 * @brief
+			 * Report that a template was created.
+			 *
+			 * @param image
+			 * Image of a Task::Kind::Create task from next().
+			 * @param proprietaryTemplate
+			 * Template created, empty if creation failed. It is
+			 * kept until all pairs using it are compared.
+			 */
+			void
+			created(
+			    const uint64_t image,
+			    TemplateCache::Template proprietaryTemplate);
+
+			/**
+			 * @brief
+			 * Report that a pair was compared.
+			 *
+			 * @param pair
+			 * Pair of a Task::Kind::Compare task from next().
+			 */
+			void
+			compared(
+			    const uint64_t pair);
+
+			/**
+			 * @brief
+			 * Stop handing out tasks, e.g., after a worker fails.
+			 */
+			void
+			abort();
+
+		private:
+			/** Images to create, in order. */
+			const std::vector<uint64_t> createOrder;
+			/** Images of each pair. */
+			const std::vector<std::tuple<uint64_t, uint64_t>>
+			    pairImages;
+
+			/** Pairs using each image. */
+			std::unordered_map<uint64_t, std::vector<uint64_t>>
+			    dependents{};
+			/** Templates of each pair yet to be created. */
+			std::vector<uint8_t> missing{};
+			/** Pairs using each image yet to be compared. */
+			std::unordered_map<uint64_t, uint64_t> pending{};
+			/** Templates created and still needed. */
+			std::unordered_map<uint64_t, TemplateCache::Template>
+			    templates{};
+
+			/** Pairs whose templates both exist. */
+			std::deque<uint64_t> ready{};
+			/** Position in createOrder of the next image. */
+			uint64_t nextCreate{0};
+			/** Images handed out but not yet created. */
+			uint64_t creating{0};
+			/** Whether abort() was called. */
+			bool aborted{false};
+
+			/** Protects everything above. */
+			std::mutex mutex{};
+			/** Signaled when a task may have become ready. */
+			std::condition_variable changed{};
+		};
+	}
+}
+
+#endif /* PFTIII_VALIDATION_STREAM_H_ */
@@ -0,0 +1,398 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_set>
+
+#include <pftiii_validation_supervisor.h>
+
+namespace
+{
+	/** @return Current time, in steady_clock nanoseconds. */
+	int64_t
+	now()
+	{
+		return (std::chrono::duration_cast<std::chrono::nanoseconds>(
+		    std::chrono::steady_clock::now().time_since_epoch()).
+		    count());
+	}
+
+	/** @return Description of errno. */
+	std::string
+	getErrorMessage()
+	{
+		return (std::system_error(errno, std::system_category()).
+		    code().message());
+	}
+}
+
+void
+PFTIII::Validation::LatencyHistogram::record(
+    const std::chrono::nanoseconds latency)
+{
+	this->counts[getBucket(latency)].fetch_add(1,
+	    std::memory_order_relaxed);
+}
+
+std::size_t
+PFTIII::Validation::LatencyHistogram::getBucket(
+    const std::chrono::nanoseconds latency)
+{
+	const auto us = static_cast<uint64_t>(std::max<int64_t>(0,
+	    std::chrono::duration_cast<std::chrono::microseconds>(
+	    latency).count()));
+	if (us < 4)
+		return (us);
+
+	/* Power of two, then the two bits below the leading one */
+	const auto exponent = static_cast<std::size_t>(std::bit_width(us) -
+	    1);
+	const std::size_t bucket{(4 * (exponent - 1)) +
+	    ((us >> (exponent - 2)) & 3)};
+	return (std::min(bucket, Buckets - 1));
+}
+
+std::chrono::microseconds
+PFTIII::Validation::LatencyHistogram::getUpperBound(
+    const std::size_t bucket)
+{
+	if (bucket < 4)
+		return (std::chrono::microseconds{bucket + 1});
+
+	const std::size_t exponent{(bucket / 4) + 1};
+	return (std::chrono::microseconds{((4 + (bucket % 4) + 1) <<
+	    (exponent - 2))});
+}
+
+void
+PFTIII::Validation::WorkerStatus::begin(
+    const uint64_t item)
+{
+	/* Publish the start time before the item that it times */
+	this->started.store(now(), std::memory_order_relaxed);
+	this->item.store(item, std::memory_order_release);
+}
+
+void
+PFTIII::Validation::WorkerStatus::returned()
+{
+	this->latencies.record(std::chrono::nanoseconds{now() -
+	    this->started.load(std::memory_order_relaxed)});
+}
+
+void
+PFTIII::Validation::WorkerStatus::end(
+    const uint64_t item)
+{
+	uint64_t expected{item};
+	this->item.compare_exchange_strong(expected, Idle,
+	    std::memory_order_release, std::memory_order_relaxed);
+	this->completed.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+PFTIII::Validation::WorkerStatus::reset()
+{
+	this->item.store(Idle, std::memory_order_relaxed);
+	this->started.store(0, std::memory_order_relaxed);
+}
+
+PFTIII::Validation::WorkerStatusTable::WorkerStatusTable(
+    const uint8_t size) :
+    count{size}
+{
+	void *shared = ::mmap(nullptr, sizeof(WorkerStatus) * std::max<
+	    uint8_t>(size, 1), PROT_READ | PROT_WRITE, MAP_SHARED |
+	    MAP_ANONYMOUS, -1, 0);
+	if (shared == MAP_FAILED)
+		throw std::runtime_error("Could not map shared memory for "
+		    "worker statuses (" + getErrorMessage() + ")");
+
+	this->statuses = static_cast<WorkerStatus*>(shared);
+	for (uint8_t i{0}; i < size; ++i)
+		new (&this->statuses[i]) WorkerStatus{};
+}
+
+PFTIII::Validation::WorkerStatus&
+PFTIII::Validation::WorkerStatusTable::operator[](
+    const uint8_t worker)
+{
+	if (worker >= this->count)
+		throw std::out_of_range("No status for worker " +
+		    std::to_string(worker));
+	return (this->statuses[worker]);
+}
+
+uint8_t
+PFTIII::Validation::WorkerStatusTable::size()
+    const
+{
+	return (this->count);
+}
+
+PFTIII::Validation::WorkerStatusTable::~WorkerStatusTable()
+{
+	::munmap(this->statuses, sizeof(WorkerStatus) * std::max<uint8_t>(
+	    this->count, 1));
+}
+
+PFTIII::Validation::ProcessMonitor::ProcessMonitor(
+    const std::chrono::milliseconds interval)
+{
+	this->epoll = ::epoll_create1(EPOLL_CLOEXEC);
+	if (this->epoll == -1)
+		throw std::runtime_error("Could not create epoll instance (" +
+		    getErrorMessage() + ")");
+
+	this->timer = ::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (this->timer == -1) {
+		const std::string message{getErrorMessage()};
+		::close(this->epoll);
+		throw std::runtime_error("Could not create timer (" + message +
+		    ")");
+	}
+
+	const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+	    interval);
+	::timespec period{};
+	period.tv_sec = seconds.count();
+	period.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(
+	    interval - seconds).count();
+	const ::itimerspec schedule{period, period};
+	::epoll_event event{};
+	event.events = EPOLLIN;
+	event.data.fd = this->timer;
+	if ((::timerfd_settime(this->timer, 0, &schedule, nullptr) == -1) ||
+	    (::epoll_ctl(this->epoll, EPOLL_CTL_ADD, this->timer,
+	    &event) == -1)) {
+		const std::string message{getErrorMessage()};
+		::close(this->timer);
+		::close(this->epoll);
+		throw std::runtime_error("Could not start timer (" + message +
+		    ")");
+	}
+}
+
+void
+PFTIII::Validation::ProcessMonitor::watch(
+    const pid_t pid)
+{
+	/* glibc only wraps pidfd_open() from 2.36 */
+	const int pidfd{static_cast<int>(::syscall(SYS_pidfd_open, pid, 0))};
+	if (pidfd == -1)
+		throw std::runtime_error("Could not open pidfd for process " +
+		    std::to_string(pid) + " (" + getErrorMessage() + ")");
+
+	/* Readable once the process exits */
+	::epoll_event event{};
+	event.events = EPOLLIN;
+	event.data.fd = pidfd;
+	if (::epoll_ctl(this->epoll, EPOLL_CTL_ADD, pidfd, &event) == -1) {
+		const std::string message{getErrorMessage()};
+		::close(pidfd);
+		throw std::runtime_error("Could not watch process " +
+		    std::to_string(pid) + " (" + message + ")");
+	}
+	this->children[pidfd] = pid;
+}
+
+std::optional<PFTIII::Validation::ProcessMonitor::Exit>
+PFTIII::Validation::ProcessMonitor::wait()
+{
+	::epoll_event event{};
+	int ready{};
+	while ((ready = ::epoll_wait(this->epoll, &event, 1, -1)) != 1) {
+		/* e.g., SIGTERM, whose handler drains the queue */
+		if ((ready == -1) && (errno != EINTR))
+			throw std::runtime_error("Error while waiting for "
+			    "processes (" + getErrorMessage() + ")");
+	}
+
+	if (event.data.fd == this->timer) {
+		uint64_t expirations{};
+		if (::read(this->timer, &expirations, sizeof(expirations)) ==
+		    -1)
+			throw std::runtime_error("Error reading timer (" +
+			    getErrorMessage() + ")");
+		return (std::nullopt);
+	}
+
+	const int pidfd{event.data.fd};
+	const pid_t pid{this->children.at(pidfd)};
+	Exit exited{pid, 0};
+	while (::waitpid(pid, &exited.status, 0) == -1)
+		if (errno != EINTR)
+			throw std::runtime_error{"Error while reaping: " +
+			    getErrorMessage()};
+
+	::epoll_ctl(this->epoll, EPOLL_CTL_DEL, pidfd, nullptr);
+	::close(pidfd);
+	this->children.erase(pidfd);
+	return (exited);
+}
+
+std::size_t
+PFTIII::Validation::ProcessMonitor::size()
+    const
+{
+	return (this->children.size());
+}
+
+PFTIII::Validation::ProcessMonitor::~ProcessMonitor()
+{
+	for (const auto &[pidfd, pid] : this->children)
+		::close(pidfd);
+	::close(this->timer);
+	::close(this->epoll);
+}
+
+PFTIII::Validation::SupervisionResult
+PFTIII::Validation::superviseWorkers(
+    WorkerStatusTable &statuses,
+    const WorkQueue &queue,
+    const std::chrono::seconds timeout,
+    const uint8_t maxRetries,
+    const WorkerSpawner &spawn,
+    const IncidentHandler &onIncident,
+    const TickHandler &onTick)
+{
+	/* How often to look for stuck workers */
+	static constexpr std::chrono::milliseconds TickInterval{1000};
+	ProcessMonitor monitor{TickInterval};
+
+	/*
+	 * An implementation that crashes on every item would otherwise be
+	 * restarted for every item. Give up once this many items in a row
+	 * are lost with no other item finishing in between.
+	 */
+	const uint64_t maxFruitlessLosses{3 * (uint64_t{maxRetries} + 1) *
+	    std::max<uint8_t>(statuses.size(), 1)};
+	uint64_t fruitlessLosses{0};
+	uint64_t completedAtLastLoss{0};
+	const auto completed = [&statuses]() {
+		uint64_t total{0};
+		for (uint8_t i{0}; i < statuses.size(); ++i)
+			total += statuses[i].completed.load(
+			    std::memory_order_relaxed);
+		return (total);
+	};
+
+	SupervisionResult result{};
+	std::unordered_map<pid_t, uint8_t> workers{};
+	std::unordered_set<pid_t> killed{};
+	std::unordered_map<uint64_t, uint8_t> attempts{};
+
+	const auto start = [&](const uint8_t worker,
+	    const std::optional<uint64_t> retry) {
+		statuses[worker].reset();
+		const pid_t pid{spawn(worker, retry)};
+		workers[pid] = worker;
+		monitor.watch(pid);
+	};
+	for (uint8_t i{0}; i < statuses.size(); ++i)
+		start(i, std::nullopt);
+
+	while (!workers.empty()) {
+		const auto exited = monitor.wait();
+
+		/* Kill anything that has stalled */
+		if (!exited) {
+			const int64_t limit{std::chrono::duration_cast<
+			    std::chrono::nanoseconds>(timeout).count()};
+			for (const auto &[running, worker] : workers) {
+				const auto &s = statuses[worker];
+				if ((timeout.count() == 0) ||
+				    (s.item.load(std::memory_order_acquire) ==
+				    WorkerStatus::Idle) ||
+				    ((now() - s.started.load(
+				    std::memory_order_relaxed)) < limit) ||
+				    killed.contains(running))
+					continue;
+				if (::kill(running, SIGKILL) == 0)
+					killed.insert(running);
+			}
+			if (onTick)
+				onTick();
+			continue;
+		}
+
+		const auto [pid, status] = *exited;
+		const auto it = workers.find(pid);
+		if (it == workers.end())
+			continue;
+		const uint8_t worker{it->second};
+		workers.erase(it);
+		const bool timedOut{killed.erase(pid) != 0};
+		if (!timedOut && WIFEXITED(status) &&
+		    (WEXITSTATUS(status) == EXIT_SUCCESS))
+			continue;
+
+		const uint64_t item{statuses[worker].item.load(
+		    std::memory_order_acquire)};
+		if (item == WorkerStatus::Idle) {
+			++result.failed;
+			continue;
+		}
+
+		Incident incident{};
+		incident.worker = worker;
+		incident.pid = pid;
+		incident.item = item;
+		if (timedOut) {
+			incident.kind = Incident::Kind::Timeout;
+			incident.detail = "Killed after " +
+			    std::to_string(timeout.count()) + " s";
+		} else if (WIFSIGNALED(status)) {
+			incident.kind = Incident::Kind::Signal;
+			incident.detail = ::strsignal(WTERMSIG(status));
+		} else {
+			incident.kind = Incident::Kind::Exit;
+			incident.detail = "Exit status " +
+			    std::to_string(WEXITSTATUS(status));
+		}
+		const uint64_t completedNow{completed()};
+		fruitlessLosses = ((completedNow == completedAtLastLoss) ?
+		    fruitlessLosses + 1 : 1);
+		completedAtLastLoss = completedNow;
+		if (fruitlessLosses >= maxFruitlessLosses)
+			result.gaveUp = true;
+
+		incident.attempt = ++attempts[item];
+		incident.retrying = (incident.attempt <= maxRetries) &&
+		    !queue.isDraining() && !result.gaveUp;
+		onIncident(incident);
+
+		if (incident.retrying) {
+			start(worker, item);
+		} else {
+			++result.abandoned;
+			if (!queue.isDraining() && !queue.isExhausted() &&
+			    !result.gaveUp)
+				start(worker, std::nullopt);
+		}
+	}
+
+	return (result);
+}
@@ -0,0 +1,401 @@
+/*
+ * This software was developed at the National Institute of Standards and
+ * Technology (NIST) by employees of the Federal Government in the course
+ * of their official duties. Pursuant to title 17 Section 105 of the
+ * United States Code, this software is not subject to copyright protection
+ * and is in the public domain. NIST assumes no responsibility whatsoever for
+ * its use by other parties, and makes no guarantees, expressed or implied,
+ * about its quality, reliability, or any other characteristic.
+ */
+
+#ifndef PFTIII_VALIDATION_SUPERVISOR_H_
+#define PFTIII_VALIDATION_SUPERVISOR_H_
+
+#include <sys/types.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <pftiii_validation_scheduler.h>
+
+namespace PFTIII
+{
+	namespace Validation
+	{
+		/**
+		 * @brief
+		 * Counts of durations, in buckets of roughly logarithmic
+		 * width.
+		 *
+		 * @details
+		 * Each power of two microseconds is divided into four
+		 * buckets, so a duration is known to within 25% while the
+		 * histogram stays small enough to keep one per worker in
+		 * shared memory.
+		 */
+		struct LatencyHistogram
+		{
+			/** Number of buckets, reaching beyond a week. */
+			static constexpr std::size_t Buckets{160};
+
+			/** Number of durations in each bucket. */
+			std::array<std::atomic<uint64_t>, Buckets> counts{};
+
+			/**
+			 * @brief
+			 * Count a duration.
+			 *
+			 * @param latency
+			 * Duration to count. Durations beyond the last bucket
+			 * are counted in it.
+			 */
+			void
+			record(
+			    const std::chrono::nanoseconds latency);
+
+			/**
+			 * @brief
+			 * Obtain the bucket in which a duration is counted.
+			 *
+			 * @param latency
+			 * Duration.
+			 *
+			 * @return
+			 * Bucket, in [0, Buckets).
+			 */
+			static std::size_t
+			getBucket(
+			    const std::chrono::nanoseconds latency);
+
+			/**
+			 * @brief
+			 * Obtain the upper limit of a bucket.
+			 *
+			 * @param bucket
+			 * Bucket, in [0, Buckets).
+			 *
+			 * @return
+			 * Shortest duration counted in the following bucket.
+			 */
+			static std::chrono::microseconds
+			getUpperBound(
+			    const std::size_t bucket);
+		};
+
+		/**
+		 * @brief
+		 * What one worker is doing, as seen by its supervisor.
+		 *
+		 * @details
+		 * Statuses live in a WorkerStatusTable in shared memory,
+		 * so a worker in a forked child updates its own status
+		 * and the parent can read it while the child runs, or
+		 * after the child has died.
+		 */
+		struct WorkerStatus
+		{
+			/** Value of `item` while no item is in progress. */
+			static constexpr uint64_t Idle{UINT64_MAX};
+
+			/** Item in progress. */
+			std::atomic<uint64_t> item{Idle};
+			/** When `item` began, in steady_clock nanoseconds. */
+			std::atomic<int64_t> started{0};
+			/** Number of items finished. */
+			std::atomic<uint64_t> completed{0};
+			/** Time taken by each call to the implementation. */
+			LatencyHistogram latencies{};
+
+			/**
+			 * @brief
+			 * Report that work on an item has begun.
+			 *
+			 * @param item
+			 * Item begun.
+			 */
+			void
+			begin(
+			    const uint64_t item);
+
+			/**
+			 * @brief
+			 * Report that the implementation has returned from
+			 * the item begun, recording how long it took.
+			 *
+			 * @note
+			 * Must be called from the thread that called begin(),
+			 * before it begins another item.
+			 */
+			void
+			returned();
+
+			/**
+			 * @brief
+			 * Report that an item is finished, including writing
+			 * its results.
+			 *
+			 * @param item
+			 * Item finished. Status is only cleared if no other
+			 * item has since begun.
+			 */
+			void
+			end(
+			    const uint64_t item);
+
+			/** Mark no item as in progress. */
+			void
+			reset();
+		};
+
+		/** WorkerStatus for each of a fixed number of workers. */
+		class WorkerStatusTable
+		{
+		public:
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param size
+			 * Number of workers.
+			 *
+			 * @throw runtime_error
+			 * Could not map shared memory.
+			 */
+			WorkerStatusTable(
+			    const uint8_t size);
+
+			/** @return Status of `worker`, in [0, size()). */
+			WorkerStatus&
+			operator[](
+			    const uint8_t worker);
+
+			/** @return Number of workers. */
+			uint8_t
+			size()
+			    const;
+
+			~WorkerStatusTable();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			WorkerStatusTable(const WorkerStatusTable&) = delete;
+			WorkerStatusTable& operator=(
+			    const WorkerStatusTable&) = delete;
+			/** @endcond */
+
+		private:
+			/* Cross-process atomics must not fall back to locks */
+			static_assert(std::atomic<int64_t>::is_always_lock_free);
+
+			/** Statuses, in shared memory. */
+			WorkerStatus *statuses{};
+			/** Number of statuses. */
+			const uint8_t count;
+		};
+
+		/**
+		 * @brief
+		 * Waits for child processes to exit, waking at a regular
+		 * interval.
+		 *
+		 * @details
+		 * Each child is watched through a pidfd and the interval
+		 * through a timerfd, all registered with one epoll
+		 * instance, so the caller sleeps until something happens
+		 * instead of polling.
+		 */
+		class ProcessMonitor
+		{
+		public:
+			/** A child that has exited and been reaped. */
+			struct Exit
+			{
+				/** Process ID. */
+				pid_t pid{};
+				/** Status, as from waitpid(). */
+				int status{};
+			};
+
+			/**
+			 * @brief
+			 * Constructor.
+			 *
+			 * @param interval
+			 * Time between ticks returned by wait().
+			 *
+			 * @throw runtime_error
+			 * Could not create the epoll instance or timer.
+			 */
+			ProcessMonitor(
+			    const std::chrono::milliseconds interval);
+
+			/**
+			 * @brief
+			 * Begin watching a child.
+			 *
+			 * @param pid
+			 * Child of the calling process that has not been
+			 * reaped. It may already have exited.
+			 *
+			 * @throw runtime_error
+			 * Could not open or register a pidfd for `pid`.
+			 */
+			void
+			watch(
+			    const pid_t pid);
+
+			/**
+			 * @brief
+			 * Wait until a watched child exits or the interval
+			 * next elapses.
+			 *
+			 * @return
+			 * The child, which is reaped and no longer watched,
+			 * or std::nullopt at a tick.
+			 *
+			 * @throw runtime_error
+			 * Error waiting or reaping.
+			 */
+			std::optional<Exit>
+			wait();
+
+			/** @return Number of children being watched. */
+			std::size_t
+			size()
+			    const;
+
+			~ProcessMonitor();
+
+			/** @cond SUPPRESS_FROM_DOXYGEN */
+			ProcessMonitor(const ProcessMonitor&) = delete;
+			ProcessMonitor& operator=(
+			    const ProcessMonitor&) = delete;
+			/** @endcond */
+
+		private:
+			/** epoll instance. */
+			int epoll{-1};
+			/** timerfd expiring every interval. */
+			int timer{-1};
+			/** Process IDs of watched children, by pidfd. */
+			std::unordered_map<int, pid_t> children{};
+		};
+
+		/** Function called at each tick of a ProcessMonitor. */
+		using TickHandler = std::function<void()>;
+
+		/** An item whose worker was lost. */
+		struct Incident
+		{
+			/** Ways a worker can be lost. */
+			enum class Kind
+			{
+				/** Killed for exceeding the per-item timeout. */
+				Timeout,
+				/** Terminated by a signal. */
+				Signal,
+				/** Exited unsuccessfully, e.g., on exception. */
+				Exit
+			};
+
+			/** Worker that was lost. */
+			uint8_t worker{};
+			/** Process that was lost. */
+			pid_t pid{};
+			/** Item in progress. */
+			uint64_t item{};
+			/** How the worker was lost. */
+			Kind kind{};
+			/** Description of the signal or exit status. */
+			std::string detail{};
+			/** Number of times `item` has now been lost. */
+			uint8_t attempt{};
+			/** Whether `item` will be attempted again. */
+			bool retrying{};
+		};
+
+		/** Outcome of superviseWorkers(). */
+		struct SupervisionResult
+		{
+			/** Items lost more times than allowed. */
+			uint64_t abandoned{};
+			/** Workers lost while no item was in progress. */
+			uint64_t failed{};
+			/**
+			 * Whether lost workers stopped being replaced because
+			 * items kept being lost without any finishing.
+			 */
+			bool gaveUp{};
+		};
+
+		/**
+		 * Function that fork()s a worker into a slot of the
+		 * WorkerStatusTable, returning its process ID. The worker
+		 * performs the item passed, if any, before claiming work.
+		 */
+		using WorkerSpawner = std::function<pid_t(const uint8_t worker,
+		    const std::optional<uint64_t> retry)>;
+
+		/** Function called for each Incident. */
+		using IncidentHandler = std::function<void(
+		    const Incident &incident)>;
+
+		/**
+		 * @brief
+		 * Run worker processes, replacing those that crash or stop
+		 * making progress.
+		 *
+		 * @param statuses
+		 * Status of each worker, reported by the workers.
+		 * @param queue
+		 * Queue from which the workers claim work.
+		 * @param timeout
+		 * Time an item may be in progress before its worker is
+		 * killed, or 0 for no limit.
+		 * @param maxRetries
+		 * Number of times an item whose worker was lost is
+		 * attempted again before being abandoned.
+		 * @param spawn
+		 * Starts a worker.
+		 * @param onIncident
+		 * Called after each worker lost with an item in progress,
+		 * before it is replaced.
+		 * @param onTick
+		 * Called about once a second while workers run, e.g., to
+		 * report progress.
+		 *
+		 * @return
+		 * Counts of abandoned items and of workers that failed
+		 * outside of an item, and whether supervision gave up.
+		 *
+		 * @throw runtime_error
+		 * Error waiting for children, or from `spawn`,
+		 * `onIncident`, or `onTick`.
+		 *
+		 * @note
+		 * One worker is spawned per status. A lost worker is
+		 * replaced in the same slot while an item is being retried
+		 * or `queue` has positions left. Workers lost outside of an
+		 * item are not replaced, since their replacements would
+		 * likely fail the same way. For the same reason, nothing is
+		 * replaced after many items in a row are lost with none
+		 * finishing in between.
+		 */
+		SupervisionResult
+		superviseWorkers(
+		    WorkerStatusTable &statuses,
+		    const WorkQueue &queue,
+		    const std::chrono::seconds timeout,
+		    const uint8_t maxRetries,
+		    const WorkerSpawner &spawn,
+		    const IncidentHandler &onIncident,
+		    const TickHandler &onTick = {});
+	}
+}
+
+#endif /* PFTIII_VALIDATION_SUPERVISOR_H_ */